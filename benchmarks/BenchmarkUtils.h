@@ -0,0 +1,90 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace finirig::bench {
+
+/**
+ * @brief Register the standard block size x sample rate grid
+ *
+ * Block sizes 16..2048 samples, sample rates 44.1..192 kHz.
+ */
+inline void audioArguments(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgNames({"block", "rate"});
+    benchmark->ArgsProduct({
+        {16, 32, 64, 128, 256, 512, 1024, 2048},
+        {44100, 48000, 96000, 192000}
+    });
+}
+
+/**
+ * @brief Deterministic guitar-like test signal (decaying harmonics plus noise)
+ */
+inline std::vector<float> makeTestSignal(int numSamples, double sampleRate) {
+    std::vector<float> signal(static_cast<size_t>(numSamples));
+    std::uint32_t noise = 0x12345678u;
+    for (int sample = 0; sample < numSamples; ++sample) {
+        const double t = sample / sampleRate;
+        noise = noise * 1664525u + 1013904223u;
+        const float white = static_cast<float>(noise >> 8) / 16777216.0f - 0.5f;
+        signal[static_cast<size_t>(sample)] = static_cast<float>(
+            0.4 * std::sin(2.0 * 3.141592653589793 * 110.0 * t)
+            + 0.2 * std::sin(2.0 * 3.141592653589793 * 220.0 * t)
+            + 0.1 * std::sin(2.0 * 3.141592653589793 * 330.0 * t)
+        ) + 0.01f * white;
+    }
+    return signal;
+}
+
+/**
+ * @brief Attach the per-sample and realtime counters to a benchmark
+ *
+ * - time_per_sample: seconds of CPU per processed sample (shown as ns)
+ * - realtime_factor: seconds of audio processed per second of CPU; the
+ *   callback deadline is met while this stays above 1 (DSP load = 1 / factor)
+ */
+inline void setAudioCounters(benchmark::State& state, int numSamples, double sampleRate) {
+    const auto samples = static_cast<double>(numSamples);
+    state.SetItemsProcessed(state.iterations() * numSamples);
+    state.counters["time_per_sample"] = benchmark::Counter(
+        samples,
+        benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert
+    );
+    state.counters["realtime_factor"] = benchmark::Counter(
+        samples / sampleRate,
+        benchmark::Counter::kIsIterationInvariantRate
+    );
+}
+
+/**
+ * @brief Time processChannels() of a prepared processor on mono blocks
+ *
+ * The input is restored before every call so stateful processors see a
+ * steady signal instead of their own output; the copy is part of the
+ * measured time but is negligible next to any real stage.
+ */
+template <typename Processor>
+void runChannelsBenchmark(benchmark::State& state, Processor& processor) {
+    const auto numSamples = static_cast<int>(state.range(0));
+    const auto sampleRate = static_cast<double>(state.range(1));
+
+    processor.prepare(sampleRate);
+    const auto input = makeTestSignal(numSamples, sampleRate);
+    std::vector<float> buffer(input.size());
+    float* channels[] = {buffer.data()};
+
+    for (auto _ : state) {
+        std::copy(input.begin(), input.end(), buffer.begin());
+        processor.processChannels(channels, 1, numSamples);
+        benchmark::DoNotOptimize(buffer.data());
+        benchmark::ClobberMemory();
+    }
+
+    setAudioCounters(state, numSamples, sampleRate);
+}
+
+} // namespace finirig::bench
@@ -0,0 +1,64 @@
+#include "BenchmarkUtils.h"
+#include "finirig/amps/NeuralAmp.h"
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace finirig::amps::bench {
+
+namespace {
+
+// Random weights at the scale of a trained capture; speed only depends on
+// the shape
+NeuralNetwork::Weights makeWeights(NeuralNetwork::CellType cellType, int hiddenSize) {
+    std::mt19937 rng(42);
+    const auto hidden = static_cast<size_t>(hiddenSize);
+    const auto rows = static_cast<size_t>(NeuralNetwork::getNumGates(cellType)) * hidden;
+    const float scale = 1.0f / std::sqrt(static_cast<float>(hiddenSize));
+    std::uniform_real_distribution<float> distribution(-scale, scale);
+
+    auto random = [&](size_t count) {
+        std::vector<float> values(count);
+        for (auto& value : values) {
+            value = distribution(rng);
+        }
+        return values;
+    };
+
+    NeuralNetwork::Weights weights;
+    weights.cellType = cellType;
+    weights.hiddenSize = hiddenSize;
+    weights.inputWeights = random(rows);
+    weights.recurrentWeights = random(rows * hidden);
+    weights.inputBias = random(rows);
+    weights.recurrentBias = random(rows);
+    weights.outputWeights = random(hidden);
+    weights.skip = true;
+    return weights;
+}
+
+void runNeuralAmp(benchmark::State& state, NeuralNetwork::CellType cellType) {
+    NeuralAmp amp;
+    amp.setModel(makeWeights(cellType, static_cast<int>(state.range(2))));
+    finirig::bench::runChannelsBenchmark(state, amp);
+}
+
+} // namespace
+
+// state.range(2) = hidden size. The common capture size is 40 (LSTM) and a
+// realtime_factor of 5 keeps it under 20% of one core
+static void BM_NeuralAmp_Lstm(benchmark::State& state) {
+    runNeuralAmp(state, NeuralNetwork::CellType::Lstm);
+}
+BENCHMARK(BM_NeuralAmp_Lstm)
+    ->ArgNames({"block", "rate", "hidden"})
+    ->ArgsProduct({{128}, {48000}, {16, 32, 40, 64}});
+
+static void BM_NeuralAmp_Gru(benchmark::State& state) {
+    runNeuralAmp(state, NeuralNetwork::CellType::Gru);
+}
+BENCHMARK(BM_NeuralAmp_Gru)
+    ->ArgNames({"block", "rate", "hidden"})
+    ->ArgsProduct({{128}, {48000}, {16, 32, 40, 64}});
+
+} // namespace finirig::amps::bench
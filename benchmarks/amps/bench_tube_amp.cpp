@@ -0,0 +1,48 @@
+#include "BenchmarkUtils.h"
+#include "finirig/amps/TubeAmp.h"
+#include <memory>
+#include <vector>
+
+namespace finirig::amps::bench {
+
+static void BM_TubeAmp(benchmark::State& state) {
+    TubeAmp amp;
+    amp.setGain(0.8f);
+    finirig::bench::runChannelsBenchmark(state, amp);
+}
+BENCHMARK(BM_TubeAmp)->Apply(finirig::bench::audioArguments);
+
+// Several amps one after another on one core, as in a multi-amp rig;
+// state.range(2) = number of instances. realtime_factor is for all of them
+static void BM_TubeAmp_Instances(benchmark::State& state) {
+    const auto numSamples = static_cast<int>(state.range(0));
+    const auto sampleRate = static_cast<double>(state.range(1));
+    const auto numInstances = static_cast<size_t>(state.range(2));
+
+    std::vector<std::unique_ptr<TubeAmp>> amps;
+    for (size_t i = 0; i < numInstances; ++i) {
+        amps.push_back(std::make_unique<TubeAmp>());
+        amps.back()->setGain(0.8f);
+        amps.back()->prepare(sampleRate);
+    }
+
+    const auto input = finirig::bench::makeTestSignal(numSamples, sampleRate);
+    std::vector<float> buffer(input.size());
+    float* channels[] = {buffer.data()};
+
+    for (auto _ : state) {
+        for (auto& amp : amps) {
+            std::copy(input.begin(), input.end(), buffer.begin());
+            amp->processChannels(channels, 1, numSamples);
+            benchmark::DoNotOptimize(buffer.data());
+        }
+        benchmark::ClobberMemory();
+    }
+
+    finirig::bench::setAudioCounters(state, numSamples, sampleRate);
+}
+BENCHMARK(BM_TubeAmp_Instances)
+    ->ArgNames({"block", "rate", "instances"})
+    ->ArgsProduct({{128}, {48000}, {1, 4, 8}});
+
+} // namespace finirig::amps::bench
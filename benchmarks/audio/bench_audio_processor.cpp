@@ -0,0 +1,54 @@
+#include "BenchmarkUtils.h"
+#include "finirig/audio/AudioProcessor.h"
+#include <algorithm>
+#include <vector>
+
+namespace finirig::audio::bench {
+
+namespace {
+
+// Minimal processor that only implements processSample(), so the
+// benchmarks below measure the default block paths and their dispatch cost
+class GainProcessor : public AudioProcessor {
+public:
+    [[nodiscard]] float processSample(float input) noexcept override {
+        return input * 0.5f;
+    }
+};
+
+} // namespace
+
+static void BM_AudioProcessor_DefaultProcessBlock(benchmark::State& state) {
+    const auto numSamples = static_cast<int>(state.range(0));
+    const auto sampleRate = static_cast<double>(state.range(1));
+    constexpr int numChannels = 2;
+
+    GainProcessor processor;
+    processor.prepare(sampleRate);
+
+    // Interleaved stereo, channel 0 carries the signal
+    const auto signal = finirig::bench::makeTestSignal(numSamples, sampleRate);
+    std::vector<float> input(static_cast<size_t>(numSamples * numChannels));
+    for (int sample = 0; sample < numSamples; ++sample) {
+        input[static_cast<size_t>(sample * numChannels)] = signal[static_cast<size_t>(sample)];
+    }
+    std::vector<float> buffer(input.size());
+
+    for (auto _ : state) {
+        std::copy(input.begin(), input.end(), buffer.begin());
+        processor.processBlock(buffer.data(), numChannels, numSamples);
+        benchmark::DoNotOptimize(buffer.data());
+        benchmark::ClobberMemory();
+    }
+
+    finirig::bench::setAudioCounters(state, numSamples, sampleRate);
+}
+BENCHMARK(BM_AudioProcessor_DefaultProcessBlock)->Apply(finirig::bench::audioArguments);
+
+static void BM_AudioProcessor_DefaultProcessChannels(benchmark::State& state) {
+    GainProcessor processor;
+    finirig::bench::runChannelsBenchmark(state, processor);
+}
+BENCHMARK(BM_AudioProcessor_DefaultProcessChannels)->Apply(finirig::bench::audioArguments);
+
+} // namespace finirig::audio::bench
@@ -0,0 +1,27 @@
+#include "BenchmarkUtils.h"
+#include "finirig/audio/LevelMeter.h"
+
+namespace finirig::audio::bench {
+
+// Metering cost per callback on a stereo output, with the ring drained as
+// the UI would so it never fills
+static void BM_LevelMeter_Stereo(benchmark::State& state) {
+    const auto numSamples = static_cast<int>(state.range(0));
+    const auto sampleRate = static_cast<double>(state.range(1));
+
+    LevelMeter meter;
+    const auto signal = finirig::bench::makeTestSignal(numSamples, sampleRate);
+    const float* channels[] = {signal.data(), signal.data()};
+    LevelMeter::Frame frame;
+
+    for (auto _ : state) {
+        meter.measure(channels, 2, numSamples);
+        meter.pop(frame);
+        benchmark::DoNotOptimize(frame);
+    }
+
+    finirig::bench::setAudioCounters(state, numSamples, sampleRate);
+}
+BENCHMARK(BM_LevelMeter_Stereo)->Apply(finirig::bench::audioArguments);
+
+} // namespace finirig::audio::bench
@@ -0,0 +1,30 @@
+#include "BenchmarkUtils.h"
+#include "finirig/amps/TubeAmp.h"
+#include "finirig/audio/ProcessingGraph.h"
+#include <memory>
+
+namespace finirig::audio::bench {
+
+// Dual-amp rig: the input split into two TubeAmps summed at the output;
+// state.range(2) = worker threads besides the audio thread
+static void BM_ProcessingGraph_DualAmp(benchmark::State& state) {
+    ProcessingGraph graph(static_cast<int>(state.range(2)));
+    for (int branch = 0; branch < 2; ++branch) {
+        auto amp = std::make_unique<finirig::amps::TubeAmp>();
+        amp->setGain(branch == 0 ? 0.8f : 0.4f);
+        const int node = graph.addNode(std::move(amp));
+        graph.connect(ProcessingGraph::INPUT, node);
+        graph.connect(node, ProcessingGraph::OUTPUT, 0.5f);
+    }
+    finirig::bench::runChannelsBenchmark(state, graph);
+}
+BENCHMARK(BM_ProcessingGraph_DualAmp)
+    ->ArgNames({"block", "rate", "workers"})
+    ->ArgsProduct({
+        {64, 128, 256, 512},
+        {48000, 96000},
+        {0, 1, 3}
+    })
+    ->UseRealTime();
+
+} // namespace finirig::audio::bench
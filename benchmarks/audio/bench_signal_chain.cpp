@@ -0,0 +1,37 @@
+#include "BenchmarkUtils.h"
+#include "finirig/audio/SignalChain.h"
+#include "finirig/pedals/OverdrivePedal.h"
+#include <memory>
+
+namespace finirig::audio::bench {
+
+// Preset-sized chains: state.range(2) overdrive stages in series
+static void BM_SignalChain_Overdrives(benchmark::State& state) {
+    SignalChain chain;
+    for (int stage = 0; stage < state.range(2); ++stage) {
+        auto pedal = std::make_unique<finirig::pedals::OverdrivePedal>();
+        pedal->setDrive(0.3f);
+        chain.addStage(std::move(pedal));
+    }
+    finirig::bench::runChannelsBenchmark(state, chain);
+}
+BENCHMARK(BM_SignalChain_Overdrives)
+    ->ArgNames({"block", "rate", "stages"})
+    ->ArgsProduct({
+        {16, 32, 64, 128, 256, 512, 1024, 2048},
+        {44100, 48000, 96000, 192000},
+        {1, 8, 12}
+    });
+
+// Chain overhead on its own: every stage bypassed
+static void BM_SignalChain_Bypassed(benchmark::State& state) {
+    SignalChain chain;
+    for (int stage = 0; stage < 12; ++stage) {
+        chain.addStage(std::make_unique<finirig::pedals::OverdrivePedal>());
+        chain.setStageBypassed(stage, true);
+    }
+    finirig::bench::runChannelsBenchmark(state, chain);
+}
+BENCHMARK(BM_SignalChain_Bypassed)->Apply(finirig::bench::audioArguments);
+
+} // namespace finirig::audio::bench
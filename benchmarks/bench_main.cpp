@@ -0,0 +1,7 @@
+#include <benchmark/benchmark.h>
+
+// Main benchmark entry point
+// Google Benchmark handles registration, argument parsing and JSON output
+// (--benchmark_format=json, --benchmark_out=<file>)
+
+BENCHMARK_MAIN();
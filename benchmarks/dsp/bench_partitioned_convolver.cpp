@@ -0,0 +1,51 @@
+#include "BenchmarkUtils.h"
+#include "finirig/dsp/PartitionedConvolver.h"
+#include <cmath>
+#include <vector>
+
+namespace finirig::dsp::bench {
+
+namespace {
+
+std::vector<float> makeDecayingImpulseResponse(int length) {
+    std::vector<float> ir(static_cast<size_t>(length));
+    for (int i = 0; i < length; ++i) {
+        const float decay = std::exp(-6.0f * static_cast<float>(i) / static_cast<float>(length));
+        ir[static_cast<size_t>(i)] = decay * std::sin(0.37f * static_cast<float>(i));
+    }
+    return ir;
+}
+
+} // namespace
+
+// state.range(2) = IR length in milliseconds
+static void BM_PartitionedConvolver(benchmark::State& state) {
+    const auto numSamples = static_cast<int>(state.range(0));
+    const auto sampleRate = static_cast<double>(state.range(1));
+    const auto irLength = static_cast<int>(sampleRate * static_cast<double>(state.range(2)) / 1000.0);
+
+    PartitionedConvolver convolver;
+    const auto ir = makeDecayingImpulseResponse(irLength);
+    convolver.setImpulseResponse(ir.data(), irLength);
+
+    const auto input = finirig::bench::makeTestSignal(numSamples, sampleRate);
+    std::vector<float> buffer(input.size());
+
+    for (auto _ : state) {
+        std::copy(input.begin(), input.end(), buffer.begin());
+        convolver.process(buffer.data(), numSamples);
+        benchmark::DoNotOptimize(buffer.data());
+        benchmark::ClobberMemory();
+    }
+
+    finirig::bench::setAudioCounters(state, numSamples, sampleRate);
+}
+BENCHMARK(BM_PartitionedConvolver)
+    ->ArgNames({"block", "rate", "ir_ms"})
+    ->ArgsProduct({
+        {64, 256, 1024},
+        {48000},
+        {20, 100, 500, 1000}
+    });
+
+} // namespace finirig::dsp::bench
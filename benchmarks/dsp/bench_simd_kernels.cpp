@@ -0,0 +1,45 @@
+#include "BenchmarkUtils.h"
+#include "finirig/dsp/SimdKernels.h"
+#include <vector>
+
+namespace finirig::dsp::bench {
+
+// Drive/clip kernel at each instruction set level, state.range(2) = SimdLevel
+static void BM_DriveClipKernel(benchmark::State& state) {
+    const auto numSamples = static_cast<int>(state.range(0));
+    const auto sampleRate = static_cast<double>(state.range(1));
+    const auto level = static_cast<SimdLevel>(state.range(2));
+
+    if (!isSimdLevelSupported(level)) {
+        state.SkipWithError("SIMD level not supported on this CPU");
+        return;
+    }
+    state.SetLabel(getSimdLevelName(level));
+
+    const auto kernel = getDriveClipKernel(level);
+    const auto input = finirig::bench::makeTestSignal(numSamples, sampleRate);
+    std::vector<float> buffer(input.size());
+
+    for (auto _ : state) {
+        std::copy(input.begin(), input.end(), buffer.begin());
+        kernel(buffer.data(), numSamples, 5.5f);
+        benchmark::DoNotOptimize(buffer.data());
+        benchmark::ClobberMemory();
+    }
+
+    finirig::bench::setAudioCounters(state, numSamples, sampleRate);
+}
+BENCHMARK(BM_DriveClipKernel)
+    ->ArgNames({"block", "rate", "simd"})
+    ->ArgsProduct({
+        {16, 64, 256, 2048},
+        {48000},
+        {
+            static_cast<int64_t>(SimdLevel::Scalar),
+            static_cast<int64_t>(SimdLevel::Sse2),
+            static_cast<int64_t>(SimdLevel::Avx),
+            static_cast<int64_t>(SimdLevel::Neon)
+        }
+    });
+
+} // namespace finirig::dsp::bench
@@ -0,0 +1,41 @@
+#include "BenchmarkUtils.h"
+#include "finirig/pedals/DiodeClipperPedal.h"
+#include <algorithm>
+#include <vector>
+
+namespace finirig::pedals::bench {
+
+static void BM_DiodeClipperPedal_ProcessChannels(benchmark::State& state) {
+    DiodeClipperPedal pedal;
+    pedal.setDrive(0.8f);
+    finirig::bench::runChannelsBenchmark(state, pedal);
+}
+BENCHMARK(BM_DiodeClipperPedal_ProcessChannels)->Apply(finirig::bench::audioArguments);
+
+// Tone knob moving every block, so the circuit is re-adapted continuously
+static void BM_DiodeClipperPedal_ToneSweep(benchmark::State& state) {
+    const auto numSamples = static_cast<int>(state.range(0));
+    const auto sampleRate = static_cast<double>(state.range(1));
+
+    DiodeClipperPedal pedal;
+    pedal.setDrive(0.8f);
+    pedal.prepare(sampleRate);
+    const auto input = finirig::bench::makeTestSignal(numSamples, sampleRate);
+    std::vector<float> buffer(input.size());
+    float* channels[] = {buffer.data()};
+
+    float tone = 0.0f;
+    for (auto _ : state) {
+        tone = tone < 1.0f ? tone + 0.01f : 0.0f;
+        pedal.setTone(tone);
+        std::copy(input.begin(), input.end(), buffer.begin());
+        pedal.processChannels(channels, 1, numSamples);
+        benchmark::DoNotOptimize(buffer.data());
+        benchmark::ClobberMemory();
+    }
+
+    finirig::bench::setAudioCounters(state, numSamples, sampleRate);
+}
+BENCHMARK(BM_DiodeClipperPedal_ToneSweep)->Apply(finirig::bench::audioArguments);
+
+} // namespace finirig::pedals::bench
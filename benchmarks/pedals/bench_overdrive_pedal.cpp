@@ -0,0 +1,59 @@
+#include "BenchmarkUtils.h"
+#include "finirig/pedals/OverdrivePedal.h"
+#include <algorithm>
+#include <vector>
+
+namespace finirig::pedals::bench {
+
+static void BM_OverdrivePedal_ProcessChannels(benchmark::State& state) {
+    OverdrivePedal pedal;
+    pedal.setDrive(0.8f);
+    finirig::bench::runChannelsBenchmark(state, pedal);
+}
+BENCHMARK(BM_OverdrivePedal_ProcessChannels)->Apply(finirig::bench::audioArguments);
+
+// Tone knob moving every block, so smoothing and coefficient updates are live
+static void BM_OverdrivePedal_ToneSweep(benchmark::State& state) {
+    const auto numSamples = static_cast<int>(state.range(0));
+    const auto sampleRate = static_cast<double>(state.range(1));
+
+    OverdrivePedal pedal;
+    pedal.prepare(sampleRate);
+    const auto input = finirig::bench::makeTestSignal(numSamples, sampleRate);
+    std::vector<float> buffer(input.size());
+    float* channels[] = {buffer.data()};
+
+    float tone = 0.0f;
+    for (auto _ : state) {
+        tone = tone < 1.0f ? tone + 0.01f : 0.0f;
+        pedal.setTone(tone);
+        std::copy(input.begin(), input.end(), buffer.begin());
+        pedal.processChannels(channels, 1, numSamples);
+        benchmark::DoNotOptimize(buffer.data());
+        benchmark::ClobberMemory();
+    }
+
+    finirig::bench::setAudioCounters(state, numSamples, sampleRate);
+}
+BENCHMARK(BM_OverdrivePedal_ToneSweep)->Apply(finirig::bench::audioArguments);
+
+static void BM_OverdrivePedal_ProcessSample(benchmark::State& state) {
+    const auto numSamples = static_cast<int>(state.range(0));
+    const auto sampleRate = static_cast<double>(state.range(1));
+
+    OverdrivePedal pedal;
+    pedal.setDrive(0.8f);
+    pedal.prepare(sampleRate);
+    auto buffer = finirig::bench::makeTestSignal(numSamples, sampleRate);
+
+    for (auto _ : state) {
+        for (auto& sample : buffer) {
+            benchmark::DoNotOptimize(pedal.processSample(sample));
+        }
+    }
+
+    finirig::bench::setAudioCounters(state, numSamples, sampleRate);
+}
+BENCHMARK(BM_OverdrivePedal_ProcessSample)->Apply(finirig::bench::audioArguments);
+
+} // namespace finirig::pedals::bench
@@ -0,0 +1,34 @@
+#include "BenchmarkUtils.h"
+#include "finirig/pedals/OverdrivePedal.h"
+#include "finirig/pedals/OversampledPedal.h"
+#include <memory>
+
+namespace finirig::pedals::bench {
+
+// Overdrive under the oversampling wrapper; state.range(2) = factor,
+// state.range(3) = Oversampler::Quality
+static void BM_OversampledPedal_Overdrive(benchmark::State& state) {
+    auto overdrive = std::make_unique<OverdrivePedal>();
+    overdrive->setDrive(0.8f);
+
+    OversampledPedal pedal(
+        std::move(overdrive),
+        static_cast<int>(state.range(2)),
+        static_cast<finirig::dsp::Oversampler::Quality>(state.range(3))
+    );
+    finirig::bench::runChannelsBenchmark(state, pedal);
+}
+BENCHMARK(BM_OversampledPedal_Overdrive)
+    ->ArgNames({"block", "rate", "factor", "quality"})
+    ->ArgsProduct({
+        {64, 256},
+        {48000},
+        {1, 2, 4, 8},
+        {
+            static_cast<int64_t>(finirig::dsp::Oversampler::Quality::Low),
+            static_cast<int64_t>(finirig::dsp::Oversampler::Quality::Normal),
+            static_cast<int64_t>(finirig::dsp::Oversampler::Quality::High)
+        }
+    });
+
+} // namespace finirig::pedals::bench
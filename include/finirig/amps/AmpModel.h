@@ -8,7 +8,8 @@ namespace finirig::amps {
  * @brief Base class for amplifier modeling
  * 
  * Provides interface for amplifier simulation including
- * preamp, power amp, and cabinet modeling.
+ * preamp, power amp, and cabinet modeling. Cabinets are
+ * convolved separately by CabinetIR, placed after the amp.
  */
 class AmpModel : public finirig::audio::AudioProcessor {
 public:
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "finirig/amps/ImpulseResponseLoader.h"
+#include "finirig/audio/BlockProcessor.h"
+#include "finirig/dsp/PartitionedConvolver.h"
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <array>
+#include <functional>
+#include <memory>
+
+namespace finirig::amps {
+
+/**
+ * @brief Speaker cabinet simulation by impulse response convolution
+ *
+ * Convolves the signal with a measured cabinet (or room) impulse response
+ * using a zero-latency partitioned convolver, so IRs of a second or more
+ * fit in small callbacks. Multi-channel IR files use their first channel.
+ * Without an IR the cabinet passes audio through unchanged.
+ *
+ * IRs are resampled to the rate given to prepare() and partitioned by an
+ * ImpulseResponseLoader, in the background for loadImpulseResponseAsync()
+ * and for a sample rate change. Finished convolvers are handed to the
+ * audio thread through an atomic slot and crossfaded in over FADE_SECONDS;
+ * the audio thread hands the old one back through retire slots, so it
+ * never allocates, frees or locks. Until a reload for a new rate arrives
+ * the previous kernel keeps playing.
+ */
+class CabinetIR : public finirig::audio::BlockProcessor<> {
+public:
+    static constexpr double MAX_IR_SECONDS = ImpulseResponseLoader::MAX_IR_SECONDS;
+    static constexpr double FADE_SECONDS = 0.05;
+
+    /**
+     * @brief Called on the loader thread when an asynchronous load finishes
+     */
+    using LoadCallback = std::function<void(bool success, const juce::String& error)>;
+
+    /**
+     * @param partitionSize Convolver partition size (power of two, >= 8)
+     * @param loader Worker that prepares IRs; null uses the shared loader
+     */
+    explicit CabinetIR(
+        int partitionSize = finirig::dsp::PartitionedConvolver::DEFAULT_PARTITION_SIZE,
+        std::shared_ptr<ImpulseResponseLoader> loader = nullptr
+    );
+    ~CabinetIR() override;
+
+    // Non-copyable
+    CabinetIR(const CabinetIR&) = delete;
+    CabinetIR& operator=(const CabinetIR&) = delete;
+
+    /**
+     * @brief Load an impulse response from an audio file (WAV, AIFF, ...)
+     *
+     * Reads and prepares the IR on the calling thread, then hands it over
+     * like an asynchronous load. Use loadImpulseResponseAsync() while
+     * audio is running.
+     * @throws std::runtime_error if the file cannot be read
+     */
+    void loadImpulseResponse(const juce::File& file);
+
+    /**
+     * @brief Load an impulse response from an open reader
+     *
+     * Normalised to unit energy like a file load, so an IR plays at the
+     * same level whichever way it was loaded. Not cached.
+     * @throws std::runtime_error if reading fails
+     */
+    void loadImpulseResponse(juce::AudioFormatReader& reader);
+
+    /**
+     * @brief Load an impulse response file on the loader thread
+     *
+     * Returns immediately; the cabinet switches to the new IR once it is
+     * ready. A later load or clear supersedes one still in flight.
+     * @param onComplete Optional, called on the loader thread
+     */
+    void loadImpulseResponseAsync(const juce::File& file, LoadCallback onComplete = {});
+
+    /**
+     * @brief Set the impulse response from memory, at its own level
+     * @param samples IR samples (copied)
+     * @param numSamples IR length
+     * @param sampleRate Rate the IR was recorded at
+     */
+    void setImpulseResponse(const float* samples, int numSamples, double sampleRate);
+
+    /**
+     * @brief Remove the impulse response (fades to pass-through)
+     */
+    void clearImpulseResponse();
+
+    [[nodiscard]] bool hasImpulseResponse() const noexcept;
+
+    /**
+     * @brief Length of the current IR at the rate it is convolved at
+     */
+    [[nodiscard]] int getImpulseResponseLength() const noexcept;
+
+    /**
+     * @brief Rate the current IR was recorded at
+     */
+    [[nodiscard]] double getImpulseResponseSampleRate() const noexcept;
+
+    void processChannels(
+        float* const* channelData,
+        int numChannels,
+        int numSamples
+    ) noexcept override;
+
+    void prepare(double sampleRate) override;
+    void reset() override;
+    [[nodiscard]] juce::String getName() const override { return "Cabinet IR"; }
+
+private:
+    struct Handoff;
+
+    // Crossfades run in chunks through this buffer
+    static constexpr int SCRATCH_SIZE = 256;
+
+    int partitionSize_;
+    std::shared_ptr<ImpulseResponseLoader> loader_;
+    std::shared_ptr<Handoff> handoff_; // shared with in-flight loads
+
+    // Audio thread only (or while stopped)
+    finirig::dsp::PartitionedConvolver* active_ = nullptr;
+    finirig::dsp::PartitionedConvolver* fadingOut_ = nullptr;
+    int fadePosition_ = 0;
+    int fadeLength_ = 1;
+    std::array<float, SCRATCH_SIZE> scratch_{};
+
+    void takePendingConvolver() noexcept;
+    void processCrossfade(float* data, int numSamples) noexcept;
+    void requestReload(double sampleRate);
+
+    // Prepare and publish an in-memory IR; kept for reloads at a new rate
+    void setSamples(std::shared_ptr<const std::vector<float>> samples, double sampleRate, bool normalise);
+};
+
+} // namespace finirig::amps
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "finirig/amps/CabinetIR.h"
+#include "finirig/audio/BlockProcessor.h"
+#include <array>
+#include <memory>
+
+namespace finirig::amps {
+
+/**
+ * @brief Two cabinet IRs panned hard left and right
+ *
+ * The classic dual-mic or two-cab stereo spread: the same (mono) amp
+ * signal goes through a different IR on each side. This is a Stereo
+ * stage, so a SignalChain keeps everything before it on one channel and
+ * fans out here. Given a single channel it plays the average of both
+ * cabinets. Load IRs through getLeft() / getRight().
+ */
+class DualCabinet : public finirig::audio::BlockProcessor<> {
+public:
+    /**
+     * @param partitionSize Convolver partition size for both cabinets
+     * @param loader Worker that prepares IRs; null uses the shared loader
+     */
+    explicit DualCabinet(
+        int partitionSize = finirig::dsp::PartitionedConvolver::DEFAULT_PARTITION_SIZE,
+        std::shared_ptr<ImpulseResponseLoader> loader = nullptr
+    );
+    ~DualCabinet() override;
+
+    // Non-copyable
+    DualCabinet(const DualCabinet&) = delete;
+    DualCabinet& operator=(const DualCabinet&) = delete;
+
+    [[nodiscard]] CabinetIR& getLeft() noexcept { return left_; }
+    [[nodiscard]] CabinetIR& getRight() noexcept { return right_; }
+
+    void processChannels(
+        float* const* channelData,
+        int numChannels,
+        int numSamples
+    ) noexcept override;
+
+    void prepare(double sampleRate) override;
+    void reset() override;
+
+    [[nodiscard]] ChannelLayout getChannelLayout() const noexcept override { return ChannelLayout::Stereo; }
+    [[nodiscard]] juce::String getName() const override { return "Dual Cabinet"; }
+
+private:
+    // The mono fallback runs the right cabinet in chunks through this buffer
+    static constexpr int SCRATCH_SIZE = 256;
+
+    CabinetIR left_;
+    CabinetIR right_;
+    std::unique_ptr<std::array<float, SCRATCH_SIZE>> scratch_;
+};
+
+} // namespace finirig::amps
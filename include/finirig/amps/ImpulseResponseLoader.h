@@ -0,0 +1,131 @@
+#pragma once
+
+#include "finirig/dsp/PartitionedConvolver.h"
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace finirig::amps {
+
+/**
+ * @brief Background worker that turns impulse responses into convolution kernels
+ *
+ * Does everything that must stay off the audio thread: file I/O,
+ * resampling to the device rate, loudness normalisation and the FFT of
+ * every partition. Results from files are cached by path, modification
+ * time, sample rate and partition size, so switching back to a cabinet,
+ * or restarting the device at a rate seen before, costs a map lookup.
+ *
+ * Completion callbacks run on the worker thread.
+ */
+class ImpulseResponseLoader {
+public:
+    // Longer IRs are truncated; nothing useful for a cabinet lives past this
+    static constexpr double MAX_IR_SECONDS = 2.0;
+    static constexpr size_t MAX_CACHE_ENTRIES = 16;
+
+    /**
+     * @brief A kernel ready for a convolver, plus where it came from
+     */
+    struct Prepared {
+        std::shared_ptr<const finirig::dsp::PartitionedConvolver::Kernel> kernel;
+        double sourceSampleRate = 0.0; ///< Rate the IR was recorded at
+        double sampleRate = 0.0;       ///< Rate the kernel was prepared for
+    };
+
+    /**
+     * @brief Called with the result, or with null and an error message
+     */
+    using Callback = std::function<void(std::shared_ptr<const Prepared> prepared, const juce::String& error)>;
+
+    ImpulseResponseLoader();
+    ~ImpulseResponseLoader();
+
+    // Non-copyable
+    ImpulseResponseLoader(const ImpulseResponseLoader&) = delete;
+    ImpulseResponseLoader& operator=(const ImpulseResponseLoader&) = delete;
+
+    /**
+     * @brief Process-wide loader, so cabinets share one worker and cache
+     */
+    [[nodiscard]] static std::shared_ptr<ImpulseResponseLoader> getShared();
+
+    /**
+     * @brief Queue a file load; @p onComplete runs on the worker thread
+     */
+    void loadAsync(const juce::File& file, double sampleRate, int partitionSize, Callback onComplete);
+
+    /**
+     * @brief Queue preparation of an in-memory IR (not cached)
+     */
+    void prepareAsync(
+        std::shared_ptr<const std::vector<float>> samples,
+        double sourceSampleRate,
+        double sampleRate,
+        int partitionSize,
+        bool normalise,
+        Callback onComplete
+    );
+
+    /**
+     * @brief Read the first channel of an IR, truncated to MAX_IR_SECONDS
+     * @throws std::runtime_error if the reader is empty or fails
+     */
+    [[nodiscard]] static std::vector<float> read(juce::AudioFormatReader& reader);
+
+    /**
+     * @brief Load a file on the calling thread (cached, normalised)
+     * @throws std::runtime_error if the file cannot be read
+     */
+    [[nodiscard]] std::shared_ptr<const Prepared> load(const juce::File& file, double sampleRate, int partitionSize);
+
+    /**
+     * @brief Resample, optionally normalise and partition an IR on the calling thread
+     *
+     * A sampleRate of 0 keeps the IR at its recorded rate. Normalisation
+     * scales the IR to unit energy, so different cabinets play at similar
+     * loudness.
+     */
+    [[nodiscard]] static std::shared_ptr<const Prepared> prepare(
+        const float* samples,
+        int numSamples,
+        double sourceSampleRate,
+        double sampleRate,
+        int partitionSize,
+        bool normalise
+    );
+
+    [[nodiscard]] size_t getCacheSize() const;
+    void clearCache();
+
+private:
+    struct CacheEntry {
+        std::shared_ptr<const Prepared> prepared;
+        uint64_t lastUsed = 0;
+    };
+
+    void run();
+    [[nodiscard]] static std::string makeCacheKey(const juce::File& file, double sampleRate, int partitionSize);
+    [[nodiscard]] std::shared_ptr<const Prepared> findCached(const std::string& key);
+    void storeCached(const std::string& key, std::shared_ptr<const Prepared> prepared);
+
+    mutable std::mutex mutex_;
+    std::condition_variable wakeUp_;
+    std::deque<std::function<void()>> jobs_;
+    bool stopping_ = false;
+
+    std::map<std::string, CacheEntry> cache_;
+    uint64_t useCounter_ = 0;
+
+    std::thread worker_;
+};
+
+} // namespace finirig::amps
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "finirig/amps/AmpModel.h"
+#include "finirig/amps/NeuralNetwork.h"
+#include "finirig/audio/BlockProcessor.h"
+#include "finirig/audio/Parameter.h"
+#include "finirig/audio/RealtimeEpoch.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace finirig::amps {
+
+/**
+ * @brief Amp model that plays back a captured neural network
+ *
+ * Runs a recurrent network (see NeuralNetwork) trained on a real amp,
+ * between an input gain and an output level. Without a model the amp
+ * passes audio through unchanged.
+ *
+ * Models are loaded on a control thread: the network is built there, then
+ * swapped in atomically; the old one is deleted once the audio thread has
+ * left the block it may have been using (RealtimeEpoch). The audio path
+ * never allocates or locks. reset() only raises a flag; the network state
+ * and smoothers are cleared by the audio thread at the start of its next
+ * block.
+ *
+ * The network runs at the host rate. Captures are trained at a fixed rate
+ * (getModelSampleRate()), so hosts should run at that rate for an accurate
+ * response.
+ */
+class NeuralAmp : public finirig::audio::BlockProcessor<AmpModel> {
+public:
+    // Host-rate samples between smoothing steps
+    static constexpr int PARAMETER_UPDATE_INTERVAL = 32;
+
+    NeuralAmp();
+    ~NeuralAmp() override;
+
+    // Non-copyable
+    NeuralAmp(const NeuralAmp&) = delete;
+    NeuralAmp& operator=(const NeuralAmp&) = delete;
+
+    /**
+     * @brief Input gain (0.0 to 1.0, 0.5 = unity, +-18 dB at the ends)
+     */
+    void setGain(float gain) noexcept override;
+    [[nodiscard]] float getGain() const noexcept override { return gain_.getValue(); }
+
+    /**
+     * @brief Output level (0.0 to 1.0, 0.5 = unity)
+     */
+    void setMasterVolume(float volume) noexcept override;
+    [[nodiscard]] float getMasterVolume() const noexcept override { return master_.getValue(); }
+
+    /**
+     * @brief Load a model from a JSON file (control thread)
+     * @throws std::runtime_error if the file cannot be read or parsed
+     */
+    void loadModel(const juce::File& file);
+
+    /**
+     * @brief Load a model from JSON text (control thread)
+     * @throws std::runtime_error if the model is malformed or unsupported
+     */
+    void loadModelFromJson(const juce::String& json);
+
+    /**
+     * @brief Install a model from weights (control thread)
+     * @throws std::invalid_argument if the weights are unsupported
+     */
+    void setModel(const NeuralNetwork::Weights& weights);
+
+    /**
+     * @brief Remove the model and go back to pass-through (control thread)
+     */
+    void clearModel();
+
+    [[nodiscard]] bool hasModel() const noexcept;
+
+    /**
+     * @brief Rate the current model was trained at (0 without a model)
+     */
+    [[nodiscard]] double getModelSampleRate() const noexcept;
+
+    /**
+     * @brief Hidden size of the current model (0 without a model)
+     */
+    [[nodiscard]] int getHiddenSize() const noexcept;
+
+    void processChannels(
+        float* const* channelData,
+        int numChannels,
+        int numSamples
+    ) noexcept override;
+
+    void prepare(double sampleRate) override;
+    void reset() override;
+    [[nodiscard]] juce::String getName() const override { return "Neural Amp"; }
+
+private:
+    using Parameter = finirig::audio::Parameter;
+
+    Parameter gain_{0.5f, 0.0f, 1.0f, Parameter::Smoothing::Exponential};
+    Parameter master_{0.5f, 0.0f, 1.0f, Parameter::Smoothing::Exponential};
+    int samplesUntilUpdate_ = 0;
+
+    // Audio thread gains, derived from the parameters in updateGains()
+    float inputGain_ = 1.0f;
+    float outputGain_ = 1.0f;
+
+    // Control side; modelMutex_ serialises model swaps
+    std::mutex modelMutex_;
+    std::atomic<double> modelSampleRate_{0.0};
+    std::atomic<int> hiddenSize_{0};
+
+    std::atomic<NeuralNetwork*> network_{nullptr};
+    finirig::audio::RealtimeEpoch processEpoch_;
+
+    // Set by reset(), consumed by the next processChannels() call
+    std::atomic<bool> resetRequested_{true};
+
+    void installNetwork(std::unique_ptr<NeuralNetwork> network, double modelSampleRate);
+    void resetState(NeuralNetwork* network) noexcept;
+    void updateGains() noexcept;
+};
+
+} // namespace finirig::amps
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace finirig::amps {
+
+/**
+ * @brief Recurrent network that maps one input sample to one output sample
+ *
+ * Runs single-layer LSTM or GRU amp captures: a recurrent cell of
+ * HiddenSize units followed by a linear output, optionally added to the
+ * input (skip). Implementations are specialised at compile time for each
+ * supported hidden size, with 4-wide SIMD matrix-vector kernels (SSE2 on
+ * x86, NEON on ARM), and never allocate after construction.
+ */
+class NeuralNetwork {
+public:
+    enum class CellType {
+        Lstm,
+        Gru
+    };
+
+    // Hidden sizes with a compiled kernel (all multiples of the SIMD width)
+    static constexpr std::array<int, 9> SUPPORTED_HIDDEN_SIZES = {8, 12, 16, 20, 24, 32, 40, 48, 64};
+
+    /**
+     * @brief Network description with weights in PyTorch layout
+     *
+     * Gate order follows torch.nn.LSTM (i, f, g, o) and torch.nn.GRU
+     * (r, z, n). Matrices are flattened row-major.
+     */
+    struct Weights {
+        CellType cellType = CellType::Lstm;
+        int hiddenSize = 0;
+        std::vector<float> inputWeights;     // gates * hiddenSize (one input)
+        std::vector<float> recurrentWeights; // gates * hiddenSize rows of hiddenSize
+        std::vector<float> inputBias;        // gates * hiddenSize
+        std::vector<float> recurrentBias;    // gates * hiddenSize
+        std::vector<float> outputWeights;    // hiddenSize
+        float outputBias = 0.0f;
+        bool skip = false;                   // add the input to the output
+        double sampleRate = 48000.0;         // rate the capture was trained at
+    };
+
+    virtual ~NeuralNetwork() = default;
+
+    /**
+     * @brief Build the kernel specialised for the weights' hidden size
+     * @throws std::invalid_argument for an unsupported size or mismatched weights
+     */
+    [[nodiscard]] static std::unique_ptr<NeuralNetwork> create(const Weights& weights);
+
+    /**
+     * @brief Parse a model exported as JSON
+     *
+     * Reads the format written by the common PyTorch amp capture trainers:
+     * "model_data" (unit_type, hidden_size, input_size, output_size,
+     * num_layers, skip, optional sample_rate) and "state_dict" with the
+     * rec.weight_ih_l0 / rec.weight_hh_l0 / rec.bias_ih_l0 / rec.bias_hh_l0 /
+     * lin.weight / lin.bias tensors.
+     * @throws std::runtime_error if the JSON is malformed or unsupported
+     */
+    [[nodiscard]] static Weights parseJson(const juce::String& json);
+
+    /**
+     * @brief Process a block in place (real-time safe)
+     */
+    virtual void process(float* data, int numSamples) noexcept = 0;
+
+    /**
+     * @brief Clear the hidden (and cell) state
+     */
+    virtual void reset() noexcept = 0;
+
+    [[nodiscard]] virtual CellType getCellType() const noexcept = 0;
+    [[nodiscard]] virtual int getHiddenSize() const noexcept = 0;
+
+    /**
+     * @brief Number of gates per hidden unit for a cell type
+     */
+    [[nodiscard]] static constexpr int getNumGates(CellType cellType) noexcept {
+        return cellType == CellType::Lstm ? 4 : 3;
+    }
+};
+
+} // namespace finirig::amps
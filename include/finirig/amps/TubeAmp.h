@@ -0,0 +1,131 @@
+#pragma once
+
+#include "finirig/amps/AmpModel.h"
+#include "finirig/audio/BlockProcessor.h"
+#include "finirig/audio/Parameter.h"
+#include "finirig/dsp/LookupTable.h"
+#include "finirig/dsp/Oversampler.h"
+#include <array>
+
+namespace finirig::amps {
+
+/**
+ * @brief Three-stage tube preamp, tone stack and push-pull power amp
+ *
+ * Signal path, all at OVERSAMPLING_FACTOR times the host rate:
+ * input gain -> three inverting triode stages, each followed by a coupling
+ * high-pass and (between stages) a Miller low-pass -> bass/middle/treble
+ * tone stack -> power amp with supply sag -> master volume.
+ *
+ * The triode and power amp curves are sampled once into shared
+ * LookupTables, so the audio path has no exp/tanh calls. Stages run one
+ * after another over a whole oversampled slice, which keeps each loop
+ * short and cache friendly.
+ *
+ * Setters may be called from any thread; parameters are smoothed every
+ * PARAMETER_UPDATE_INTERVAL host samples and filter coefficients are only
+ * recomputed while a tone knob is moving.
+ */
+class TubeAmp : public finirig::audio::BlockProcessor<AmpModel> {
+public:
+    static constexpr int OVERSAMPLING_FACTOR = 4;
+    static constexpr int NUM_PREAMP_STAGES = 3;
+
+    // Host-rate samples between smoothing steps / coefficient updates; also
+    // the largest slice pushed through the oversampler at once
+    static constexpr int PARAMETER_UPDATE_INTERVAL = 32;
+
+    TubeAmp();
+    ~TubeAmp() override = default;
+
+    void setGain(float gain) noexcept override;
+    [[nodiscard]] float getGain() const noexcept override { return gain_.getValue(); }
+
+    void setMasterVolume(float volume) noexcept override;
+    [[nodiscard]] float getMasterVolume() const noexcept override { return master_.getValue(); }
+
+    /**
+     * @brief Tone stack controls (0.0 to 1.0, 0.5 = flat)
+     */
+    void setBass(float bass) noexcept;
+    void setMiddle(float middle) noexcept;
+    void setTreble(float treble) noexcept;
+    [[nodiscard]] float getBass() const noexcept { return bass_.getValue(); }
+    [[nodiscard]] float getMiddle() const noexcept { return middle_.getValue(); }
+    [[nodiscard]] float getTreble() const noexcept { return treble_.getValue(); }
+
+    /**
+     * @brief Power supply sag (0.0 = stiff, 1.0 = spongy)
+     */
+    void setSag(float sag) noexcept;
+    [[nodiscard]] float getSag() const noexcept { return sag_.getValue(); }
+
+    void processChannels(
+        float* const* channelData,
+        int numChannels,
+        int numSamples
+    ) noexcept override;
+
+    void prepare(double sampleRate) override;
+    void reset() override;
+    [[nodiscard]] int getLatencySamples() const noexcept override;
+    [[nodiscard]] juce::String getName() const override { return "Tube Amp"; }
+
+private:
+    using Parameter = finirig::audio::Parameter;
+
+    // Transposed direct form II biquad
+    struct Biquad {
+        float b0 = 1.0f, b1 = 0.0f, b2 = 0.0f, a1 = 0.0f, a2 = 0.0f;
+        float z1 = 0.0f, z2 = 0.0f;
+
+        void process(float* data, int numSamples) noexcept;
+        void reset() noexcept { z1 = z2 = 0.0f; }
+    };
+
+    // One-pole filter; high-pass output when highpass is set
+    struct OnePole {
+        float coeff = 0.0f;
+        float state = 0.0f;
+        bool highpass = false;
+
+        void process(float* data, int numSamples) noexcept;
+        void reset() noexcept { state = 0.0f; }
+    };
+
+    Parameter gain_{0.5f, 0.0f, 1.0f, Parameter::Smoothing::Exponential};
+    Parameter bass_{0.5f, 0.0f, 1.0f, Parameter::Smoothing::Linear};
+    Parameter middle_{0.5f, 0.0f, 1.0f, Parameter::Smoothing::Linear};
+    Parameter treble_{0.5f, 0.0f, 1.0f, Parameter::Smoothing::Linear};
+    Parameter master_{0.5f, 0.0f, 1.0f, Parameter::Smoothing::Exponential};
+    Parameter sag_{0.5f, 0.0f, 1.0f, Parameter::Smoothing::Linear};
+    int samplesUntilUpdate_ = 0;
+
+    finirig::dsp::Oversampler oversampler_;
+    double oversampledRate_ = 44100.0 * OVERSAMPLING_FACTOR;
+
+    const finirig::dsp::LookupTable& triode_;
+    const finirig::dsp::LookupTable& powerAmp_;
+
+    // Audio thread state, derived from the parameters in updateParameters()
+    float inputGain_ = 1.0f;
+    float powerDrive_ = 1.0f;
+    float outputGain_ = 1.0f;
+    float sagDepth_ = 0.0f;
+
+    std::array<OnePole, NUM_PREAMP_STAGES> couplings_{};
+    std::array<OnePole, NUM_PREAMP_STAGES - 1> millers_{};
+    std::array<Biquad, 3> toneStack_{}; // bass shelf, middle peak, treble shelf
+
+    float sagEnvelope_ = 0.0f;
+    float sagAttack_ = 0.0f;
+    float sagRelease_ = 0.0f;
+
+    void updateParameters() noexcept;
+    void updateGains() noexcept;
+    void updateToneStack() noexcept;
+    void processSlice(float* data, int numSamples) noexcept;
+    void processPowerAmp(float* data, int numSamples) noexcept;
+};
+
+} // namespace finirig::amps
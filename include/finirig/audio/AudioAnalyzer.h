@@ -0,0 +1,91 @@
+#pragma once
+
+#include "finirig/audio/AudioTap.h"
+#include "finirig/dsp/PitchDetector.h"
+#include "finirig/dsp/SpectrumAnalyzer.h"
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace finirig::audio {
+
+/**
+ * @brief Background spectrum and tuner analysis of an AudioTap
+ *
+ * A normal-priority thread wakes every POLL_INTERVAL, drains the tap and
+ * runs the spectrum analyser and pitch detector over the new samples,
+ * then publishes the results under a mutex that only it and the UI take.
+ * The audio thread never does more than the tap's copy, so analysis adds
+ * nothing to the DSP load and the rig keeps playing while tuning.
+ *
+ * start() and stop() may be called from any non-audio thread (the UI and
+ * the device thread both do); they are serialised against each other.
+ */
+class AudioAnalyzer {
+public:
+    /**
+     * @brief Latest analysis, copied out for the UI
+     */
+    struct Results {
+        std::vector<float> spectrumDb;  // averaged magnitude per bin, DC to Nyquist
+        double binWidthHz = 0.0;
+        dsp::PitchDetector::Result pitch;
+        std::uint64_t droppedSamples = 0;  // tap overflows since construction
+    };
+
+    explicit AudioAnalyzer(AudioTap& tap);
+    ~AudioAnalyzer();
+
+    // Non-copyable
+    AudioAnalyzer(const AudioAnalyzer&) = delete;
+    AudioAnalyzer& operator=(const AudioAnalyzer&) = delete;
+
+    /**
+     * @brief (Re)start analysis at a sample rate (not real-time safe)
+     *
+     * Samples already waiting in the tap are discarded and the averages
+     * start from scratch.
+     */
+    void start(double sampleRate);
+
+    /**
+     * @brief Stop and join the analysis thread (not real-time safe)
+     */
+    void stop();
+
+    [[nodiscard]] bool isRunning() const;
+
+    /**
+     * @brief Copy of the latest results (UI thread)
+     */
+    [[nodiscard]] Results getResults() const;
+
+private:
+    static constexpr std::size_t PULL_SIZE = 4096;
+
+    // lifecycleMutex_ held
+    void stopThread();
+
+    void run();
+
+    AudioTap& tap_;
+
+    // Taken by start() and stop() for their whole run; guards thread_
+    mutable std::mutex lifecycleMutex_;
+
+    // Analysis thread only while running
+    dsp::SpectrumAnalyzer spectrum_;
+    dsp::PitchDetector pitch_;
+    std::vector<float> scratch_;
+    double sampleRate_ = 0.0;
+
+    mutable std::mutex mutex_;
+    std::condition_variable condition_;
+    bool shouldExit_ = false;
+    Results results_;
+    std::thread thread_;
+};
+
+} // namespace finirig::audio
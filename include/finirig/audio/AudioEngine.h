@@ -2,7 +2,18 @@
 
 #include <juce_audio_devices/juce_audio_devices.h>
 #include <juce_audio_utils/juce_audio_utils.h>
+#include "finirig/audio/AudioAnalyzer.h"
+#include "finirig/audio/AudioPipeline.h"
+#include "finirig/audio/AudioTap.h"
+#include "finirig/audio/CallbackLoadMonitor.h"
+#include "finirig/audio/DeviceCatalogue.h"
+#include "finirig/audio/LevelMeter.h"
+#include "finirig/audio/RealtimeEpoch.h"
+#include "finirig/audio/ReleasePool.h"
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 
 namespace finirig::audio {
 
@@ -14,8 +25,16 @@ class AudioProcessor;
  * Real-time safe audio engine that handles device management
  * and routes audio through the processing chain.
  */
-class AudioEngine : public juce::AudioIODeviceCallback {
+class AudioEngine : public juce::AudioIODeviceCallback, private AudioPipeline::Stage {
 public:
+    /**
+     * @brief Where the processor runs relative to the device callback
+     */
+    enum class ProcessingMode {
+        Direct,    ///< Inside the callback; no added latency
+        Pipelined  ///< One block ahead on a pipeline thread; one block of added latency
+    };
+
     explicit AudioEngine();
     ~AudioEngine() override;
 
@@ -25,6 +44,13 @@ public:
 
     /**
      * @brief Initialize audio engine with specified sample rate and buffer size
+     *
+     * The first call opens the default devices directly at this format and
+     * queues the first device catalogue scan once the device is set up, or
+     * once opening it has failed. Opening a device can take a long time,
+     * so this may run on a worker thread; the engine must not be used from
+     * any other thread until it returns.
+     *
      * @param sampleRate Target sample rate (e.g., 44100, 48000)
      * @param bufferSize Buffer size in samples
      * @return true if initialization successful
@@ -42,30 +68,106 @@ public:
      */
     void stop();
 
+    [[nodiscard]] bool isRunning() const noexcept { return isRunning_; }
+
     /**
      * @brief Get current sample rate
      */
-    [[nodiscard]] double getSampleRate() const noexcept { return sampleRate_; }
+    [[nodiscard]] double getSampleRate() const noexcept { return sampleRate_.load(std::memory_order_relaxed); }
 
     /**
      * @brief Get current buffer size
      */
-    [[nodiscard]] int getBufferSize() const noexcept { return bufferSize_; }
+    [[nodiscard]] int getBufferSize() const noexcept { return bufferSize_.load(std::memory_order_relaxed); }
 
     /**
      * @brief Set the audio processor for the processing chain
+     *
+     * The processor is prepared on the calling thread and published to the
+     * audio thread with a single atomic store, so it can be swapped while
+     * audio is running. The previous processor is destroyed later on a
+     * background thread once the audio callback can no longer reference it.
+     * A device restart at the same time waits for the swap and then
+     * prepares the new processor at the new rate.
+     * Not real-time safe; call from the UI or a worker thread.
      */
     void setProcessor(std::unique_ptr<AudioProcessor> processor);
 
+    /**
+     * @brief Select direct or pipelined processing (not real-time safe)
+     *
+     * Pipelined mode gives heavy presets a whole buffer period of compute
+     * per block in exchange for one buffer of fixed latency. If audio is
+     * running, the callback is detached and re-attached to switch, which
+     * causes a short dropout.
+     */
+    void setProcessingMode(ProcessingMode mode);
+
+    [[nodiscard]] ProcessingMode getProcessingMode() const noexcept { return processingMode_; }
+
+    /**
+     * @brief Latency added by pipelined mode, in samples (0 in direct mode)
+     */
+    [[nodiscard]] int getPipelineLatencySamples() const noexcept { return pipeline_.getLatencySamples(); }
+
+    /**
+     * @brief Blocks the pipeline did not finish in time since the device started
+     */
+    [[nodiscard]] std::uint64_t getPipelineUnderrunCount() const noexcept { return pipeline_.getUnderrunCount(); }
+
+    /**
+     * @brief Choose what the spectrum analyser and tuner listen to
+     *
+     * Anything but Off makes the callback copy that signal into the audio
+     * tap and runs the AudioAnalyzer thread while the device runs; the
+     * analysis itself never happens on the audio thread. Switching source
+     * restarts the averages.
+     */
+    void setAnalysisSource(AudioTap::Point point);
+
+    [[nodiscard]] AudioTap::Point getAnalysisSource() const noexcept { return audioTap_.getPoint(); }
+
+    /**
+     * @brief Latest spectrum and pitch (UI thread)
+     */
+    [[nodiscard]] AudioAnalyzer::Results getAnalysisResults() const { return analyzer_.getResults(); }
+
+    /**
+     * @brief Get latency added by the processor and the pipeline, in samples
+     *
+     * Call from the thread that calls setProcessor(); the processor can only
+     * be retired from there, so it stays valid for the duration of the call.
+     */
+    [[nodiscard]] int getProcessingLatencySamples() const noexcept;
+
+    /**
+     * @brief Get input + output device latency plus processing latency, in samples
+     */
+    [[nodiscard]] int getTotalLatencySamples() const;
+
     /**
      * @brief Get list of available input devices
+     *
+     * Served from the device catalogue's last scan, so it never blocks;
+     * empty until the first background scan has finished.
      */
-    [[nodiscard]] juce::StringArray getInputDeviceNames();
+    [[nodiscard]] juce::StringArray getInputDeviceNames() const;
 
     /**
      * @brief Get list of available output devices
+     *
+     * Served from the device catalogue's last scan, so it never blocks;
+     * empty until the first background scan has finished.
      */
-    [[nodiscard]] juce::StringArray getOutputDeviceNames();
+    [[nodiscard]] juce::StringArray getOutputDeviceNames() const;
+
+    /**
+     * @brief Background device scanner behind the device name lists
+     *
+     * Request a rescan or subscribe to changes here. The first full scan
+     * is queued when the first initialize() is done with the device.
+     */
+    [[nodiscard]] DeviceCatalogue& getDeviceCatalogue() noexcept { return deviceCatalogue_; }
 
     /**
      * @brief Get current input device name
@@ -88,14 +190,33 @@ public:
     bool setOutputDevice(const juce::String& deviceName);
 
     /**
-     * @brief Get current input level (peak, 0.0 to 1.0)
+     * @brief Input meter, one frame per callback (drain from the UI thread)
+     *
+     * Measured before processing, on the first input channel.
+     */
+    [[nodiscard]] LevelMeter& getInputMeter() noexcept { return inputMeter_; }
+
+    /**
+     * @brief Output meter, one frame per callback (drain from the UI thread)
+     *
+     * Measured on every processed output channel.
+     */
+    [[nodiscard]] LevelMeter& getOutputMeter() noexcept { return outputMeter_; }
+
+    /**
+     * @brief Get DSP load statistics (fraction of each buffer period spent processing)
+     *
+     * Measured on the device callback in direct mode and on the pipeline
+     * thread's processing in pipelined mode.
      */
-    [[nodiscard]] float getInputLevel() const noexcept { return inputLevel_; }
+    [[nodiscard]] CallbackLoadMonitor::Snapshot getLoadStatistics() const noexcept {
+        return loadMonitor_.getSnapshot();
+    }
 
     /**
-     * @brief Get current output level (peak, 0.0 to 1.0)
+     * @brief Clear DSP load statistics (applied by the audio thread)
      */
-    [[nodiscard]] float getOutputLevel() const noexcept { return outputLevel_; }
+    void resetLoadStatistics() noexcept { loadMonitor_.requestReset(); }
 
     /**
      * @brief Get device information as string
@@ -117,23 +238,51 @@ public:
     void audioDeviceError(const juce::String& errorMessage) override;
 
 private:
-    void updateLevels(
-        const float* const* inputChannelData,
-        int numInputChannels,
-        const float* const* outputChannelData,
-        int numOutputChannels,
-        int numSamples
-    ) noexcept;
+    // Runs the current processor over channel 0, at its channel layout,
+    // and fills every channel; inside callbackEpoch_
+    void processOutput(float* const* channelData, int numChannels, int numSamples) noexcept;
+
+    // AudioPipeline::Stage (pipeline thread)
+    void processPipelineBlock(float* const* channelData, int numChannels, int numSamples) noexcept override;
 
     juce::AudioDeviceManager deviceManager_;
-    std::unique_ptr<AudioProcessor> processor_;
-    double sampleRate_ = 44100.0;
-    int bufferSize_ = 512;
+    DeviceCatalogue deviceCatalogue_;
+
+    // Owned processor, published to the audio thread. Ownership moves in and
+    // out through setProcessor() and the release pool; the audio thread only
+    // ever reads it between callbackEpoch_ enter/exit. In pipelined mode the
+    // pipeline thread is that reader instead of the callback; the pipeline
+    // only starts and stops while no callback runs, so there is never more
+    // than one.
+    std::atomic<AudioProcessor*> processor_{nullptr};
+    RealtimeEpoch callbackEpoch_;
+    ReleasePool releasePool_{callbackEpoch_};
+
+    // Device format, written on the control and device threads and read
+    // everywhere. Rate changes and processor preparation are serialised by
+    // prepareMutex_ (never taken on the audio thread).
+    std::atomic<double> sampleRate_{44100.0};
+    std::atomic<int> bufferSize_{512};
+    std::mutex prepareMutex_;
     bool isRunning_ = false;
+
+    // Mode is set on the control thread; pipelined_ is what the callback
+    // follows and only changes while no callback runs
+    ProcessingMode processingMode_ = ProcessingMode::Direct;
+    bool pipelined_ = false;
+    AudioPipeline pipeline_{*this};
     
-    // Level monitoring (updated in audio callback, read from UI thread)
-    mutable std::atomic<float> inputLevel_{0.0f};
-    mutable std::atomic<float> outputLevel_{0.0f};
+    // Level monitoring (pushed by the audio callback, drained by the UI)
+    LevelMeter inputMeter_;
+    LevelMeter outputMeter_;
+
+    // Analysis feed (pushed by the audio callback, drained by analyzer_)
+    AudioTap audioTap_;
+    AudioAnalyzer analyzer_{audioTap_};
+
+    // DSP load (updated by the audio callback, or the pipeline thread when
+    // pipelined; read from the UI thread)
+    CallbackLoadMonitor loadMonitor_;
 };
 
 } // namespace finirig::audio
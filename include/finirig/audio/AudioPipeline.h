@@ -0,0 +1,132 @@
+#pragma once
+
+#include "finirig/audio/SpscRingBuffer.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace finirig::audio {
+
+/**
+ * @brief Two-stage pipeline that runs processing one block behind the device
+ *
+ * The device callback only exchanges samples: it pushes its input into one
+ * SPSC ring, wakes the pipeline thread and pops the block processed during
+ * the previous period from another. The pipeline thread (realtime priority
+ * where the OS allows it) processes each block while the device plays the
+ * one before, so processing gets a whole period instead of the fraction
+ * the callback leaves over, at the cost of one block of fixed latency.
+ *
+ * If a block is not ready in time the callback plays silence and counts an
+ * underrun; the late block is skipped when it arrives so the latency stays
+ * fixed. If the output rings fill up, the pipeline thread waits for the
+ * callback to make room rather than dropping a block. The input is mono;
+ * the output has up to MAX_CHANNELS channels so stereo stages keep their
+ * width.
+ */
+class AudioPipeline {
+public:
+    static constexpr int MAX_CHANNELS = 2;
+
+    /**
+     * @brief Processing run on the pipeline thread
+     */
+    class Stage {
+    public:
+        virtual ~Stage() = default;
+
+        /**
+         * @brief Process one block in place (pipeline thread)
+         *
+         * Channel 0 holds the input; every channel must hold output on return.
+         */
+        virtual void processPipelineBlock(float* const* channelData, int numChannels, int numSamples) noexcept = 0;
+    };
+
+    explicit AudioPipeline(Stage& stage);
+    ~AudioPipeline();
+
+    // Non-copyable
+    AudioPipeline(const AudioPipeline&) = delete;
+    AudioPipeline& operator=(const AudioPipeline&) = delete;
+
+    /**
+     * @brief Allocate the rings and start the pipeline thread (not real-time safe)
+     *
+     * Call while no callback is running, e.g. from audioDeviceAboutToStart().
+     * @param blockSize Device buffer size; also the added latency
+     * @param numChannels Output channels to carry (clamped to 1..MAX_CHANNELS)
+     * @throws std::invalid_argument if blockSize is not positive
+     */
+    void start(int blockSize, int numChannels = 1);
+
+    /**
+     * @brief Stop and join the pipeline thread (not real-time safe)
+     *
+     * Call while no callback is running. The stage is not used after this returns.
+     */
+    void stop();
+
+    [[nodiscard]] bool isRunning() const noexcept { return thread_.joinable(); }
+
+    /**
+     * @brief Exchange one block with the pipeline (device callback)
+     *
+     * The outputs receive audio that went in one block earlier; the input
+     * may alias the first output. Outputs beyond the channels given to
+     * start() get a copy of the last one carried.
+     */
+    void process(const float* input, float* const* outputs, int numOutputs, int numSamples) noexcept;
+
+    /**
+     * @brief Latency added by the pipeline, in samples (0 when stopped)
+     */
+    [[nodiscard]] int getLatencySamples() const noexcept {
+        return latencySamples_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Blocks that were not processed in time since start()
+     */
+    [[nodiscard]] std::uint64_t getUnderrunCount() const noexcept {
+        return underruns_.load(std::memory_order_relaxed);
+    }
+
+private:
+    // Ring room in blocks, so a late pipeline thread can catch up
+    static constexpr int RING_BLOCKS = 8;
+
+    void threadLoop() noexcept;
+
+    // Block until every output ring has room for count samples; false if
+    // the pipeline is stopping (pipeline thread)
+    [[nodiscard]] bool waitForSpace(std::size_t count) noexcept;
+
+    // Wake a pipeline thread waiting in waitForSpace()
+    void notifySpace() noexcept;
+
+    Stage& stage_;
+
+    std::unique_ptr<SpscRingBuffer<float>> inputRing_;
+    std::array<std::unique_ptr<SpscRingBuffer<float>>, MAX_CHANNELS> outputRings_;
+    int numChannels_ = 1;
+
+    // Pipeline thread only
+    std::array<std::vector<float>, MAX_CHANNELS> scratch_;
+    std::array<float*, MAX_CHANNELS> scratchChannels_{};
+    std::thread thread_;
+
+    alignas(64) std::atomic<std::uint32_t> blocksPushed_{0};
+    alignas(64) std::atomic<std::uint32_t> blocksPopped_{0};
+    std::atomic<bool> stopping_{false};
+
+    // Callback side
+    std::size_t samplesToSkip_ = 0;
+    std::atomic<int> latencySamples_{0};
+    std::atomic<std::uint64_t> underruns_{0};
+};
+
+} // namespace finirig::audio
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <juce_audio_basics/juce_audio_basics.h>
+#include "finirig/audio/ProcessorStats.h"
+#include <atomic>
 
 namespace finirig::audio {
 
@@ -9,23 +11,44 @@ namespace finirig::audio {
  * 
  * Provides interface for real-time audio processing.
  * All implementations must be real-time safe.
+ *
+ * Channel contract for processChannels(): on entry every channel holds
+ * the input (a mono signal arrives copied to each channel), on return
+ * every channel holds the output. getChannelLayout() tells callers how
+ * much of that they can skip: a Mono processor only reads channel 0 and
+ * writes the same output everywhere, so callers run it on one channel and
+ * fan out later, only where a Stereo processor needs two.
  */
 class AudioProcessor {
 public:
+    /**
+     * @brief Channels a processor produces distinct output on
+     */
+    enum class ChannelLayout {
+        Mono,  ///< Reads channel 0, output identical on every channel
+        Stereo ///< Left and right differ (reverb, stereo delay, dual cabinet)
+    };
+
     virtual ~AudioProcessor() = default;
 
     /**
      * @brief Process a single audio sample
      * @param input Input sample value
      * @return Processed output sample
+     *
+     * Processors that only implement the block path derive from
+     * BlockProcessor, which supplies this.
      */
     [[nodiscard]] virtual float processSample(float input) noexcept = 0;
 
     /**
-     * @brief Process an audio buffer
+     * @brief Process an interleaved audio buffer
      * @param buffer Audio buffer to process (in-place)
      * @param numChannels Number of channels
      * @param numSamples Number of samples per channel
+     *
+     * Mono only: the first channel is processed and written to every
+     * channel. Kept for interleaved callers; the engine uses processChannels().
      */
     virtual void processBlock(
         float* buffer,
@@ -33,6 +56,32 @@ public:
         int numSamples
     ) noexcept;
 
+    /**
+     * @brief Process a block of non-interleaved audio in place
+     * @param channelData Per-channel sample pointers
+     * @param numChannels Number of channels
+     * @param numSamples Number of samples per channel
+     *
+     * The default implementation runs processSample() over the first
+     * channel and copies the result to the remaining channels (Mono
+     * layout). Processors should override this so the engine pays one
+     * virtual call per callback instead of one per sample.
+     */
+    virtual void processChannels(
+        float* const* channelData,
+        int numChannels,
+        int numSamples
+    ) noexcept;
+
+    /**
+     * @brief Output layout (queried on the audio thread every block)
+     *
+     * Containers report Stereo if any stage they hold is. Stereo
+     * processors must also accept a single channel and then write a mono
+     * version of their output.
+     */
+    [[nodiscard]] virtual ChannelLayout getChannelLayout() const noexcept { return ChannelLayout::Mono; }
+
     /**
      * @brief Prepare processor for new sample rate
      * @param sampleRate New sample rate
@@ -43,6 +92,58 @@ public:
      * @brief Reset processor state
      */
     virtual void reset() {}
+
+    /**
+     * @brief Get processing latency in samples at the prepared rate
+     *
+     * Reported so the engine and renderer can compensate for delay added
+     * by oversampling or lookahead. Call from the control thread.
+     *
+     * Containers cache the total of their stages and recompute it when
+     * they prepare them, so prepare a stage through its container. A
+     * processor whose latency changes any other way (a nested container
+     * edited in place) calls notifyLatencyChanged().
+     */
+    [[nodiscard]] virtual int getLatencySamples() const noexcept { return 0; }
+
+    /**
+     * @brief Get display name (used by diagnostics)
+     */
+    [[nodiscard]] virtual juce::String getName() const { return "Processor"; }
+
+    /**
+     * @brief Get timing counters for this stage
+     *
+     * Filled in by whatever drives the processor on the audio thread
+     * (AudioEngine for the top-level processor, SignalChain for its stages).
+     */
+    [[nodiscard]] ProcessorStats& getStats() noexcept { return stats_; }
+    [[nodiscard]] const ProcessorStats& getStats() const noexcept { return stats_; }
+
+protected:
+    /**
+     * @brief Tell the container holding this processor that its latency changed
+     *
+     * Call on the control thread without holding any lock that the
+     * container's prepare() path takes. Does nothing outside a container.
+     */
+    void notifyLatencyChanged();
+
+    /**
+     * @brief A stage's latency changed (containers recompute their cache here)
+     */
+    virtual void stageLatencyChanged() {}
+
+    /**
+     * @brief Set or clear the container notified by @p stage (containers only)
+     */
+    static void setLatencyParent(AudioProcessor& stage, AudioProcessor* parent) noexcept {
+        stage.latencyParent_.store(parent, std::memory_order_release);
+    }
+
+private:
+    ProcessorStats stats_;
+    std::atomic<AudioProcessor*> latencyParent_{nullptr};
 };
 
 } // namespace finirig::audio
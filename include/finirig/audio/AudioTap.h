@@ -0,0 +1,81 @@
+#pragma once
+
+#include "finirig/audio/SpscRingBuffer.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace finirig::audio {
+
+/**
+ * @brief Wait-free copy of the engine's input or output for analysis
+ *
+ * The device callback pushes each mono block into a lock-free SPSC FIFO;
+ * one non-realtime reader (the AudioAnalyzer thread) pulls the samples
+ * and does the actual work. The callback only ever copies: when the
+ * reader falls a whole FIFO behind, blocks are dropped and counted.
+ */
+class AudioTap {
+public:
+    /**
+     * @brief Where the callback copies from
+     */
+    enum class Point {
+        Off,    // Nothing is copied
+        Input,  // Dry input, before processing (tuner)
+        Output  // First output channel, after processing
+    };
+
+    // About 1.4 s at 48 kHz, so the reader can sleep between passes
+    static constexpr std::size_t DEFAULT_CAPACITY_SAMPLES = 1 << 16;
+
+    /**
+     * @brief Allocate the FIFO (not real-time safe)
+     * @param capacitySamples Samples buffered for the reader; rounded up to a power of two
+     * @throws std::invalid_argument if capacitySamples is zero
+     */
+    explicit AudioTap(std::size_t capacitySamples = DEFAULT_CAPACITY_SAMPLES);
+
+    // Non-copyable
+    AudioTap(const AudioTap&) = delete;
+    AudioTap& operator=(const AudioTap&) = delete;
+
+    /**
+     * @brief Choose the tap point (any thread; the callback follows on its next block)
+     */
+    void setPoint(Point point) noexcept { point_.store(point, std::memory_order_relaxed); }
+
+    [[nodiscard]] Point getPoint() const noexcept { return point_.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Copy one block into the FIFO (producer thread)
+     *
+     * All or nothing: a block that does not fit is dropped and counted.
+     */
+    void push(const float* samples, int numSamples) noexcept;
+
+    /**
+     * @brief Take up to maxSamples of the oldest samples (consumer thread)
+     * @return Number of samples copied
+     */
+    std::size_t pull(float* samples, std::size_t maxSamples) noexcept;
+
+    /**
+     * @brief Drop everything waiting, e.g. before a fresh analysis (consumer thread)
+     */
+    void discardPending() noexcept;
+
+    /**
+     * @brief Samples dropped because the FIFO was full
+     */
+    [[nodiscard]] std::uint64_t getDroppedSampleCount() const noexcept {
+        return droppedSamples_.load(std::memory_order_relaxed);
+    }
+
+private:
+    SpscRingBuffer<float> fifo_;
+    std::atomic<Point> point_{Point::Off};
+    std::atomic<std::uint64_t> droppedSamples_{0};
+};
+
+} // namespace finirig::audio
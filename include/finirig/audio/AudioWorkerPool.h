@@ -0,0 +1,102 @@
+#pragma once
+
+#include "finirig/audio/WorkStealingQueue.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace finirig::audio {
+
+/**
+ * @brief Worker threads that help the audio thread run a batch of tasks
+ *
+ * run() is called from the audio callback with a Job whose tasks form a
+ * dependency graph. The audio thread takes part as worker 0 and returns
+ * once every task has run, so the callback still finishes in one pass;
+ * the pool only lets independent tasks run on other cores meanwhile.
+ *
+ * Each participant owns a WorkStealingQueue: tasks a participant makes
+ * ready go to its own queue, and idle participants steal from the others.
+ * Between jobs the workers spin for SPIN_ITERATIONS, so back-to-back
+ * sub-blocks within a callback wake them without a syscall, then sleep
+ * on an atomic wait until the next job. Nothing here locks or allocates
+ * after construction.
+ *
+ * Worker threads ask for realtime scheduling; if the OS refuses they run
+ * at normal priority.
+ */
+class AudioWorkerPool {
+public:
+    static constexpr int MAX_WORKERS = 8;
+    static constexpr int MAX_TASKS = 64;
+    static constexpr int SPIN_ITERATIONS = 2000;
+
+    /**
+     * @brief A batch of tasks run by run()
+     */
+    class Job {
+    public:
+        virtual ~Job() = default;
+
+        /**
+         * @brief Run one task (any participating thread)
+         * @param task Task index
+         * @param readyTasks Receives tasks that became runnable because this one finished
+         * @return Number of entries written to readyTasks
+         */
+        virtual int runTask(int task, int* readyTasks) noexcept = 0;
+    };
+
+    /**
+     * @brief Start the workers
+     * @param numWorkers Threads besides the audio thread (0 runs everything inline)
+     * @throws std::invalid_argument if numWorkers is negative or above MAX_WORKERS
+     */
+    explicit AudioWorkerPool(int numWorkers);
+    ~AudioWorkerPool();
+
+    // Non-copyable
+    AudioWorkerPool(const AudioWorkerPool&) = delete;
+    AudioWorkerPool& operator=(const AudioWorkerPool&) = delete;
+
+    /**
+     * @brief Run a job to completion (audio thread; one job at a time)
+     * @param job Tasks to run
+     * @param initialTasks Tasks runnable at the start
+     * @param numInitialTasks Number of initial tasks
+     * @param numTasks Total number of tasks the job will run (at most MAX_TASKS)
+     */
+    void run(Job& job, const int* initialTasks, int numInitialTasks, int numTasks) noexcept;
+
+    [[nodiscard]] int getNumWorkers() const noexcept { return static_cast<int>(threads_.size()); }
+
+    /**
+     * @brief Default worker count: one fewer than the cores, capped at 3
+     */
+    [[nodiscard]] static int getDefaultWorkerCount() noexcept;
+
+    /**
+     * @brief Pause briefly inside a spin loop
+     */
+    static void pause() noexcept;
+
+private:
+    using TaskQueue = WorkStealingQueue<int, MAX_TASKS>;
+
+    std::array<TaskQueue, MAX_WORKERS + 1> queues_; // [0] is the audio thread
+    std::vector<std::thread> threads_;
+
+    std::atomic<Job*> job_{nullptr};
+    alignas(64) std::atomic<int> remainingTasks_{0};
+    alignas(64) std::atomic<std::uint32_t> generation_{0};
+    std::atomic<bool> stopping_{false};
+
+    void workerLoop(int index) noexcept;
+    void participate(int index) noexcept;
+    bool findTask(int index, int& task) noexcept;
+};
+
+} // namespace finirig::audio
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "finirig/audio/AudioProcessor.h"
+
+namespace finirig::audio {
+
+/**
+ * @brief Base for processors that only implement the block path
+ *
+ * processSample() runs processChannels() on a one-sample, one-channel
+ * block. processChannels() stays pure here, so a subclass that forgets it
+ * fails to compile instead of recursing on the audio thread.
+ *
+ * Base is AudioProcessor or an interface derived from it, such as
+ * amps::AmpModel.
+ */
+template <typename Base = AudioProcessor>
+class BlockProcessor : public Base {
+public:
+    [[nodiscard]] float processSample(float input) noexcept override {
+        float sample = input;
+        float* channels[] = {&sample};
+        processChannels(channels, 1, 1);
+        return sample;
+    }
+
+    void processChannels(
+        float* const* channelData,
+        int numChannels,
+        int numSamples
+    ) noexcept override = 0;
+};
+
+} // namespace finirig::audio
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace finirig::audio {
+
+/**
+ * @brief DSP load statistics for the audio callback
+ *
+ * The audio thread records how long each callback took relative to the
+ * buffer period; the UI thread reads a snapshot. Recording is wait-free
+ * (relaxed atomics, single writer) and reset requests are applied by the
+ * audio thread itself so the two sides never write the same counter.
+ */
+class CallbackLoadMonitor {
+public:
+    /// Histogram bins of 5% load each; the last bin collects overruns (>= 100%)
+    static constexpr int NUM_BINS = 21;
+    static constexpr float BIN_WIDTH = 0.05f;
+
+    /**
+     * @brief Point-in-time copy of the statistics
+     */
+    struct Snapshot {
+        std::array<std::uint64_t, NUM_BINS> histogram{};
+        std::uint64_t numCallbacks = 0;
+        std::uint64_t numOverruns = 0;
+        float currentLoad = 0.0f; ///< Load of the most recent callback (1.0 = full period)
+        float averageLoad = 0.0f; ///< Exponentially smoothed load
+        float maxLoad = 0.0f;     ///< Highest load since the last reset
+    };
+
+    CallbackLoadMonitor() = default;
+
+    // Non-copyable
+    CallbackLoadMonitor(const CallbackLoadMonitor&) = delete;
+    CallbackLoadMonitor& operator=(const CallbackLoadMonitor&) = delete;
+
+    /**
+     * @brief Record one callback (audio thread only)
+     * @param elapsedSeconds Time spent in the callback
+     * @param periodSeconds Duration of the buffer it processed
+     */
+    void recordCallback(double elapsedSeconds, double periodSeconds) noexcept;
+
+    /**
+     * @brief Read the current statistics (any thread)
+     */
+    [[nodiscard]] Snapshot getSnapshot() const noexcept;
+
+    /**
+     * @brief Ask the audio thread to clear the statistics on its next callback
+     */
+    void requestReset() noexcept { resetRequested_.store(true, std::memory_order_relaxed); }
+
+private:
+    void clear() noexcept;
+
+    std::array<std::atomic<std::uint64_t>, NUM_BINS> histogram_{};
+    std::atomic<std::uint64_t> numCallbacks_{0};
+    std::atomic<std::uint64_t> numOverruns_{0};
+    std::atomic<float> currentLoad_{0.0f};
+    std::atomic<float> averageLoad_{0.0f};
+    std::atomic<float> maxLoad_{0.0f};
+    std::atomic<bool> resetRequested_{false};
+};
+
+} // namespace finirig::audio
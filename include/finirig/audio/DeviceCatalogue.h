@@ -0,0 +1,148 @@
+#pragma once
+
+#include <juce_audio_devices/juce_audio_devices.h>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace finirig::audio {
+
+/**
+ * @brief Cached list of audio devices, scanned on a background thread
+ *
+ * Scanning a device type can take hundreds of milliseconds (ASIO and
+ * WASAPI probe every endpoint, ALSA opens every card), so the catalogue
+ * owns a thread that does all scanning and keeps the result. Readers get
+ * a copy of the last snapshot and never wait for a scan.
+ *
+ * Rescans are requested for all types or for one type; requests made
+ * while a scan runs are merged into the next pass. Device types that
+ * report hot-plug changes trigger a rescan of just that type. The change
+ * callback runs on the catalogue thread, and only when a scan actually
+ * changed the lists (or finished for the first time).
+ */
+class DeviceCatalogue {
+public:
+    /**
+     * @brief Devices of one type (e.g. "ALSA", "CoreAudio", "ASIO")
+     */
+    struct DeviceType {
+        juce::String typeName;
+        juce::StringArray inputDevices;
+        juce::StringArray outputDevices;
+    };
+
+    /**
+     * @brief Everything known after the last scan
+     */
+    struct Snapshot {
+        std::vector<DeviceType> types;
+        std::uint64_t generation = 0;  // bumped on every change
+        bool scanned = false;          // false until the first scan finishes
+
+        /**
+         * @brief Input devices as "Type: Device", in type order
+         */
+        [[nodiscard]] juce::StringArray getInputDeviceNames() const;
+
+        /**
+         * @brief Output devices as "Type: Device", in type order
+         */
+        [[nodiscard]] juce::StringArray getOutputDeviceNames() const;
+    };
+
+    /**
+     * @brief Source of device lists; scans run on the catalogue thread
+     */
+    class Scanner {
+    public:
+        virtual ~Scanner() = default;
+
+        [[nodiscard]] virtual int getNumTypes() = 0;
+        [[nodiscard]] virtual juce::String getTypeName(int typeIndex) = 0;
+
+        /**
+         * @brief Scan one type for devices (may block for a long time)
+         */
+        [[nodiscard]] virtual DeviceType scan(int typeIndex) = 0;
+
+        /**
+         * @brief Install the hook to call when a type's device list changes
+         *
+         * Called once, from the catalogue's constructor; the hook may be
+         * called from any thread. Scanners without hot-plug support
+         * ignore it.
+         */
+        virtual void setListChangedCallback(std::function<void(const juce::String& typeName)> callback) {
+            (void)callback;
+        }
+    };
+
+    using ChangeCallback = std::function<void()>;
+
+    /**
+     * @brief Start the catalogue thread (idle until the first rescan request)
+     * @param scanner Device source; null scans the platform's JUCE device types
+     */
+    explicit DeviceCatalogue(std::unique_ptr<Scanner> scanner = nullptr);
+    ~DeviceCatalogue();
+
+    // Non-copyable
+    DeviceCatalogue(const DeviceCatalogue&) = delete;
+    DeviceCatalogue& operator=(const DeviceCatalogue&) = delete;
+
+    /**
+     * @brief Set the function called on the catalogue thread after a change
+     *
+     * The callback must not block on the catalogue; UI code should post
+     * to its own thread (e.g. a queued signal) and read the snapshot there.
+     */
+    void setChangeCallback(ChangeCallback callback);
+
+    /**
+     * @brief Queue a rescan of every device type; returns immediately
+     */
+    void requestRescan();
+
+    /**
+     * @brief Queue a rescan of one device type; returns immediately
+     */
+    void requestRescan(const juce::String& typeName);
+
+    /**
+     * @brief Copy of the last scan result (never waits for a scan)
+     */
+    [[nodiscard]] Snapshot getSnapshot() const;
+
+    /**
+     * @brief Number of device types scanned since construction
+     */
+    [[nodiscard]] std::uint64_t getTypeScanCount() const;
+
+private:
+    void run();
+
+    // Scan what was requested and publish; catalogue thread only
+    void scan(bool allTypes, const std::vector<juce::String>& typeNames);
+
+    std::unique_ptr<Scanner> scanner_;
+
+    // Catalogue thread only
+    std::vector<DeviceType> types_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable condition_;
+    bool shouldExit_ = false;
+    bool rescanAll_ = false;
+    std::vector<juce::String> pendingTypes_;
+    ChangeCallback changeCallback_;
+    Snapshot snapshot_;
+    std::uint64_t typeScanCount_ = 0;
+    std::thread thread_;
+};
+
+} // namespace finirig::audio
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "finirig/audio/SpscRingBuffer.h"
+#include "finirig/dsp/SimdKernels.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace finirig::audio {
+
+/**
+ * @brief Per-block level measurements handed from the audio thread to the UI
+ *
+ * The audio thread measures every block it is given and pushes one Frame
+ * per block into a lock-free SPSC ring; the UI drains all of them, so no
+ * peak between two repaints is lost. If the UI falls behind by more than
+ * the ring holds, new frames are dropped and counted rather than blocking.
+ *
+ * Each channel gets its sample peak, RMS, true peak (4x oversampled with
+ * the ITU-R BS.1770-4 interpolator) and a clip flag. The reductions are
+ * vector passes: findMinAndMax for the peak, the SIMD dot product kernel
+ * for RMS and multiply-add passes for the interpolator.
+ */
+class LevelMeter {
+public:
+    static constexpr int MAX_CHANNELS = 2;
+
+    // Sample peak at or above this counts as clipped (digital full scale)
+    static constexpr float CLIP_LEVEL = 1.0f;
+
+    /**
+     * @brief Levels of one channel over one block (linear, not dB)
+     */
+    struct ChannelLevels {
+        float peak = 0.0f;
+        float rms = 0.0f;
+        float truePeak = 0.0f;
+        bool clipped = false;
+    };
+
+    /**
+     * @brief Levels of one block
+     */
+    struct Frame {
+        std::array<ChannelLevels, MAX_CHANNELS> channels{};
+        int numChannels = 0;
+        int numSamples = 0;
+
+        /**
+         * @brief Fold a later frame into this one
+         *
+         * Peaks take the maximum, clip flags are or-ed and RMS is combined
+         * by energy, so a drained batch reads as one long block.
+         */
+        void merge(const Frame& other) noexcept;
+    };
+
+    /**
+     * @brief Allocate the ring (not real-time safe)
+     * @param capacityFrames Blocks buffered for the reader; rounded up to a power of two
+     * @throws std::invalid_argument if capacityFrames is zero
+     */
+    explicit LevelMeter(std::size_t capacityFrames = DEFAULT_CAPACITY_FRAMES);
+
+    // Non-copyable
+    LevelMeter(const LevelMeter&) = delete;
+    LevelMeter& operator=(const LevelMeter&) = delete;
+
+    /**
+     * @brief Measure one block and push its frame (producer thread)
+     *
+     * Channels beyond MAX_CHANNELS are ignored. Never blocks or allocates.
+     */
+    void measure(const float* const* channelData, int numChannels, int numSamples) noexcept;
+
+    /**
+     * @brief Clear the true-peak interpolator history (producer side)
+     *
+     * Call while the producer is idle, e.g. when the device restarts. The
+     * reader may keep draining meanwhile.
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Take the oldest frame (consumer thread)
+     * @return false if no frame is waiting
+     */
+    bool pop(Frame& frame) noexcept { return frames_.read(&frame, 1); }
+
+    /**
+     * @brief Take every waiting frame, folded into one (consumer thread)
+     * @return Number of frames drained; @p total is untouched if zero
+     */
+    int drain(Frame& total) noexcept;
+
+    /**
+     * @brief Frames dropped because the ring was full
+     */
+    [[nodiscard]] std::uint64_t getDroppedFrameCount() const noexcept {
+        return droppedFrames_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr std::size_t DEFAULT_CAPACITY_FRAMES = 1024;
+
+    // BS.1770-4 interpolator: 4 phases of 12 taps
+    static constexpr int TRUE_PEAK_PHASES = 4;
+    static constexpr int TRUE_PEAK_TAPS = 12;
+    static const float TRUE_PEAK_COEFFICIENTS[TRUE_PEAK_PHASES][TRUE_PEAK_TAPS];
+
+    // Samples interpolated per pass; longer blocks are split
+    static constexpr int CHUNK_SIZE = 256;
+
+    [[nodiscard]] float measureTruePeak(int channel, const float* data, int numSamples) noexcept;
+
+    SpscRingBuffer<Frame> frames_;
+    std::atomic<std::uint64_t> droppedFrames_{0};
+
+    // Producer only: the last TRUE_PEAK_TAPS - 1 input samples followed by
+    // the chunk being interpolated, so each tap is a contiguous pass
+    std::array<std::array<float, TRUE_PEAK_TAPS - 1 + CHUNK_SIZE>, MAX_CHANNELS> history_{};
+    std::array<float, CHUNK_SIZE> interpolated_{};
+    dsp::DotProductKernel dotProduct_;
+};
+
+} // namespace finirig::audio
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <atomic>
+
+namespace finirig::audio {
+
+/**
+ * @brief Smoothed, thread-safe processor parameter
+ *
+ * The control thread writes a target with setValue(); the value is clamped
+ * and stored atomically, so there is nothing to tear. The audio thread owns
+ * the smoothed current value and moves it towards the target once per
+ * block with advance(), which reports whether the value moved so
+ * processors recompute derived coefficients only when they need to.
+ */
+class Parameter {
+public:
+    /**
+     * @brief How the current value approaches a new target
+     */
+    enum class Smoothing {
+        Linear,     ///< Constant-rate ramp, reaches the target after the ramp time
+        Exponential ///< One-pole approach, 60 dB closer after the ramp time
+    };
+
+    static constexpr double DEFAULT_RAMP_SECONDS = 0.05;
+
+    /**
+     * @brief Create a parameter
+     * @param defaultValue Initial target and current value
+     * @param minValue Lower bound for setValue()
+     * @param maxValue Upper bound for setValue()
+     * @param smoothing Smoothing curve
+     * @param rampSeconds Time to reach a new target
+     */
+    Parameter(
+        float defaultValue,
+        float minValue,
+        float maxValue,
+        Smoothing smoothing = Smoothing::Linear,
+        double rampSeconds = DEFAULT_RAMP_SECONDS
+    ) noexcept;
+
+    // Non-copyable (holds an atomic)
+    Parameter(const Parameter&) = delete;
+    Parameter& operator=(const Parameter&) = delete;
+
+    /**
+     * @brief Set the target value (clamped to the range; any thread)
+     */
+    void setValue(float value) noexcept;
+
+    /**
+     * @brief Get the target value (any thread)
+     */
+    [[nodiscard]] float getValue() const noexcept {
+        return target_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] float getMinValue() const noexcept { return minValue_; }
+    [[nodiscard]] float getMaxValue() const noexcept { return maxValue_; }
+
+    /**
+     * @brief Set up the ramp for a sample rate and jump to the target
+     *
+     * Call from prepare(), not while the audio thread is processing.
+     */
+    void prepare(double sampleRate) noexcept;
+
+    /**
+     * @brief Jump the current value to the target (audio thread)
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Advance smoothing by a block (audio thread)
+     * @param numSamples Samples covered by the block
+     * @return true if the current value changed
+     */
+    bool advance(int numSamples) noexcept;
+
+    /**
+     * @brief Get the smoothed value (audio thread)
+     */
+    [[nodiscard]] float getCurrentValue() const noexcept { return current_; }
+
+    /**
+     * @brief Check whether the current value is still moving (audio thread)
+     */
+    [[nodiscard]] bool isSmoothing() const noexcept { return remaining_ > 0; }
+
+private:
+    const float minValue_;
+    const float maxValue_;
+    const Smoothing smoothing_;
+    const double rampSeconds_;
+
+    std::atomic<float> target_;
+
+    // Audio thread only
+    float current_;
+    float rampTarget_;      // target the running ramp is heading for
+    float linearStep_ = 0.0f;
+    int rampSamples_ = 1;
+    int remaining_ = 0;     // samples left in the running ramp
+    double sampleDecay_ = 0.0;
+    double blockDecay_ = 0.0;
+    int blockDecaySize_ = 0;
+
+    void startRamp(float target) noexcept;
+};
+
+} // namespace finirig::audio
@@ -0,0 +1,198 @@
+#pragma once
+
+#include "finirig/audio/AudioWorkerPool.h"
+#include "finirig/audio/BlockProcessor.h"
+#include "finirig/audio/RealtimeEpoch.h"
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace finirig::audio {
+
+/**
+ * @brief Directed acyclic graph of processors with parallel branches
+ *
+ * Nodes are AudioProcessors; each connection carries a gain. A node's
+ * input is the sum of its incoming connections, and the graph output is
+ * the sum of the connections into OUTPUT, so wet/dry splits, dual amps
+ * into dual cabinets and similar rigs are a few connect() calls. An
+ * unconnected graph is silent.
+ *
+ * Each SUB_BLOCK_SIZE slice of a block runs the whole graph as one
+ * AudioWorkerPool job: nodes whose inputs are ready run on whichever
+ * core is free, with the audio thread taking part, so independent
+ * branches overlap instead of running one after another.
+ *
+ * Topology edits happen on a non-realtime thread: the graph is compiled
+ * into a new schedule, published with one atomic store, and the old one
+ * is freed once the audio thread has moved past it (RealtimeEpoch).
+ * Connection gains are atomics and change without recompiling.
+ *
+ * Nodes run on one channel, so Stereo nodes play their mono version.
+ */
+class ProcessingGraph : public BlockProcessor<>, private AudioWorkerPool::Job {
+public:
+    static constexpr int MAX_NODES = 32;
+    static constexpr int SUB_BLOCK_SIZE = 256;
+
+    // Endpoints for connect(): the graph input as a source, the output as a destination
+    static constexpr int INPUT = -1;
+    static constexpr int OUTPUT = -2;
+
+    /**
+     * @brief Create a graph with its own worker threads
+     * @param numWorkers Threads besides the audio thread (0 runs every node inline)
+     */
+    explicit ProcessingGraph(int numWorkers = AudioWorkerPool::getDefaultWorkerCount());
+    ~ProcessingGraph() override;
+
+    // Non-copyable
+    ProcessingGraph(const ProcessingGraph&) = delete;
+    ProcessingGraph& operator=(const ProcessingGraph&) = delete;
+
+    /**
+     * @brief Add an unconnected node
+     * @return Node id, stable until the node is removed
+     * @throws std::length_error if the graph already holds MAX_NODES nodes
+     */
+    int addNode(std::unique_ptr<AudioProcessor> processor);
+
+    /**
+     * @brief Remove a node and its connections, handing it back to the caller
+     *
+     * The node is no longer referenced by the audio thread when this returns.
+     * @throws std::out_of_range for an unknown node id
+     */
+    std::unique_ptr<AudioProcessor> removeNode(int node);
+
+    /**
+     * @brief Connect two nodes (or INPUT / OUTPUT), or change an existing connection's gain
+     * @throws std::out_of_range for an unknown node id
+     * @throws std::invalid_argument if the connection would create a cycle
+     */
+    void connect(int source, int destination, float gain = 1.0f);
+
+    /**
+     * @brief Remove a connection (no-op if it does not exist)
+     */
+    void disconnect(int source, int destination);
+
+    /**
+     * @brief Check whether two endpoints are connected
+     */
+    [[nodiscard]] bool isConnected(int source, int destination) const;
+
+    /**
+     * @brief Get a node for parameter access (the graph keeps ownership)
+     * @throws std::out_of_range for an unknown node id
+     */
+    [[nodiscard]] AudioProcessor* getNode(int node) const;
+
+    [[nodiscard]] int getNumNodes() const;
+    [[nodiscard]] int getNumWorkers() const noexcept { return pool_->getNumWorkers(); }
+
+    void processBlock(
+        float* buffer,
+        int numChannels,
+        int numSamples
+    ) noexcept override;
+
+    void processChannels(
+        float* const* channelData,
+        int numChannels,
+        int numSamples
+    ) noexcept override;
+
+    void prepare(double sampleRate) override;
+    void reset() override;
+
+    /**
+     * @brief Latency of the slowest path from INPUT to OUTPUT
+     *
+     * Branches are not delay-compensated against each other. Computed when
+     * the graph is published or prepared, or a node reports a change through
+     * notifyLatencyChanged(), so reading it never locks. Changes here are
+     * passed on to the container holding this graph.
+     */
+    [[nodiscard]] int getLatencySamples() const noexcept override {
+        return latencySamples_.load(std::memory_order_relaxed);
+    }
+    [[nodiscard]] juce::String getName() const override { return "Processing Graph"; }
+
+private:
+    struct Connection {
+        int source;
+        int destination;
+        std::atomic<float> gain;
+    };
+
+    struct alignas(64) Buffer {
+        std::array<float, SUB_BLOCK_SIZE> samples{};
+    };
+
+    // One summed input of a task; source == nullptr reads the graph input
+    struct Input {
+        const Connection* connection;
+        const float* source;
+    };
+
+    struct Task {
+        AudioProcessor* processor = nullptr;
+        float* buffer = nullptr;
+        std::vector<Input> inputs;
+        std::vector<int> dependents;
+        int numDependencies = 0;
+        std::atomic<int> pending{0};
+    };
+
+    // Audio-thread view of the graph, built by compile() on the control thread
+    struct Schedule {
+        std::vector<Task> tasks;
+        std::vector<int> roots;
+        std::vector<Input> outputs;
+        std::vector<Buffer> buffers;
+    };
+
+    void checkNode(int node) const;
+    void checkEndpoint(int endpoint, bool isSource) const;
+    [[nodiscard]] std::vector<int> sortNodes() const;
+    [[nodiscard]] std::unique_ptr<Schedule> compile() const;
+    // Returns whether the latency changed; controlMutex_ held
+    bool publish(std::unique_ptr<Schedule> schedule);
+
+    // Recompute latencySamples_, true if it changed; controlMutex_ held
+    bool updateLatency();
+
+    void stageLatencyChanged() override;
+
+    int runTask(int task, int* readyTasks) noexcept override;
+    void runSlice(Schedule& schedule, const float* input, float* output, int numSamples) noexcept;
+    void mixInputs(const std::vector<Input>& inputs, float* destination) const noexcept;
+
+    // Control side, guarded by controlMutex_
+    mutable std::mutex controlMutex_;
+    std::array<std::unique_ptr<AudioProcessor>, MAX_NODES> nodes_;
+    std::vector<std::unique_ptr<Connection>> connections_;
+    double sampleRate_ = 0.0;
+
+    std::unique_ptr<Schedule> published_;
+    std::atomic<Schedule*> schedule_{nullptr};
+    RealtimeEpoch processEpoch_;
+    std::atomic<int> latencySamples_{0};
+
+    // Per-slice state shared with the workers; written before each job starts
+    Schedule* runningSchedule_ = nullptr;
+    const float* sliceInput_ = nullptr;
+    int sliceSamples_ = 0;
+
+    // Deinterleaved input (processBlock) and summed output of a slice
+    std::unique_ptr<Buffer> inputScratch_;
+    std::unique_ptr<Buffer> outputScratch_;
+
+    // Declared last so the workers stop before anything they touch is freed
+    std::unique_ptr<AudioWorkerPool> pool_;
+};
+
+} // namespace finirig::audio
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace finirig::audio {
+
+/**
+ * @brief Cumulative timing counters for one processing stage
+ *
+ * Written by whoever drives the stage on the audio thread (the engine or a
+ * SignalChain), read as a snapshot from the UI. Recording is wait-free:
+ * relaxed atomics with a single writer, and resets are applied by the
+ * writer on its next record() so both sides never write the same counter.
+ */
+class ProcessorStats {
+public:
+    /**
+     * @brief Point-in-time copy of the counters
+     */
+    struct Snapshot {
+        std::uint64_t totalNanoseconds = 0;
+        std::uint64_t numSamples = 0;
+        std::uint64_t numBlocks = 0;
+        std::uint64_t peakBlockNanoseconds = 0;
+
+        /**
+         * @brief Average processing cost per sample
+         */
+        [[nodiscard]] double getNanosecondsPerSample() const noexcept {
+            return numSamples > 0
+                ? static_cast<double>(totalNanoseconds) / static_cast<double>(numSamples)
+                : 0.0;
+        }
+
+        /**
+         * @brief Fraction of realtime spent in this stage (1.0 = one full core)
+         */
+        [[nodiscard]] double getLoad(double sampleRate) const noexcept {
+            return getNanosecondsPerSample() * sampleRate * 1.0e-9;
+        }
+    };
+
+    ProcessorStats() = default;
+
+    // Non-copyable
+    ProcessorStats(const ProcessorStats&) = delete;
+    ProcessorStats& operator=(const ProcessorStats&) = delete;
+
+    /**
+     * @brief Record one processed block (audio thread, single writer)
+     */
+    void record(std::int64_t elapsedNanoseconds, int numSamples) noexcept;
+
+    /**
+     * @brief Read the counters (any thread)
+     */
+    [[nodiscard]] Snapshot getSnapshot() const noexcept;
+
+    /**
+     * @brief Ask the writer to clear the counters on its next record()
+     */
+    void requestReset() noexcept { resetRequested_.store(true, std::memory_order_relaxed); }
+
+private:
+    std::atomic<std::uint64_t> totalNanoseconds_{0};
+    std::atomic<std::uint64_t> numSamples_{0};
+    std::atomic<std::uint64_t> numBlocks_{0};
+    std::atomic<std::uint64_t> peakBlockNanoseconds_{0};
+    std::atomic<bool> resetRequested_{false};
+};
+
+} // namespace finirig::audio
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace finirig::audio {
+
+/**
+ * @brief Quiescent-state tracker for a single realtime reader
+ *
+ * The realtime thread brackets every pass over shared data with
+ * enter()/exit(). A writer publishes a new pointer, takes a snapshot()
+ * and may reclaim the previous object once hasPassed() returns true for
+ * that snapshot. The reader side is two atomic increments and never blocks.
+ *
+ * The counter is odd while the reader is inside a critical section.
+ */
+class RealtimeEpoch {
+public:
+    /**
+     * @brief RAII helper for the reader side
+     */
+    class ScopedReader {
+    public:
+        explicit ScopedReader(RealtimeEpoch& epoch) noexcept : epoch_(epoch) { epoch_.enter(); }
+        ~ScopedReader() noexcept { epoch_.exit(); }
+
+        ScopedReader(const ScopedReader&) = delete;
+        ScopedReader& operator=(const ScopedReader&) = delete;
+
+    private:
+        RealtimeEpoch& epoch_;
+    };
+
+    RealtimeEpoch() = default;
+
+    // Non-copyable
+    RealtimeEpoch(const RealtimeEpoch&) = delete;
+    RealtimeEpoch& operator=(const RealtimeEpoch&) = delete;
+
+    /**
+     * @brief Mark the start of a read section (realtime thread)
+     *
+     * Must be sequentially consistent so that it is ordered against the
+     * writer's pointer exchange followed by snapshot().
+     */
+    void enter() noexcept { counter_.fetch_add(1, std::memory_order_seq_cst); }
+
+    /**
+     * @brief Mark the end of a read section (realtime thread)
+     */
+    void exit() noexcept { counter_.fetch_add(1, std::memory_order_release); }
+
+    /**
+     * @brief Capture the reader state after publishing new data (writer thread)
+     */
+    [[nodiscard]] std::uint64_t snapshot() const noexcept {
+        return counter_.load(std::memory_order_seq_cst);
+    }
+
+    /**
+     * @brief Check whether the reader can no longer see data retired at @p snapshot
+     *
+     * True if the reader was idle when the snapshot was taken, or has since
+     * left the section it was in.
+     */
+    [[nodiscard]] bool hasPassed(std::uint64_t snapshot) const noexcept {
+        return (snapshot & 1u) == 0 || counter_.load(std::memory_order_acquire) != snapshot;
+    }
+
+    /**
+     * @brief Block the calling (non-realtime) thread until the reader has
+     * passed the current snapshot
+     */
+    void synchronize() const;
+
+private:
+    std::atomic<std::uint64_t> counter_{0};
+};
+
+} // namespace finirig::audio
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <thread>
+
+namespace finirig::audio {
+
+/**
+ * @brief Ask the OS to run a thread with realtime (SCHED_FIFO) priority
+ *
+ * Best effort: needs rtprio / elevated rights on Linux, fine on macOS,
+ * a no-op elsewhere. A refused request leaves the thread at normal priority.
+ * @return true if the request was granted
+ */
+bool requestRealtimePriority(std::thread& thread) noexcept;
+
+} // namespace finirig::audio
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "finirig/audio/RealtimeEpoch.h"
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace finirig::audio {
+
+/**
+ * @brief Deferred destruction of objects retired from the audio thread
+ *
+ * Objects handed to retire() are kept alive until the realtime reader
+ * tracked by the given RealtimeEpoch has moved past the point of
+ * retirement, then destroyed on a background garbage thread. This keeps
+ * both the wait and the deallocation off the audio thread and off the
+ * thread that swapped the object out.
+ */
+class ReleasePool {
+public:
+    explicit ReleasePool(const RealtimeEpoch& epoch);
+    ~ReleasePool();
+
+    // Non-copyable
+    ReleasePool(const ReleasePool&) = delete;
+    ReleasePool& operator=(const ReleasePool&) = delete;
+
+    /**
+     * @brief Hand over an object that has just been unpublished
+     *
+     * Must be called after the atomic store that removed the object from
+     * the reader's view. Not real-time safe.
+     */
+    template <typename T>
+    void retire(std::unique_ptr<T> object) {
+        if (object) {
+            retireErased(std::shared_ptr<void>(std::move(object)));
+        }
+    }
+
+    /**
+     * @brief Destroy every retired object the reader can no longer see
+     * @return Number of objects destroyed
+     */
+    std::size_t collect();
+
+    /**
+     * @brief Number of objects still waiting to be destroyed
+     */
+    [[nodiscard]] std::size_t getPendingCount() const;
+
+private:
+    struct Retired {
+        std::shared_ptr<void> object;
+        std::uint64_t epoch;
+    };
+
+    void retireErased(std::shared_ptr<void> object);
+    void run();
+
+    const RealtimeEpoch& epoch_;
+    mutable std::mutex mutex_;
+    std::condition_variable condition_;
+    std::vector<Retired> retired_;
+    bool shouldExit_ = false;
+    std::thread thread_;
+};
+
+} // namespace finirig::audio
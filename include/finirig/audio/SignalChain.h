@@ -0,0 +1,223 @@
+#pragma once
+
+#include "finirig/audio/AudioProcessor.h"
+#include "finirig/audio/RealtimeEpoch.h"
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace finirig::audio {
+
+/**
+ * @brief Serial chain of processing stages (pedals, amps, ...)
+ *
+ * Runs an ordered list of AudioProcessor stages block by block. The block
+ * is processed in place in sub-blocks of SUB_BLOCK_SIZE samples, each
+ * sub-block going through every stage before the next one starts, so the
+ * working set stays in L1 between stages and the chain itself adds no
+ * memory passes.
+ *
+ * Stages are edited from a non-realtime thread. Edits build the stage list
+ * off to the side, publish it with one atomic store and wait for the
+ * audio thread to move past the old list before handing removed stages
+ * back. Nothing is allocated or locked on the audio thread, and the editing
+ * thread waits at most one audio callback. That wait happens outside the
+ * lock the getters take, so only other edits queue behind it.
+ *
+ * The chain input is mono (channel 0). The signal stays on one channel
+ * through Mono stages and is fanned out to two only when it reaches a
+ * Stereo stage. A Mono stage after a Stereo one gets the (L+R)/2 downmix:
+ * mono stages keep one channel of state, so they cannot run on each side.
+ * Whatever width the last stage leaves is copied to the remaining channels
+ * once at the end.
+ */
+class SignalChain : public AudioProcessor {
+public:
+    static constexpr int MAX_STAGES = 16;
+    static constexpr int SUB_BLOCK_SIZE = 256;
+
+    /**
+     * @brief Per-stage diagnostics for the UI
+     */
+    struct StageStatistics {
+        juce::String name;
+        bool bypassed = false;
+        ProcessorStats::Snapshot stats;
+    };
+
+    SignalChain();
+    ~SignalChain() override;
+
+    // Non-copyable
+    SignalChain(const SignalChain&) = delete;
+    SignalChain& operator=(const SignalChain&) = delete;
+
+    /**
+     * @brief Append a stage to the end of the chain
+     * @return Index of the new stage
+     * @throws std::length_error if the chain already holds MAX_STAGES stages
+     */
+    int addStage(std::unique_ptr<AudioProcessor> stage);
+
+    /**
+     * @brief Insert a stage before @p index (index == getNumStages() appends)
+     * @throws std::out_of_range for an invalid index
+     * @throws std::length_error if the chain is full
+     */
+    void insertStage(int index, std::unique_ptr<AudioProcessor> stage);
+
+    /**
+     * @brief Remove a stage and hand ownership back to the caller
+     *
+     * The stage is no longer referenced by the audio thread when this returns.
+     * @throws std::out_of_range for an invalid index
+     */
+    std::unique_ptr<AudioProcessor> removeStage(int index);
+
+    /**
+     * @brief Move a stage from one position to another
+     * @throws std::out_of_range for an invalid index
+     */
+    void moveStage(int fromIndex, int toIndex);
+
+    /**
+     * @brief Bypass a stage without removing it
+     *
+     * Only flips an atomic flag; the audio thread picks it up on its next
+     * block without the chain being republished.
+     */
+    void setStageBypassed(int index, bool bypassed);
+
+    /**
+     * @brief Check whether a stage is bypassed
+     */
+    [[nodiscard]] bool isStageBypassed(int index) const;
+
+    /**
+     * @brief Get number of stages in the chain
+     */
+    [[nodiscard]] int getNumStages() const;
+
+    /**
+     * @brief Get a stage for parameter access (the chain keeps ownership)
+     */
+    [[nodiscard]] AudioProcessor* getStage(int index) const;
+
+    /**
+     * @brief Snapshot the timing counters of every stage, in chain order
+     */
+    [[nodiscard]] std::vector<StageStatistics> getStageStatistics() const;
+
+    /**
+     * @brief Clear the timing counters of every stage
+     */
+    void resetStageStatistics();
+
+    /**
+     * @brief Enable or disable per-stage timing (two clock reads per stage per block)
+     */
+    void setProfilingEnabled(bool enabled) noexcept {
+        profilingEnabled_.store(enabled, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Check if per-stage timing is enabled
+     */
+    [[nodiscard]] bool isProfilingEnabled() const noexcept {
+        return profilingEnabled_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] float processSample(float input) noexcept override;
+
+    void processBlock(
+        float* buffer,
+        int numChannels,
+        int numSamples
+    ) noexcept override;
+
+    void processChannels(
+        float* const* channelData,
+        int numChannels,
+        int numSamples
+    ) noexcept override;
+
+    void prepare(double sampleRate) override;
+    void reset() override;
+
+    /**
+     * @brief Summed latency of the active stages (one atomic load)
+     *
+     * Recomputed whenever the stage list is republished, a stage is
+     * bypassed, the chain is prepared or a stage reports a change through
+     * notifyLatencyChanged(), so polling it never locks. Changes here are
+     * passed on to the container holding this chain.
+     */
+    [[nodiscard]] int getLatencySamples() const noexcept override {
+        return latencySamples_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Stereo if any stage is (stage layouts are read when stages are published)
+     */
+    [[nodiscard]] ChannelLayout getChannelLayout() const noexcept override {
+        return stereo_.load(std::memory_order_relaxed) ? ChannelLayout::Stereo : ChannelLayout::Mono;
+    }
+
+    [[nodiscard]] juce::String getName() const override { return "Signal Chain"; }
+
+private:
+    struct Stage {
+        std::unique_ptr<AudioProcessor> processor;
+        std::atomic<bool> bypassed{false};
+    };
+
+    // Audio-thread view of the chain; filled on the control thread only
+    struct StageList {
+        std::array<Stage*, MAX_STAGES> stages{};
+        std::array<bool, MAX_STAGES> stereo{};
+        int numStages = 0;
+    };
+
+    // Mono scratch for the interleaved path, aligned to a cache line
+    struct alignas(64) ScratchBuffer {
+        std::array<float, SUB_BLOCK_SIZE> samples{};
+    };
+
+    // Publish stages_ to the audio thread and wait until the old list is
+    // free; publishMutex_ held, releases the controlMutex_ lock first
+    void publishStages(std::unique_lock<std::mutex>& lock);
+
+    // Recompute latencySamples_, true if it changed; controlMutex_ held
+    bool updateLatency() noexcept;
+
+    void stageLatencyChanged() override;
+    void checkIndex(int index, int size) const;
+    void runStages(
+        const StageList& list,
+        float* const* channelData,
+        int numChannels,
+        int numSamples
+    ) noexcept;
+
+    // Structural edits, held through publishStages(); taken before controlMutex_
+    std::mutex publishMutex_;
+
+    // Control side, guarded by controlMutex_
+    mutable std::mutex controlMutex_;
+    std::vector<std::unique_ptr<Stage>> stages_;
+    double sampleRate_ = 0.0;
+
+    // Double-buffered stage list; the inactive one is free after synchronize()
+    std::array<StageList, 2> stageLists_;
+    std::atomic<const StageList*> activeList_;
+    RealtimeEpoch processEpoch_;
+    std::atomic<bool> profilingEnabled_{true};
+    std::atomic<bool> stereo_{false};
+    std::atomic<int> latencySamples_{0};
+
+    std::unique_ptr<ScratchBuffer> scratch_;
+};
+
+} // namespace finirig::audio
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+namespace finirig::audio {
+
+/**
+ * @brief Lock-free single-producer / single-consumer ring of trivially copyable items
+ *
+ * One thread writes, one other thread reads; neither ever blocks or
+ * allocates after construction. Reads and writes are all-or-nothing so a
+ * block of samples (or one struct) is never split between calls.
+ *
+ * Positions count up forever and are masked on access, so a full ring
+ * holds exactly getCapacity() items.
+ */
+template <typename T>
+class SpscRingBuffer {
+public:
+    static_assert(std::is_trivially_copyable_v<T>, "Items are copied with plain assignment");
+
+    /**
+     * @brief Allocate the ring
+     * @param minimumCapacity Items the ring must hold; rounded up to a power of two
+     * @throws std::invalid_argument if minimumCapacity is zero
+     */
+    explicit SpscRingBuffer(std::size_t minimumCapacity) {
+        if (minimumCapacity == 0) {
+            throw std::invalid_argument("SpscRingBuffer capacity must be positive");
+        }
+
+        std::size_t capacity = 1;
+        while (capacity < minimumCapacity) {
+            capacity <<= 1;
+        }
+        buffer_ = std::make_unique<T[]>(capacity);
+        mask_ = capacity - 1;
+    }
+
+    // Non-copyable
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+    /**
+     * @brief Append items (producer thread only)
+     * @return false, writing nothing, if there is not room for all of them
+     */
+    bool write(const T* items, std::size_t count) noexcept {
+        const auto writePosition = writePosition_.load(std::memory_order_relaxed);
+        const auto readPosition = readPosition_.load(std::memory_order_acquire);
+        if (count > getCapacity() - (writePosition - readPosition)) {
+            return false;
+        }
+
+        const auto start = writePosition & mask_;
+        const auto firstPart = std::min(count, getCapacity() - start);
+        std::copy(items, items + firstPart, buffer_.get() + start);
+        std::copy(items + firstPart, items + count, buffer_.get());
+
+        writePosition_.store(writePosition + count, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Take the oldest items (consumer thread only)
+     * @return false, reading nothing, if fewer than count items are ready
+     */
+    bool read(T* items, std::size_t count) noexcept {
+        const auto readPosition = readPosition_.load(std::memory_order_relaxed);
+        const auto writePosition = writePosition_.load(std::memory_order_acquire);
+        if (count > writePosition - readPosition) {
+            return false;
+        }
+
+        const auto start = readPosition & mask_;
+        const auto firstPart = std::min(count, getCapacity() - start);
+        std::copy(buffer_.get() + start, buffer_.get() + start + firstPart, items);
+        std::copy(buffer_.get(), buffer_.get() + (count - firstPart), items + firstPart);
+
+        readPosition_.store(readPosition + count, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Drop up to count of the oldest items (consumer thread only)
+     * @return Number of items dropped
+     */
+    std::size_t discard(std::size_t count) noexcept {
+        const auto readPosition = readPosition_.load(std::memory_order_relaxed);
+        const auto writePosition = writePosition_.load(std::memory_order_acquire);
+        const auto dropped = std::min(count, writePosition - readPosition);
+        readPosition_.store(readPosition + dropped, std::memory_order_release);
+        return dropped;
+    }
+
+    /**
+     * @brief Items ready to read (exact on the consumer thread, a lower bound elsewhere)
+     */
+    [[nodiscard]] std::size_t getNumReady() const noexcept {
+        return writePosition_.load(std::memory_order_acquire) - readPosition_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Room left for writing (exact on the producer thread, a lower bound elsewhere)
+     */
+    [[nodiscard]] std::size_t getFreeSpace() const noexcept {
+        return getCapacity() - (writePosition_.load(std::memory_order_relaxed)
+                                - readPosition_.load(std::memory_order_acquire));
+    }
+
+    [[nodiscard]] std::size_t getCapacity() const noexcept { return mask_ + 1; }
+
+    /**
+     * @brief Empty the ring; only while neither side is using it
+     */
+    void clear() noexcept {
+        readPosition_.store(0, std::memory_order_relaxed);
+        writePosition_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    std::unique_ptr<T[]> buffer_;
+    std::size_t mask_ = 0;
+
+    // Each side writes one position; keep them on separate cache lines
+    alignas(64) std::atomic<std::size_t> readPosition_{0};
+    alignas(64) std::atomic<std::size_t> writePosition_{0};
+};
+
+} // namespace finirig::audio
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace finirig::audio {
+
+/**
+ * @brief Fixed-capacity Chase-Lev work-stealing deque
+ *
+ * The owning thread pushes and pops at the bottom (LIFO, so it keeps
+ * working on what it just made ready while the data is hot); any other
+ * thread steals from the top. Lock-free and allocation-free; the
+ * capacity is fixed so the buffer never has to grow.
+ *
+ * Memory orderings follow Lê et al., "Correct and Efficient Work-Stealing
+ * for Weak Memory Models" (PPoPP 2013).
+ */
+template <typename T, std::size_t Capacity>
+class WorkStealingQueue {
+public:
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>, "Elements are copied racily and must be trivially copyable");
+
+    WorkStealingQueue() = default;
+
+    // Non-copyable (holds atomics)
+    WorkStealingQueue(const WorkStealingQueue&) = delete;
+    WorkStealingQueue& operator=(const WorkStealingQueue&) = delete;
+
+    /**
+     * @brief Push at the bottom (owner thread only)
+     * @return false if the queue is full
+     */
+    bool push(T value) noexcept {
+        const auto bottom = bottom_.load(std::memory_order_relaxed);
+        const auto top = top_.load(std::memory_order_acquire);
+        if (bottom - top >= static_cast<std::int64_t>(Capacity)) {
+            return false;
+        }
+
+        slot(bottom).store(value, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @brief Pop from the bottom (owner thread only)
+     * @return false if the queue is empty or a thief took the last element
+     */
+    bool pop(T& value) noexcept {
+        const auto bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        bottom_.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto top = top_.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        value = slot(bottom).load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // Last element: race any thief for it
+            const bool won = top_.compare_exchange_strong(
+                top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed
+            );
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Take the oldest element from the top (any thread)
+     * @return false if the queue is empty or another thread won the race
+     */
+    bool steal(T& value) noexcept {
+        auto top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const auto bottom = bottom_.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return false;
+        }
+
+        const T candidate = slot(top).load(std::memory_order_relaxed);
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return false;
+        }
+        value = candidate;
+        return true;
+    }
+
+    /**
+     * @brief Approximate number of queued elements
+     */
+    [[nodiscard]] std::size_t size() const noexcept {
+        const auto count = bottom_.load(std::memory_order_relaxed) - top_.load(std::memory_order_relaxed);
+        return count > 0 ? static_cast<std::size_t>(count) : 0;
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+private:
+    // Owner and thieves write different ends; keep them on separate lines
+    alignas(64) std::atomic<std::int64_t> top_{0};
+    alignas(64) std::atomic<std::int64_t> bottom_{0};
+    alignas(64) std::array<std::atomic<T>, Capacity> buffer_{};
+
+    std::atomic<T>& slot(std::int64_t index) noexcept {
+        return buffer_[static_cast<std::size_t>(index) & (Capacity - 1)];
+    }
+};
+
+} // namespace finirig::audio
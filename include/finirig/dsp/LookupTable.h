@@ -0,0 +1,65 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace finirig::dsp {
+
+/**
+ * @brief Transfer curve sampled once and read back by linear interpolation
+ *
+ * Replaces exp/tanh-style nonlinearities in the audio path with a table
+ * lookup and one multiply-add. Inputs outside [minInput, maxInput] are
+ * clamped to the end points, which suits saturating curves that are flat
+ * there anyway. With an odd size and a symmetric range, x = 0 lands
+ * exactly on a table point, so silence maps to f(0) without rounding.
+ */
+class LookupTable {
+public:
+    static constexpr int DEFAULT_SIZE = 2049;
+
+    /**
+     * @brief Sample @p function over the range (allocates; not real-time safe)
+     * @throws std::invalid_argument if size < 2 or the range is empty
+     */
+    LookupTable(
+        const std::function<float(float)>& function,
+        float minInput,
+        float maxInput,
+        int size = DEFAULT_SIZE
+    );
+
+    /**
+     * @brief Interpolated value at @p x
+     */
+    [[nodiscard]] float operator()(float x) const noexcept {
+        const float position = (clamp(x) - minInput_) * scale_;
+        const int index = std::min(static_cast<int>(position), lastIndex_ - 1);
+        const float fraction = position - static_cast<float>(index);
+        const float* point = table_.data() + index;
+        return point[0] + fraction * (point[1] - point[0]);
+    }
+
+    /**
+     * @brief Apply the curve to a block in place
+     */
+    void process(float* data, int numSamples) const noexcept;
+
+    [[nodiscard]] float getMinInput() const noexcept { return minInput_; }
+    [[nodiscard]] float getMaxInput() const noexcept { return maxInput_; }
+    [[nodiscard]] int getSize() const noexcept { return lastIndex_ + 1; }
+
+private:
+    float minInput_;
+    float maxInput_;
+    float scale_;    // table points per input unit
+    int lastIndex_;
+    std::vector<float> table_;
+
+    [[nodiscard]] float clamp(float x) const noexcept {
+        return x < minInput_ ? minInput_ : (x > maxInput_ ? maxInput_ : x);
+    }
+};
+
+} // namespace finirig::dsp
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "finirig/dsp/SimdKernels.h"
+#include <vector>
+
+namespace finirig::dsp {
+
+/**
+ * @brief Mono 2x/4x/8x oversampler built from cascaded half-band FIRs
+ *
+ * Each octave is a Kaiser-windowed half-band low-pass split into its two
+ * polyphase branches: every other tap of a half-band filter is zero and
+ * the centre tap is 0.5, so one branch is a short FIR and the other a
+ * plain delay. That halves the multiplies of a direct implementation and
+ * the remaining FIR branch runs through the SIMD dot product kernel.
+ *
+ * Usage per block: upsample() returns the oversampled signal in an
+ * internal buffer, the caller processes it in place, then downsample()
+ * filters it back to the base rate. Both are real-time safe once
+ * prepare() has been called from the control thread.
+ */
+class Oversampler {
+public:
+    /**
+     * @brief Filter length / stopband trade-off
+     *
+     * Low keeps latency and CPU to a minimum, High pushes the stopband
+     * further down for heavily distorted sources.
+     */
+    enum class Quality {
+        Low,
+        Normal,
+        High
+    };
+
+    static constexpr int MAX_FACTOR = 8;
+
+    /**
+     * @brief Create an oversampler
+     * @param factor Oversampling factor: 1, 2, 4 or 8 (1 passes through)
+     * @param quality Filter quality
+     * @throws std::invalid_argument if factor is not supported
+     */
+    explicit Oversampler(int factor = 2, Quality quality = Quality::Normal);
+
+    /**
+     * @brief Allocate buffers for blocks of up to maxBlockSize input samples
+     */
+    void prepare(int maxBlockSize);
+
+    /**
+     * @brief Clear filter history
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Upsample a block
+     * @param input Base-rate samples
+     * @param numSamples Number of input samples (at most maxBlockSize)
+     * @return Internal buffer of numSamples * getFactor() samples
+     */
+    [[nodiscard]] float* upsample(const float* input, int numSamples) noexcept;
+
+    /**
+     * @brief Downsample the internal buffer filled by the last upsample()
+     * @param output Receives numSamples base-rate samples
+     * @param numSamples Same count as passed to upsample()
+     */
+    void downsample(float* output, int numSamples) noexcept;
+
+    [[nodiscard]] int getFactor() const noexcept { return factor_; }
+    [[nodiscard]] Quality getQuality() const noexcept { return quality_; }
+    [[nodiscard]] int getMaxBlockSize() const noexcept { return maxBlockSize_; }
+
+    /**
+     * @brief Round-trip group delay in base-rate samples
+     *
+     * Inner octaves contribute fractional delays, so this may not be an
+     * integer; callers reporting latency round it.
+     */
+    [[nodiscard]] double getLatencySamples() const noexcept;
+
+private:
+    // One octave of the cascade. Buffers hold the filter history in front
+    // of the current block so every output is one contiguous dot product.
+    struct HalfBandStage {
+        std::vector<float> coefficients; // non-zero even taps, reversed
+        int numTaps = 0;                 // coefficients.size()
+        std::vector<float> upBuffer;     // history + base-rate input
+        std::vector<float> downEven;     // history + even-phase input
+        std::vector<float> downOdd;      // delay line + odd-phase input
+        std::vector<float> output;       // upsampled block (2x this stage's input)
+    };
+
+    int factor_;
+    Quality quality_;
+    int maxBlockSize_ = 0;
+    std::vector<HalfBandStage> stages_;
+    std::vector<float> passthrough_; // factor 1 only
+    DotProductKernel dotProduct_ = getDotProductKernel();
+
+    void upsampleStage(HalfBandStage& stage, const float* input, int numSamples) noexcept;
+    void downsampleStage(HalfBandStage& stage, const float* input, float* output, int numSamples) noexcept;
+};
+
+} // namespace finirig::dsp
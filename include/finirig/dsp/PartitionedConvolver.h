@@ -0,0 +1,132 @@
+#pragma once
+
+#include "finirig/dsp/SimdKernels.h"
+#include <juce_dsp/juce_dsp.h>
+#include <memory>
+#include <vector>
+
+namespace finirig::dsp {
+
+/**
+ * @brief Zero-latency mono convolution for long impulse responses
+ *
+ * The first partitionSize taps of the IR (the head) run as a direct-form
+ * FIR, so output is never delayed. The rest (the tail) is split into
+ * uniform partitions of the same size and convolved in the frequency
+ * domain by uniformly partitioned overlap-save: each completed input
+ * block is transformed once, kept in a frequency-domain delay line, and
+ * multiplied against every tail partition. The tail of block q only
+ * needs input up to block q-1, so it is ready before the head starts
+ * on block q.
+ *
+ * Cost per sample is partitionSize multiplies for the head plus, once
+ * per partition, two FFTs of 2 * partitionSize points and one complex
+ * multiply-add per bin per tail partition.
+ *
+ * The transformed IR lives in an immutable Kernel that can be built on
+ * any thread and shared between convolvers; a convolver only adds its
+ * own input history.
+ */
+class PartitionedConvolver {
+public:
+    static constexpr int DEFAULT_PARTITION_SIZE = 64;
+
+    /**
+     * @brief Precomputed impulse response partitions (immutable once built)
+     */
+    struct Kernel {
+        int partitionSize = 0;
+        int length = 0;                  // IR length in samples
+        int numPartitions = 0;           // frequency-domain partitions after the head
+        std::vector<float> head;         // first partitionSize taps, reversed
+        std::vector<float> partitionsRe; // tail spectra, split, partition-major
+        std::vector<float> partitionsIm;
+    };
+
+    /**
+     * @brief Transform an impulse response into kernel partitions
+     *
+     * Allocates and runs one FFT per partition; not real-time safe.
+     * @throws std::invalid_argument for an unsupported partition size
+     */
+    [[nodiscard]] static std::shared_ptr<const Kernel> createKernel(
+        const float* impulseResponse,
+        int length,
+        int partitionSize
+    );
+
+    /**
+     * @brief Create an empty convolver (passes silence until an IR is set)
+     * @param partitionSize Head length and tail partition size (power of two, >= 8)
+     * @throws std::invalid_argument for an unsupported partition size
+     */
+    explicit PartitionedConvolver(int partitionSize = DEFAULT_PARTITION_SIZE);
+
+    /**
+     * @brief Set the impulse response and clear the history
+     *
+     * Allocates and transforms the partitions; not real-time safe.
+     */
+    void setImpulseResponse(const float* impulseResponse, int length);
+
+    /**
+     * @brief Use a prebuilt kernel and clear the history
+     *
+     * Allocates the delay line; not real-time safe. A null kernel removes
+     * the impulse response.
+     * @throws std::invalid_argument if the kernel's partition size differs
+     */
+    void setKernel(std::shared_ptr<const Kernel> kernel);
+
+    [[nodiscard]] const std::shared_ptr<const Kernel>& getKernel() const noexcept { return kernel_; }
+
+    /**
+     * @brief Clear input history and pending tail output
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Convolve a block in place (any length, real-time safe)
+     */
+    void process(float* data, int numSamples) noexcept;
+
+    [[nodiscard]] int getPartitionSize() const noexcept { return partitionSize_; }
+    [[nodiscard]] int getImpulseResponseLength() const noexcept {
+        return kernel_ ? kernel_->length : 0;
+    }
+
+    /**
+     * @brief Number of frequency-domain partitions after the direct-form head
+     */
+    [[nodiscard]] int getNumTailPartitions() const noexcept { return numPartitions_; }
+
+private:
+    int partitionSize_;
+    int numBins_;                      // partitionSize + 1 non-negative bins
+    juce::dsp::FFT fft_;               // 2 * partitionSize points
+    DotProductKernel dotProduct_ = getDotProductKernel();
+
+    std::shared_ptr<const Kernel> kernel_;
+    std::vector<float> silentHead_;    // head used without a kernel
+    const float* head_ = nullptr;      // kernel_->head or silentHead_
+    int numPartitions_ = 0;
+
+    // Spectra of the last numPartitions_ input blocks (ring, same layout)
+    std::vector<float> delayLineRe_;
+    std::vector<float> delayLineIm_;
+    int delayLineHead_ = 0;
+
+    // Previous and current input block back to back: the head FIR reads
+    // its history from here and the tail FFT takes all of it
+    std::vector<float> inputBuffer_;
+    int position_ = 0;                 // samples of the current block so far
+
+    std::vector<float> tailOutput_;    // tail contribution for the current block
+    std::vector<float> fftBuffer_;     // 4 * partitionSize, as JUCE requires
+    std::vector<float> accumulatorRe_;
+    std::vector<float> accumulatorIm_;
+
+    void finishBlock() noexcept;
+};
+
+} // namespace finirig::dsp
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "finirig/dsp/SimdKernels.h"
+#include <vector>
+
+namespace finirig::dsp {
+
+/**
+ * @brief Monophonic pitch tracker for the tuner (YIN)
+ *
+ * Runs de Cheveigné and Kawahara's YIN on overlapping windows: the
+ * difference function is built from the SIMD dot product kernel, then
+ * cumulative-mean normalised; the first dip under the threshold is the
+ * period, refined by parabolic interpolation. Windows below the silence
+ * level, or without a clear dip, are reported as unvoiced.
+ *
+ * Allocates only in prepare(); meant for a non-realtime analysis thread.
+ */
+class PitchDetector {
+public:
+    static constexpr float DEFAULT_MIN_FREQUENCY = 50.0f;   // below drop A
+    static constexpr float DEFAULT_MAX_FREQUENCY = 1500.0f; // above the 24th fret of high E
+
+    // Normalised difference a period dip must fall below
+    static constexpr float YIN_THRESHOLD = 0.15f;
+
+    // Window RMS below this (about -60 dBFS) is treated as silence
+    static constexpr float SILENCE_RMS = 0.001f;
+
+    /**
+     * @brief Latest detection
+     */
+    struct Result {
+        float frequency = 0.0f;  // Hz, 0 when unvoiced
+        float confidence = 0.0f; // 1 - normalised difference at the period
+        bool voiced = false;
+    };
+
+    /**
+     * @brief Nearest equal-tempered note to a frequency
+     */
+    struct Note {
+        int midiNote = 0;   // 69 = A4
+        float cents = 0.0f; // -50..+50 from midiNote
+    };
+
+    /**
+     * @throws std::invalid_argument unless 0 < minFrequency < maxFrequency
+     */
+    explicit PitchDetector(float minFrequency = DEFAULT_MIN_FREQUENCY, float maxFrequency = DEFAULT_MAX_FREQUENCY);
+
+    /**
+     * @brief Size the window for a sample rate and clear the history (allocates)
+     */
+    void prepare(double sampleRate);
+
+    /**
+     * @brief Feed samples; runs a detection every window length of them
+     * @return Number of detections run during this call
+     */
+    int process(const float* samples, int numSamples);
+
+    [[nodiscard]] const Result& getResult() const noexcept { return result_; }
+
+    /**
+     * @brief Samples per detection window (valid after prepare())
+     */
+    [[nodiscard]] int getWindowSize() const noexcept { return windowSize_; }
+
+    /**
+     * @brief Map a frequency to the nearest note
+     * @param referenceA4 Concert pitch in Hz
+     */
+    [[nodiscard]] static Note toNote(float frequency, float referenceA4 = 440.0f) noexcept;
+
+    /**
+     * @brief Sharp-spelled name without octave, e.g. "C#"
+     */
+    [[nodiscard]] static const char* getNoteName(int midiNote) noexcept;
+
+private:
+    void detect();
+
+    float minFrequency_;
+    float maxFrequency_;
+    double sampleRate_ = 0.0;
+    int minLag_ = 0;
+    int maxLag_ = 0;
+    int windowSize_ = 0;
+
+    // Integration window plus the longest lag, oldest first
+    std::vector<float> buffer_;
+    int bufferFill_ = 0;
+    std::vector<float> difference_; // normalised difference per lag
+
+    DotProductKernel dotProduct_;
+    Result result_;
+};
+
+} // namespace finirig::dsp
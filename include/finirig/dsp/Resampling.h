@@ -0,0 +1,29 @@
+#pragma once
+
+#include <vector>
+
+namespace finirig::dsp {
+
+inline constexpr int RESAMPLING_ZERO_CROSSINGS = 32;
+
+/**
+ * @brief Resample a complete buffer with a windowed-sinc interpolator
+ *
+ * Offline quality conversion for impulse responses and other short
+ * buffers: each output sample is a Blackman-windowed sinc sum over
+ * RESAMPLING_ZERO_CROSSINGS input zero crossings either side, with the
+ * cutoff lowered to the target Nyquist when downsampling. Sample values
+ * keep their amplitude, so impulse responses need an extra
+ * sourceRate / targetRate gain to keep their loudness. Allocates and
+ * costs O(length * zero crossings); not for the audio thread.
+ *
+ * @return The resampled signal (a copy of the input if the rates match)
+ */
+[[nodiscard]] std::vector<float> resample(
+    const float* input,
+    int numSamples,
+    double sourceRate,
+    double targetRate
+);
+
+} // namespace finirig::dsp
@@ -0,0 +1,84 @@
+#pragma once
+
+namespace finirig::dsp {
+
+/**
+ * @brief Instruction sets the DSP kernels can be dispatched to
+ */
+enum class SimdLevel {
+    Scalar,
+    Sse2,
+    Avx,
+    Neon
+};
+
+/**
+ * @brief Best instruction set supported by this CPU (detected once)
+ */
+[[nodiscard]] SimdLevel getSimdLevel() noexcept;
+
+/**
+ * @brief Check whether a kernel level can run on this CPU
+ */
+[[nodiscard]] bool isSimdLevelSupported(SimdLevel level) noexcept;
+
+/**
+ * @brief Human-readable name of a level (for diagnostics and benchmarks)
+ */
+[[nodiscard]] const char* getSimdLevelName(SimdLevel level) noexcept;
+
+/**
+ * @brief Gain followed by the branchless Padé soft clipper, in place
+ *
+ * y = c * (27 + c^2) / (27 + 9 c^2) with c = clamp(gain * x, -3, 3).
+ * The curve reaches exactly +/-1 at +/-3, so clamping first matches the
+ * original branchy clipper. Kernels use no FMA, so every level produces
+ * the same result as the scalar reference.
+ */
+using DriveClipKernel = void (*)(float* data, int numSamples, float gain) noexcept;
+
+/**
+ * @brief Get the drive/clip kernel for a level
+ *
+ * Falls back to the scalar kernel if @p level is not supported here.
+ */
+[[nodiscard]] DriveClipKernel getDriveClipKernel(SimdLevel level) noexcept;
+
+/**
+ * @brief Get the drive/clip kernel for the best level on this CPU
+ */
+[[nodiscard]] inline DriveClipKernel getDriveClipKernel() noexcept {
+    return getDriveClipKernel(getSimdLevel());
+}
+
+/**
+ * @brief Dot product of two float arrays (FIR inner loop)
+ *
+ * Vector levels sum in a different order than the scalar loop, so results
+ * agree to rounding error rather than bit for bit.
+ */
+using DotProductKernel = float (*)(const float* a, const float* b, int numSamples) noexcept;
+
+/**
+ * @brief Get the dot product kernel for a level (scalar if unsupported)
+ */
+[[nodiscard]] DotProductKernel getDotProductKernel(SimdLevel level) noexcept;
+
+/**
+ * @brief Get the dot product kernel for the best level on this CPU
+ */
+[[nodiscard]] inline DotProductKernel getDotProductKernel() noexcept {
+    return getDotProductKernel(getSimdLevel());
+}
+
+/**
+ * @brief Scalar Padé soft clip of one sample (reference implementation)
+ */
+[[nodiscard]] inline float softClip(float x) noexcept {
+    constexpr float threshold = 3.0f;
+    const float c = x < -threshold ? -threshold : (x > threshold ? threshold : x);
+    const float c2 = c * c;
+    return c * (27.0f + c2) / (27.0f + 9.0f * c2);
+}
+
+} // namespace finirig::dsp
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include <cstdint>
+#include <vector>
+
+namespace finirig::dsp {
+
+/**
+ * @brief Averaged magnitude spectrum of a mono stream
+ *
+ * Samples are cut into Hann-windowed frames of fftSize with 50% overlap.
+ * Each frame's power spectrum is folded into an exponential average, so
+ * the display settles instead of flickering. Magnitudes are in dB relative
+ * to a full-scale sine, which reads 0 dB in its bin.
+ *
+ * Allocates only in the constructor; meant for a non-realtime analysis
+ * thread, not the audio callback.
+ */
+class SpectrumAnalyzer {
+public:
+    static constexpr int DEFAULT_FFT_ORDER = 12; // 4096 points
+    static constexpr float DEFAULT_AVERAGING = 0.8f;
+
+    // Floor for silent bins
+    static constexpr float MIN_DB = -120.0f;
+
+    /**
+     * @param fftOrder log2 of the frame length (6 to 15)
+     * @param averaging Weight of the previous average per frame (0 = none, below 1)
+     * @throws std::invalid_argument if either is out of range
+     */
+    explicit SpectrumAnalyzer(int fftOrder = DEFAULT_FFT_ORDER, float averaging = DEFAULT_AVERAGING);
+
+    /**
+     * @brief Forget buffered samples and the average
+     */
+    void reset();
+
+    /**
+     * @brief Feed samples; analyses a frame every fftSize / 2 of them
+     * @return Number of frames analysed during this call
+     */
+    int process(const float* samples, int numSamples);
+
+    [[nodiscard]] int getFftSize() const noexcept { return fftSize_; }
+
+    /**
+     * @brief Bins from DC to Nyquist inclusive (fftSize / 2 + 1)
+     */
+    [[nodiscard]] int getNumBins() const noexcept { return fftSize_ / 2 + 1; }
+
+    /**
+     * @brief Centre frequency of a bin
+     */
+    [[nodiscard]] double getBinFrequency(int bin, double sampleRate) const noexcept {
+        return bin * sampleRate / fftSize_;
+    }
+
+    /**
+     * @brief Averaged magnitude per bin, in dB (MIN_DB until the first frame)
+     */
+    [[nodiscard]] const std::vector<float>& getMagnitudesDb() const noexcept { return magnitudesDb_; }
+
+    /**
+     * @brief Frames analysed since construction or reset()
+     */
+    [[nodiscard]] std::uint64_t getFrameCount() const noexcept { return frameCount_; }
+
+private:
+    void analyseFrame();
+
+    juce::dsp::FFT fft_;
+    int fftSize_;
+    int hopSize_;
+    float averaging_;
+
+    std::vector<float> window_;
+    float amplitudeScale_ = 1.0f;  // bin magnitude to sine amplitude
+    std::vector<float> frame_;     // last fftSize samples, oldest first
+    int frameFill_ = 0;
+    std::vector<float> fftBuffer_; // 2 * fftSize, as JUCE requires
+    std::vector<float> power_;     // averaged power per bin
+    std::vector<float> magnitudesDb_;
+    std::uint64_t frameCount_ = 0;
+};
+
+} // namespace finirig::dsp
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "finirig/pedals/PedalBase.h"
+#include "finirig/pedals/WaveDigitalFilter.h"
+#include "finirig/audio/Parameter.h"
+
+namespace finirig::pedals {
+
+/**
+ * @brief Distortion pedal built on a wave digital filter diode clipper
+ *
+ * Models the classic hard-clipping stage: an op-amp gain stage drives a
+ * series resistor into a capacitor and a pair of antiparallel silicon
+ * diodes to ground. The RC low-pass and the diodes are solved together,
+ * so the clipping softens and darkens the way the circuit does.
+ *
+ * Tone sweeps the capacitor; the tree is only re-adapted while the tone
+ * value is moving. Setters may be called from any thread.
+ */
+class DiodeClipperPedal : public PedalBase {
+public:
+    // Samples between smoothing steps / re-adapting the circuit
+    static constexpr int PARAMETER_UPDATE_INTERVAL = 32;
+
+    DiodeClipperPedal();
+    ~DiodeClipperPedal() override = default;
+
+    // Non-copyable (the circuit holds references to its own elements)
+    DiodeClipperPedal(const DiodeClipperPedal&) = delete;
+    DiodeClipperPedal& operator=(const DiodeClipperPedal&) = delete;
+
+    /**
+     * @brief Set drive amount (0.0 to 1.0)
+     */
+    void setDrive(float drive) noexcept;
+    [[nodiscard]] float getDrive() const noexcept { return drive_.getValue(); }
+
+    /**
+     * @brief Set tone control (0.0 = dark, 1.0 = bright)
+     */
+    void setTone(float tone) noexcept;
+    [[nodiscard]] float getTone() const noexcept { return tone_.getValue(); }
+
+    /**
+     * @brief Set output level (0.0 to 1.0)
+     */
+    void setLevel(float level) noexcept;
+    [[nodiscard]] float getLevel() const noexcept { return level_.getValue(); }
+
+    void prepare(double sampleRate) override;
+    void reset() override;
+    [[nodiscard]] juce::String getName() const override { return "Diode Clipper"; }
+
+protected:
+    [[nodiscard]] float processSampleImpl(float input) noexcept override;
+    void processChannelsImpl(
+        float* const* channelData,
+        int numChannels,
+        int numSamples
+    ) noexcept override;
+
+private:
+    using Parameter = finirig::audio::Parameter;
+
+    Parameter drive_{0.5f, 0.0f, 1.0f, Parameter::Smoothing::Exponential};
+    Parameter tone_{0.5f, 0.0f, 1.0f, Parameter::Smoothing::Linear};
+    Parameter level_{0.7f, 0.0f, 1.0f, Parameter::Smoothing::Exponential};
+    int samplesUntilUpdate_ = 0;
+
+    // Audio thread gains, derived from the parameters
+    float inputGain_ = 1.0f;
+    float outputGain_ = 1.0f;
+
+    // Circuit: (source + series resistor) || capacitor, terminated by the diodes
+    wdf::ResistiveVoltageSource source_;
+    wdf::Capacitor capacitor_;
+    wdf::Parallel<wdf::ResistiveVoltageSource, wdf::Capacitor> filter_{source_, capacitor_};
+    wdf::DiodePair<decltype(filter_)> diodes_{filter_};
+
+    void updateParameters() noexcept;
+    void updateGains() noexcept;
+    void updateCapacitor() noexcept;
+    [[nodiscard]] float processCircuit(float input) noexcept;
+};
+
+} // namespace finirig::pedals
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "finirig/pedals/PedalBase.h"
+#include "finirig/audio/Parameter.h"
+#include "finirig/dsp/SimdKernels.h"
 
 namespace finirig::pedals {
 
@@ -9,9 +11,16 @@ namespace finirig::pedals {
  * 
  * Classic overdrive effect with gain and tone controls.
  * Uses soft clipping for smooth distortion.
+ *
+ * Setters may be called from any thread. Parameters are smoothed on the
+ * audio thread every PARAMETER_UPDATE_INTERVAL samples, and the tone
+ * filter is only recomputed while the tone value is actually moving.
  */
 class OverdrivePedal : public PedalBase {
 public:
+    // Samples between smoothing steps / coefficient updates
+    static constexpr int PARAMETER_UPDATE_INTERVAL = 32;
+
     OverdrivePedal();
     ~OverdrivePedal() override = default;
 
@@ -23,7 +32,7 @@ public:
     /**
      * @brief Get current drive amount
      */
-    [[nodiscard]] float getDrive() const noexcept { return drive_; }
+    [[nodiscard]] float getDrive() const noexcept { return drive_.getValue(); }
 
     /**
      * @brief Set tone control (0.0 = dark, 1.0 = bright)
@@ -33,7 +42,7 @@ public:
     /**
      * @brief Get current tone setting
      */
-    [[nodiscard]] float getTone() const noexcept { return tone_; }
+    [[nodiscard]] float getTone() const noexcept { return tone_.getValue(); }
 
     /**
      * @brief Set output level (0.0 to 1.0)
@@ -43,31 +52,40 @@ public:
     /**
      * @brief Get current output level
      */
-    [[nodiscard]] float getLevel() const noexcept { return level_; }
+    [[nodiscard]] float getLevel() const noexcept { return level_.getValue(); }
 
     void prepare(double sampleRate) override;
     void reset() override;
+    [[nodiscard]] juce::String getName() const override { return "Overdrive"; }
 
 protected:
     [[nodiscard]] float processSampleImpl(float input) noexcept override;
+    void processChannelsImpl(
+        float* const* channelData,
+        int numChannels,
+        int numSamples
+    ) noexcept override;
 
 private:
-    float drive_ = 0.5f;
-    float tone_ = 0.5f;
-    float level_ = 0.7f;
+    using Parameter = finirig::audio::Parameter;
+
+    Parameter drive_{0.5f, 0.0f, 1.0f, Parameter::Smoothing::Exponential};
+    Parameter tone_{0.5f, 0.0f, 1.0f, Parameter::Smoothing::Linear};
+    Parameter level_{0.7f, 0.0f, 1.0f, Parameter::Smoothing::Exponential};
+    int samplesUntilUpdate_ = 0;
     
-    // Tone filter coefficients
+    // Tone filter coefficients (audio thread, derived from tone_)
     double sampleRate_ = 44100.0;
     float lowpassCoeff_ = 0.0f;
     float highpassCoeff_ = 0.0f;
     float filterState_ = 0.0f;
     
-    void updateFilterCoefficients();
+    // Vectorised drive + soft clip, chosen for this CPU at construction
+    finirig::dsp::DriveClipKernel driveClip_ = finirig::dsp::getDriveClipKernel();
     
-    /**
-     * @brief Soft clipping function (tanh approximation)
-     */
-    [[nodiscard]] static float softClip(float x) noexcept;
+    void updateParameters() noexcept;
+    void updateFilterCoefficients() noexcept;
+    void processSlice(float* data, int numSamples) noexcept;
 };
 
 } // namespace finirig::pedals
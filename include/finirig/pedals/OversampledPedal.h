@@ -0,0 +1,71 @@
+#pragma once
+
+#include "finirig/pedals/PedalBase.h"
+#include "finirig/dsp/Oversampler.h"
+#include <memory>
+
+namespace finirig::pedals {
+
+/**
+ * @brief Runs another pedal at 2x/4x/8x the host sample rate
+ *
+ * Nonlinear stages generate harmonics above Nyquist that fold back as
+ * inharmonic aliasing. Wrapping them here upsamples each block, runs the
+ * wrapped pedal at the higher rate and filters back down, so only the
+ * stages that need it pay for oversampling. Factor and filter quality are
+ * fixed per instance; build a new wrapper to change them.
+ */
+class OversampledPedal : public PedalBase {
+public:
+    // Base-rate samples pushed through the oversampler per pass
+    static constexpr int MAX_BLOCK_SIZE = 256;
+
+    /**
+     * @brief Wrap a pedal
+     * @param pedal Pedal to run at the oversampled rate
+     * @param factor Oversampling factor: 1, 2, 4 or 8
+     * @param quality Anti-aliasing filter quality
+     * @throws std::invalid_argument for a null pedal or unsupported factor
+     */
+    explicit OversampledPedal(
+        std::unique_ptr<PedalBase> pedal,
+        int factor = 2,
+        finirig::dsp::Oversampler::Quality quality = finirig::dsp::Oversampler::Quality::Normal
+    );
+    ~OversampledPedal() override = default;
+
+    /**
+     * @brief Get the wrapped pedal for parameter access (the wrapper keeps ownership)
+     */
+    [[nodiscard]] PedalBase* getPedal() const noexcept { return pedal_.get(); }
+
+    [[nodiscard]] int getFactor() const noexcept { return oversampler_.getFactor(); }
+    [[nodiscard]] finirig::dsp::Oversampler::Quality getQuality() const noexcept {
+        return oversampler_.getQuality();
+    }
+
+    void prepare(double sampleRate) override;
+    void reset() override;
+
+    /**
+     * @brief Filter delay plus the wrapped pedal's own latency, at the base rate
+     */
+    [[nodiscard]] int getLatencySamples() const noexcept override;
+    [[nodiscard]] juce::String getName() const override;
+
+protected:
+    [[nodiscard]] float processSampleImpl(float input) noexcept override;
+    void processChannelsImpl(
+        float* const* channelData,
+        int numChannels,
+        int numSamples
+    ) noexcept override;
+
+private:
+    std::unique_ptr<PedalBase> pedal_;
+    finirig::dsp::Oversampler oversampler_;
+
+    void processOversampled(float* data, int numSamples) noexcept;
+};
+
+} // namespace finirig::pedals
@@ -30,12 +30,34 @@ public:
      */
     [[nodiscard]] float processSample(float input) noexcept override final;
 
+    /**
+     * @brief Process a block through pedal (when enabled)
+     */
+    void processChannels(
+        float* const* channelData,
+        int numChannels,
+        int numSamples
+    ) noexcept override final;
+
 protected:
     /**
      * @brief Process sample through pedal effect (implemented by subclasses)
      */
     [[nodiscard]] virtual float processSampleImpl(float input) noexcept = 0;
 
+    /**
+     * @brief Process a block through pedal effect
+     *
+     * Defaults to calling processSampleImpl() on the first channel and
+     * copying the result to the others. Subclasses override this with a
+     * native block loop to keep virtual dispatch out of the inner loop.
+     */
+    virtual void processChannelsImpl(
+        float* const* channelData,
+        int numChannels,
+        int numSamples
+    ) noexcept;
+
 private:
     bool enabled_ = true;
 };
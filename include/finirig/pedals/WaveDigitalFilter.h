@@ -0,0 +1,417 @@
+#pragma once
+
+#include <cmath>
+
+/**
+ * @brief Header-only wave digital filter (WDF) building blocks
+ *
+ * A circuit is written as a tree: one-port elements at the leaves,
+ * adaptors that join two subtrees in series or parallel, and a single
+ * nonlinear root. Adaptors are templates over their children and hold
+ * them by reference, so the whole tree is known at compile time and
+ * every per-sample call inlines into one straight-line update.
+ *
+ * Each sample the root pulls the reflected wave up the tree
+ * (reflected()), solves its nonlinearity, and pushes the result back
+ * down (incident()). Every port is adapted, so no node needs to iterate;
+ * the diode roots use the Wright omega function in closed form instead of
+ * per-sample Newton iterations.
+ *
+ * Element values may change between samples (pots, switches), after which
+ * the root's updatePortResistance() must be called to re-adapt the tree.
+ * That costs a pass over the tree, so call it only when a value moved.
+ *
+ * Waves are voltage waves: a = v + R i, b = v - R i, with v = (a + b) / 2.
+ */
+namespace finirig::pedals::wdf {
+
+/**
+ * @brief Wright omega function: the w solving w + log(w) = x
+ *
+ * Piecewise polynomial / asymptotic first guess from D'Angelo et al.,
+ * "Fast approximation of the Lambert W function for virtual analog
+ * modelling" (DAFx 2019), refined by two Newton steps. Above zero the
+ * steps run on w + log(w) - x, which is nearly linear there; below zero on
+ * w - exp(x - w), which stays defined as w approaches 0. Relative error
+ * is below 1e-4 everywhere.
+ */
+[[nodiscard]] inline float wrightOmega(float x) noexcept {
+    constexpr float X1 = -3.341459552768620f;
+    constexpr float X2 = 8.0f;
+    constexpr float A = -1.314293149877800e-3f;
+    constexpr float B = 4.775931364975583e-2f;
+    constexpr float C = 3.631952663804445e-1f;
+    constexpr float D = 6.313183464296682e-1f;
+
+    float w = 0.0f;
+    if (x >= X2) {
+        w = x - std::log(x);
+    } else if (x >= X1) {
+        w = D + x * (C + x * (B + x * A));
+    }
+
+    for (int step = 0; step < 2; ++step) {
+        if (x > 0.0f) {
+            w -= (w + std::log(w) - x) * w / (w + 1.0f);
+        } else {
+            w -= (w - std::exp(x - w)) / (w + 1.0f);
+        }
+    }
+    return w;
+}
+
+/**
+ * @brief Wave state shared by every port
+ */
+class Port {
+public:
+    [[nodiscard]] float getPortResistance() const noexcept { return portResistance_; }
+
+    /**
+     * @brief Voltage across the port after the last sample
+     */
+    [[nodiscard]] float voltage() const noexcept { return 0.5f * (a_ + b_); }
+
+    /**
+     * @brief Current into the port after the last sample
+     */
+    [[nodiscard]] float current() const noexcept { return 0.5f * (a_ - b_) / portResistance_; }
+
+protected:
+    float portResistance_ = 1.0f;
+    float a_ = 0.0f; // incident wave (into the element)
+    float b_ = 0.0f; // reflected wave (out of the element)
+};
+
+/**
+ * @brief Resistor (b = 0)
+ */
+class Resistor : public Port {
+public:
+    explicit Resistor(float resistance) noexcept { setResistance(resistance); }
+
+    void setResistance(float resistance) noexcept { portResistance_ = resistance; }
+
+    void prepare(double) noexcept {}
+    void reset() noexcept { a_ = b_ = 0.0f; }
+    void updatePortResistance() noexcept {}
+
+    float reflected() noexcept { return b_ = 0.0f; }
+    void incident(float a) noexcept { a_ = a; }
+};
+
+/**
+ * @brief Capacitor, discretised with the bilinear transform (b[n] = a[n-1])
+ */
+class Capacitor : public Port {
+public:
+    explicit Capacitor(float capacitance) noexcept : capacitance_(capacitance) { updatePortResistance(); }
+
+    void setCapacitance(float capacitance) noexcept {
+        capacitance_ = capacitance;
+        updatePortResistance();
+    }
+
+    void prepare(double sampleRate) noexcept {
+        samplePeriod_ = static_cast<float>(1.0 / sampleRate);
+        updatePortResistance();
+    }
+    void reset() noexcept { a_ = b_ = state_ = 0.0f; }
+    void updatePortResistance() noexcept { portResistance_ = samplePeriod_ / (2.0f * capacitance_); }
+
+    float reflected() noexcept { return b_ = state_; }
+    void incident(float a) noexcept { a_ = state_ = a; }
+
+private:
+    float capacitance_;
+    float samplePeriod_ = 1.0f / 44100.0f;
+    float state_ = 0.0f;
+};
+
+/**
+ * @brief Inductor, discretised with the bilinear transform (b[n] = -a[n-1])
+ */
+class Inductor : public Port {
+public:
+    explicit Inductor(float inductance) noexcept : inductance_(inductance) { updatePortResistance(); }
+
+    void setInductance(float inductance) noexcept {
+        inductance_ = inductance;
+        updatePortResistance();
+    }
+
+    void prepare(double sampleRate) noexcept {
+        samplePeriod_ = static_cast<float>(1.0 / sampleRate);
+        updatePortResistance();
+    }
+    void reset() noexcept { a_ = b_ = state_ = 0.0f; }
+    void updatePortResistance() noexcept { portResistance_ = 2.0f * inductance_ / samplePeriod_; }
+
+    float reflected() noexcept { return b_ = -state_; }
+    void incident(float a) noexcept { a_ = state_ = a; }
+
+private:
+    float inductance_;
+    float samplePeriod_ = 1.0f / 44100.0f;
+    float state_ = 0.0f;
+};
+
+/**
+ * @brief Voltage source with a series resistance (b = Vs)
+ */
+class ResistiveVoltageSource : public Port {
+public:
+    explicit ResistiveVoltageSource(float resistance) noexcept { setResistance(resistance); }
+
+    void setResistance(float resistance) noexcept { portResistance_ = resistance; }
+    void setVoltage(float voltage) noexcept { sourceVoltage_ = voltage; }
+
+    void prepare(double) noexcept {}
+    void reset() noexcept { a_ = b_ = 0.0f; }
+    void updatePortResistance() noexcept {}
+
+    float reflected() noexcept { return b_ = sourceVoltage_; }
+    void incident(float a) noexcept { a_ = a; }
+
+private:
+    float sourceVoltage_ = 0.0f;
+};
+
+/**
+ * @brief Series connection of two subtrees, adapted towards its parent
+ */
+template <typename Left, typename Right>
+class Series : public Port {
+public:
+    Series(Left& left, Right& right) noexcept : left_(left), right_(right) { adapt(); }
+
+    void prepare(double sampleRate) noexcept {
+        left_.prepare(sampleRate);
+        right_.prepare(sampleRate);
+        adapt();
+    }
+
+    void reset() noexcept {
+        left_.reset();
+        right_.reset();
+        a_ = b_ = leftWave_ = rightWave_ = 0.0f;
+    }
+
+    void updatePortResistance() noexcept {
+        left_.updatePortResistance();
+        right_.updatePortResistance();
+        adapt();
+    }
+
+    float reflected() noexcept {
+        leftWave_ = left_.reflected();
+        rightWave_ = right_.reflected();
+        return b_ = -(leftWave_ + rightWave_);
+    }
+
+    void incident(float a) noexcept {
+        a_ = a;
+        // Port voltages sum to zero around the loop; the mismatch is split
+        // in proportion to the port resistances
+        const float sum = a + leftWave_ + rightWave_;
+        left_.incident(leftWave_ - leftRatio_ * sum);
+        right_.incident(rightWave_ - (1.0f - leftRatio_) * sum);
+    }
+
+private:
+    Left& left_;
+    Right& right_;
+    float leftRatio_ = 0.5f; // resistance share of the left child
+    float leftWave_ = 0.0f;
+    float rightWave_ = 0.0f;
+
+    void adapt() noexcept {
+        portResistance_ = left_.getPortResistance() + right_.getPortResistance();
+        leftRatio_ = left_.getPortResistance() / portResistance_;
+    }
+};
+
+/**
+ * @brief Parallel connection of two subtrees, adapted towards its parent
+ */
+template <typename Left, typename Right>
+class Parallel : public Port {
+public:
+    Parallel(Left& left, Right& right) noexcept : left_(left), right_(right) { adapt(); }
+
+    void prepare(double sampleRate) noexcept {
+        left_.prepare(sampleRate);
+        right_.prepare(sampleRate);
+        adapt();
+    }
+
+    void reset() noexcept {
+        left_.reset();
+        right_.reset();
+        a_ = b_ = leftWave_ = rightWave_ = 0.0f;
+    }
+
+    void updatePortResistance() noexcept {
+        left_.updatePortResistance();
+        right_.updatePortResistance();
+        adapt();
+    }
+
+    float reflected() noexcept {
+        leftWave_ = left_.reflected();
+        rightWave_ = right_.reflected();
+        return b_ = leftRatio_ * leftWave_ + (1.0f - leftRatio_) * rightWave_;
+    }
+
+    void incident(float a) noexcept {
+        a_ = a;
+        // Shared port voltage is (a + b) / 2, each child sees 2v - its wave
+        const float twiceVoltage = a + b_;
+        left_.incident(twiceVoltage - leftWave_);
+        right_.incident(twiceVoltage - rightWave_);
+    }
+
+private:
+    Left& left_;
+    Right& right_;
+    float leftRatio_ = 0.5f; // conductance share of the left child
+    float leftWave_ = 0.0f;
+    float rightWave_ = 0.0f;
+
+    void adapt() noexcept {
+        const float leftConductance = 1.0f / left_.getPortResistance();
+        const float rightConductance = 1.0f / right_.getPortResistance();
+        portResistance_ = 1.0f / (leftConductance + rightConductance);
+        leftRatio_ = leftConductance * portResistance_;
+    }
+};
+
+/**
+ * @brief Shockley diode parameters
+ */
+struct DiodeModel {
+    float saturationCurrent;  // Is, amps
+    float thermalVoltage;     // n * Vt, volts (ideality factor folded in)
+
+    // Small-signal silicon diode (1N4148)
+    static constexpr DiodeModel silicon() noexcept { return {2.52e-9f, 1.752f * 0.02585f}; }
+    // Germanium diode (1N34A)
+    static constexpr DiodeModel germanium() noexcept { return {2.0e-7f, 1.3f * 0.02585f}; }
+    // Red LED
+    static constexpr DiodeModel led() noexcept { return {2.96e-12f, 2.36f * 0.02585f}; }
+};
+
+/**
+ * @brief Common part of the diode roots: owns the tree below and the
+ * constants that only change when the tree is re-adapted
+ */
+template <typename Child>
+class DiodeRoot : public Port {
+public:
+    DiodeRoot(Child& child, DiodeModel model, int numSeries) noexcept
+        : child_(child)
+        , model_(model)
+        , numSeries_(numSeries)
+    {
+        adapt();
+    }
+
+    /**
+     * @brief Change the diode model (re-adapts the tree)
+     */
+    void setModel(DiodeModel model, int numSeries = 1) noexcept {
+        model_ = model;
+        numSeries_ = numSeries;
+        adapt();
+    }
+
+    void prepare(double sampleRate) noexcept {
+        child_.prepare(sampleRate);
+        adapt();
+    }
+
+    void reset() noexcept {
+        child_.reset();
+        a_ = b_ = 0.0f;
+    }
+
+    void updatePortResistance() noexcept {
+        child_.updatePortResistance();
+        adapt();
+    }
+
+protected:
+    Child& child_;
+    DiodeModel model_;
+    int numSeries_;
+
+    // Derived from the port resistance in adapt()
+    float thermalVoltage_ = 0.0f;     // n * Vt of the whole string
+    float inverseThermalVoltage_ = 0.0f;
+    float resistanceCurrent_ = 0.0f;  // R * Is
+    float omegaOffset_ = 0.0f;        // log(R Is / Vt) + R Is / Vt
+
+    void adapt() noexcept {
+        portResistance_ = child_.getPortResistance();
+        thermalVoltage_ = model_.thermalVoltage * static_cast<float>(numSeries_);
+        inverseThermalVoltage_ = 1.0f / thermalVoltage_;
+        resistanceCurrent_ = portResistance_ * model_.saturationCurrent;
+        const float scaled = resistanceCurrent_ * inverseThermalVoltage_;
+        omegaOffset_ = std::log(scaled) + scaled;
+    }
+};
+
+/**
+ * @brief Single diode (anode to the tree) as the root of a tree
+ *
+ * Solves i = Is (exp(v / nVt) - 1) against the tree's port resistance in
+ * closed form. numSeries identical diodes in series act as one diode
+ * with numSeries times the thermal voltage.
+ */
+template <typename Child>
+class Diode : public DiodeRoot<Child> {
+public:
+    explicit Diode(Child& child, DiodeModel model = DiodeModel::silicon(), int numSeries = 1) noexcept
+        : DiodeRoot<Child>(child, model, numSeries)
+    {}
+
+    /**
+     * @brief Run one sample through the tree
+     */
+    void process() noexcept {
+        const float a = this->a_ = this->child_.reflected();
+        this->b_ = a + 2.0f * this->resistanceCurrent_
+            - 2.0f * this->thermalVoltage_ * wrightOmega(this->omegaOffset_ + a * this->inverseThermalVoltage_);
+        this->child_.incident(this->b_);
+    }
+};
+
+/**
+ * @brief Antiparallel diode pair (symmetric clipper) as the root of a tree
+ *
+ * Closed-form solution from Werner et al., "An Improved and Generalized
+ * Diode Clipper Model for Wave Digital Filters" (AES 2015), eq. 18: two
+ * Wright omega evaluations per sample, exact at zero and for large
+ * signals, and odd-symmetric.
+ */
+template <typename Child>
+class DiodePair : public DiodeRoot<Child> {
+public:
+    explicit DiodePair(Child& child, DiodeModel model = DiodeModel::silicon(), int numSeries = 1) noexcept
+        : DiodeRoot<Child>(child, model, numSeries)
+    {}
+
+    /**
+     * @brief Run one sample through the tree
+     */
+    void process() noexcept {
+        const float a = this->a_ = this->child_.reflected();
+        const float magnitude = std::abs(a) * this->inverseThermalVoltage_;
+        const float forward = wrightOmega(this->omegaOffset_ + magnitude);
+        const float reverse = wrightOmega(this->omegaOffset_ - magnitude);
+        this->b_ = a - std::copysign(2.0f * this->thermalVoltage_ * (forward - reverse), a);
+        this->child_.incident(this->b_);
+    }
+};
+
+} // namespace finirig::pedals::wdf
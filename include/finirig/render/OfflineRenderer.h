@@ -0,0 +1,68 @@
+#pragma once
+
+#include <juce_audio_formats/juce_audio_formats.h>
+
+namespace finirig::audio {
+class AudioProcessor;
+}
+
+namespace finirig::render {
+
+/**
+ * @brief Streams an audio file through a processor without an audio device
+ *
+ * Reads, processes and writes in fixed-size chunks through one buffer
+ * allocated up front, so memory use does not depend on the file length.
+ * Not real-time: intended for batch re-amping on headless machines.
+ */
+class OfflineRenderer {
+public:
+    static constexpr int DEFAULT_CHUNK_SIZE = 4096;
+
+    /**
+     * @brief Render statistics
+     */
+    struct Result {
+        juce::int64 numSamples = 0;     ///< Samples rendered per channel
+        double audioSeconds = 0.0;      ///< Duration of the rendered audio
+        double processingSeconds = 0.0; ///< Time spent inside the processor
+        double totalSeconds = 0.0;      ///< Wall time including file I/O
+        int latencySamples = 0;         ///< Processor latency trimmed from the output
+
+        /**
+         * @brief Seconds of audio processed per second of DSP time
+         */
+        [[nodiscard]] double getRealtimeFactor() const noexcept {
+            return processingSeconds > 0.0 ? audioSeconds / processingSeconds : 0.0;
+        }
+    };
+
+    /**
+     * @param chunkSize Samples per read/process/write step
+     */
+    explicit OfflineRenderer(int chunkSize = DEFAULT_CHUNK_SIZE);
+
+    /**
+     * @brief Render the whole of @p reader through @p processor into @p writer
+     *
+     * The processor is prepared at the reader's sample rate and reset first.
+     * Its reported latency is compensated, so the output has the same length
+     * as the input and is time-aligned with it.
+     * @throws std::runtime_error if reading or writing fails
+     */
+    Result render(
+        juce::AudioFormatReader& reader,
+        juce::AudioFormatWriter& writer,
+        finirig::audio::AudioProcessor& processor
+    );
+
+    /**
+     * @brief Get chunk size in samples
+     */
+    [[nodiscard]] int getChunkSize() const noexcept { return chunkSize_; }
+
+private:
+    int chunkSize_;
+};
+
+} // namespace finirig::render
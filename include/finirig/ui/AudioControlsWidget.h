@@ -3,6 +3,7 @@
 #include <QWidget>
 
 QT_BEGIN_NAMESPACE
+class QCheckBox;
 class QPushButton;
 class QLabel;
 class QSlider;
@@ -30,6 +31,7 @@ public:
 signals:
     void startAudioRequested();
     void stopAudioRequested();
+    void pipelinedProcessingToggled(bool enabled);
 
 private slots:
     void onStartStopClicked();
@@ -38,6 +40,7 @@ private:
     void setupUI();
 
     QPushButton* startStopButton_ = nullptr;
+    QCheckBox* pipelinedCheckBox_ = nullptr;
     QLabel* statusLabel_ = nullptr;
     QLabel* sampleRateLabel_ = nullptr;
     QLabel* bufferSizeLabel_ = nullptr;
@@ -5,6 +5,7 @@
 QT_BEGIN_NAMESPACE
 class QLabel;
 class QComboBox;
+class QPushButton;
 QT_END_NAMESPACE
 
 namespace finirig::audio {
@@ -31,7 +32,9 @@ public:
     void setAudioEngine(finirig::audio::AudioEngine* engine);
 
     /**
-     * @brief Refresh device lists
+     * @brief Ask the device catalogue for a rescan; returns immediately
+     *
+     * The combos are repopulated when the scan reports a change.
      */
     void refreshDevices();
 
@@ -40,28 +43,47 @@ public:
      */
     void updateDeviceInfo();
 
+    /**
+     * @brief Update DSP load display (cheap; call from the meter timer)
+     */
+    void updateLoadInfo();
+
 signals:
     void inputDeviceChanged(const QString& deviceName);
     void outputDeviceChanged(const QString& deviceName);
 
+    /**
+     * @brief Emitted from the device catalogue thread after a scan changed the lists
+     *
+     * Connected queued to populateDeviceLists(), so the combos are only
+     * touched on the UI thread.
+     */
+    void deviceListChanged();
+
 private slots:
     void onInputDeviceChanged(int index);
     void onOutputDeviceChanged(int index);
 
+    // Fill the combos from the catalogue's cached snapshot
+    void populateDeviceLists();
+
 private:
     void setupUI();
-    void populateDeviceLists();
 
     finirig::audio::AudioEngine* audioEngine_ = nullptr;
     
     QComboBox* inputDeviceCombo_ = nullptr;
     QComboBox* outputDeviceCombo_ = nullptr;
+    QPushButton* rescanButton_ = nullptr;
     QLabel* deviceNameLabel_ = nullptr;
     QLabel* deviceTypeLabel_ = nullptr;
     QLabel* sampleRateLabel_ = nullptr;
     QLabel* bufferSizeLabel_ = nullptr;
     QLabel* inputChannelsLabel_ = nullptr;
     QLabel* outputChannelsLabel_ = nullptr;
+    QLabel* latencyLabel_ = nullptr;
+    QLabel* dspLoadLabel_ = nullptr;
+    QLabel* overrunsLabel_ = nullptr;
 };
 
 } // namespace finirig::ui
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "finirig/audio/SignalChain.h"
+#include <QWidget>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+class QTableWidget;
+class QPushButton;
+QT_END_NAMESPACE
+
+namespace finirig::ui {
+
+/**
+ * @brief Per-stage DSP profiling panel
+ *
+ * Shows how much of the realtime budget each stage of the signal chain
+ * uses, so an over-budget preset can be traced to a single pedal or amp.
+ */
+class DiagnosticsWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit DiagnosticsWidget(QWidget* parent = nullptr);
+    ~DiagnosticsWidget() override = default;
+
+    /**
+     * @brief Set the chain to monitor (not owned; nullptr to detach)
+     */
+    void setSignalChain(finirig::audio::SignalChain* chain);
+
+    /**
+     * @brief Refresh the table from a fresh snapshot of the chain
+     * @param sampleRate Device sample rate, used to convert time to load
+     */
+    void updateStatistics(double sampleRate);
+
+private slots:
+    void onResetClicked();
+
+private:
+    void setupUI();
+
+    finirig::audio::SignalChain* signalChain_ = nullptr;
+    QTableWidget* stageTable_ = nullptr;
+    QPushButton* resetButton_ = nullptr;
+};
+
+} // namespace finirig::ui
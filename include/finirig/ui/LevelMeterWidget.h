@@ -1,41 +1,120 @@
 #pragma once
 
+#include <QElapsedTimer>
 #include <QWidget>
-#include <QTimer>
+#include <QPixmap>
+#include <QRect>
+#include <array>
+
+class QTimer;
 
 namespace finirig::ui {
 
 /**
  * @brief Audio level meter widget
- * 
- * Displays audio level with visual feedback (VU meter style)
+ *
+ * Displays one bar per channel (up to two) under a shared label. Each bar
+ * shows the RMS level, a held peak line that decays on its own after a
+ * hold time, and a clip indicator above it that stays lit until the meter
+ * is clicked or reset.
+ *
+ * Drawing is cached: the static parts (background, scale, label) and the
+ * lit gradient bar are rendered once per size into pixmaps, and a new
+ * value only repaints the strip between the old and new bar and peak
+ * positions, and only once it moves by at least one pixel.
  */
 class LevelMeterWidget : public QWidget {
     Q_OBJECT
 
 public:
-    explicit LevelMeterWidget(const QString& label, QWidget* parent = nullptr);
+    static constexpr int MAX_CHANNELS = 2;
+
+    explicit LevelMeterWidget(const QString& label, int numChannels = 1, QWidget* parent = nullptr);
     ~LevelMeterWidget() override = default;
 
     /**
-     * @brief Update the level (0.0 to 1.0, or dB value)
+     * @brief Number of bars shown (clamped to 1 to MAX_CHANNELS)
+     *
+     * Lays the meter out again only when the count changes.
+     */
+    void setNumChannels(int numChannels);
+
+    /**
+     * @brief Show a new RMS level and peak for one channel (0.0 to 1.0, linear)
+     *
+     * A peak at or above the held one replaces it and restarts that
+     * channel's hold; after a lower one the held line falls once the hold
+     * is over. A clipped block lights the channel's clip indicator until
+     * it is cleared. Repaints only what moved on screen.
      */
-    void setLevel(float level);
+    void setLevels(int channel, float rms, float peak, bool clipped);
 
     /**
-     * @brief Set peak level
+     * @brief Drop levels and held peaks to zero and clear the clip indicators
      */
-    void setPeak(float peak);
+    void reset();
 
 protected:
     void paintEvent(QPaintEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
+
+    // A click clears the clip indicators
+    void mousePressEvent(QMouseEvent* event) override;
+
+private slots:
+    void decayPeak();
 
 private:
+    static constexpr int PEAK_HOLD_MS = 1000;
+    static constexpr int PEAK_DECAY_INTERVAL_MS = 33;
+
+    // Full scale per second once the hold time is over
+    static constexpr float PEAK_DECAY_PER_SECOND = 0.5f;
+
+    // Lay out the meter and render the cached pixmaps for the current size
+    void rebuildCache();
+
+    // Repaint whatever moved since the last paint
+    void refresh();
+
+    // Loudest RMS level across the shown channels
+    [[nodiscard]] float maxLevel() const;
+
+    [[nodiscard]] int toPixels(float value) const;
+    [[nodiscard]] QRect barRect(int channel, int pixels) const;
+    [[nodiscard]] QRect peakRect(int channel, int pixels) const;
+
+    struct Channel {
+        float level = 0.0f;
+        float peak = 0.0f;
+        bool clipped = false;
+
+        // The held peak starts to fall at this time on clock_
+        qint64 holdUntilMs = 0;
+
+        // What is on screen, in meter pixels
+        int levelPixels = 0;
+        int peakPixels = 0;
+        bool clipShown = false;
+
+        QRect meterRect;
+        QRect clipRect;
+    };
+
     QString label_;
-    float level_ = 0.0f;
-    float peak_ = 0.0f;
-    QTimer* peakHoldTimer_ = nullptr;
+    int numChannels_ = 1;
+    std::array<Channel, MAX_CHANNELS> channels_{};
+    // Ticks while any held peak is above its level; each channel keeps
+    // its own hold time
+    QTimer* peakDecayTimer_ = nullptr;
+    QElapsedTimer clock_;
+
+    // Level text on screen, in whole percent of the loudest channel
+    int levelPercent_ = 0;
+
+    QRect levelTextRect_;
+    QPixmap unlit_;
+    QPixmap lit_;
 };
 
 } // namespace finirig::ui
-
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "finirig/audio/AudioTap.h"
 #include <QMainWindow>
 #include <memory>
 
@@ -7,11 +8,14 @@ QT_BEGIN_NAMESPACE
 class QVBoxLayout;
 class QHBoxLayout;
 class QLabel;
+class QProgressBar;
+class QThreadPool;
 class QTimer;
 QT_END_NAMESPACE
 
 namespace finirig::audio {
 class AudioEngine;
+class SignalChain;
 }
 
 namespace finirig::ui {
@@ -19,35 +23,74 @@ namespace finirig::ui {
 class AudioControlsWidget;
 class LevelMeterWidget;
 class DeviceInfoWidget;
+class DiagnosticsWidget;
+class SpectrumWidget;
+class StartupTimeline;
+class TunerWidget;
 
 /**
  * @brief Main application window
  * 
  * Qt-based main window for the standalone application.
+ *
+ * Startup is staged so the window appears at once: the audio device is
+ * opened and the default chain built on a startup thread pool, with a
+ * progress bar in the status bar, and the engine controls are enabled when
+ * both are done. Milestones go to the StartupTimeline, which is logged
+ * when audio is ready.
  */
 class MainWindow : public QMainWindow {
     Q_OBJECT
 
 public:
-    explicit MainWindow(QWidget* parent = nullptr);
+    /**
+     * @param timeline Startup milestones; must outlive the window
+     */
+    explicit MainWindow(StartupTimeline& timeline, QWidget* parent = nullptr);
     ~MainWindow() override;
 
 private slots:
     void onStartAudio();
     void onStopAudio();
+    void onPipelinedProcessingToggled(bool enabled);
+    void onAnalysisSourceChanged(finirig::audio::AudioTap::Point point);
     void updateLevelMeters();
+    void updateAnalysis();
+    void updateDiagnostics();
 
 private:
     void setupUI();
+
+    // Start the device open and chain build on the startup pool
     void setupAudioEngine();
 
+    // UI thread, once per startup job; the last one hands over to the engine
+    void onStartupJobFinished();
+
+    StartupTimeline& timeline_;
     std::unique_ptr<finirig::audio::AudioEngine> audioEngine_;
     AudioControlsWidget* audioControlsWidget_ = nullptr;
     LevelMeterWidget* inputLevelMeter_ = nullptr;
     LevelMeterWidget* outputLevelMeter_ = nullptr;
     DeviceInfoWidget* deviceInfoWidget_ = nullptr;
+    DiagnosticsWidget* diagnosticsWidget_ = nullptr;
+    TunerWidget* tunerWidget_ = nullptr;
+    SpectrumWidget* spectrumWidget_ = nullptr;
     QLabel* iconLabel_ = nullptr;
     QTimer* levelUpdateTimer_ = nullptr;
+    QTimer* diagnosticsTimer_ = nullptr;
+    QProgressBar* startupProgress_ = nullptr;
+    QThreadPool* startupPool_ = nullptr;
+
+    // Startup hand-over: the chain is written by its startup job and only
+    // read here after that job's completion has been delivered
+    std::unique_ptr<finirig::audio::SignalChain> startupChain_;
+    int pendingStartupJobs_ = 0;
+    bool deviceOpened_ = false;
+    bool awaitingFirstAudio_ = false;
+    
+    // Owned by audioEngine_; only replaced from this window
+    finirig::audio::SignalChain* signalChain_ = nullptr;
 };
 
 } // namespace finirig::ui
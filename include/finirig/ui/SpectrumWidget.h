@@ -0,0 +1,44 @@
+#pragma once
+
+#include <QWidget>
+#include <vector>
+
+namespace finirig::ui {
+
+/**
+ * @brief Averaged magnitude spectrum on a log-frequency axis
+ *
+ * Bins are folded per pixel column (loudest bin wins), so drawing cost
+ * depends on the widget width rather than the FFT size.
+ */
+class SpectrumWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit SpectrumWidget(QWidget* parent = nullptr);
+    ~SpectrumWidget() override = default;
+
+    /**
+     * @brief Show a new spectrum (dB per bin from DC) and repaint
+     */
+    void setSpectrum(const std::vector<float>& magnitudesDb, double binWidthHz);
+
+    /**
+     * @brief Clear the trace
+     */
+    void clear();
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+
+private:
+    static constexpr double MIN_FREQUENCY = 20.0;
+    static constexpr double MAX_FREQUENCY = 20000.0;
+    static constexpr float MIN_DB = -100.0f;
+    static constexpr float MAX_DB = 0.0f;
+
+    std::vector<float> magnitudesDb_;
+    double binWidthHz_ = 0.0;
+};
+
+} // namespace finirig::ui
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <QElapsedTimer>
+#include <QString>
+#include <QVector>
+
+namespace finirig::ui {
+
+/**
+ * @brief Milestones of application startup, timed from launch
+ *
+ * Created first thing in main(), so every mark is the wall time since the
+ * process entered main. Marks are recorded on the UI thread; background
+ * startup jobs read elapsedMs() when they finish and hand the value over
+ * with their result.
+ */
+class StartupTimeline {
+public:
+    // Launch to audio ready (device open, chain installed) should stay below this
+    static constexpr qint64 AUDIO_READY_BUDGET_MS = 1000;
+
+    StartupTimeline();
+
+    /**
+     * @brief Milliseconds since launch (safe from any thread)
+     */
+    [[nodiscard]] qint64 elapsedMs() const { return clock_.elapsed(); }
+
+    /**
+     * @brief Record a milestone reached now (UI thread)
+     */
+    void mark(const QString& stage) { mark(stage, elapsedMs()); }
+
+    /**
+     * @brief Record a milestone reached at a time taken earlier (UI thread)
+     */
+    void mark(const QString& stage, qint64 atMs);
+
+    /**
+     * @brief Time of a recorded milestone, or -1 if it was not reached
+     */
+    [[nodiscard]] qint64 timeOf(const QString& stage) const;
+
+    /**
+     * @brief One line per milestone, in the order they were reached
+     */
+    [[nodiscard]] QString report() const;
+
+private:
+    struct Milestone {
+        QString stage;
+        qint64 atMs = 0;
+    };
+
+    QElapsedTimer clock_;
+    QVector<Milestone> milestones_;
+};
+
+} // namespace finirig::ui
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "finirig/audio/AudioTap.h"
+#include "finirig/dsp/PitchDetector.h"
+#include <QWidget>
+
+QT_BEGIN_NAMESPACE
+class QComboBox;
+class QLabel;
+QT_END_NAMESPACE
+
+namespace finirig::ui {
+
+/**
+ * @brief Chromatic tuner readout and analysis source selector
+ *
+ * Shows the nearest note, the offset in cents and the detected frequency.
+ * The source box chooses whether analysis listens to the dry input (for
+ * tuning while the rig keeps running) or the processed output.
+ */
+class TunerWidget : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit TunerWidget(QWidget* parent = nullptr);
+    ~TunerWidget() override = default;
+
+    /**
+     * @brief Show the latest detection (unvoiced clears the readout)
+     */
+    void setPitch(const finirig::dsp::PitchDetector::Result& pitch);
+
+    /**
+     * @brief Select a source without emitting analysisSourceChanged()
+     */
+    void setAnalysisSource(finirig::audio::AudioTap::Point point);
+
+signals:
+    void analysisSourceChanged(finirig::audio::AudioTap::Point point);
+
+private slots:
+    void onSourceIndexChanged(int index);
+
+private:
+    // Within this many cents the note reads as in tune
+    static constexpr float IN_TUNE_CENTS = 3.0f;
+
+    void setupUI();
+
+    QComboBox* sourceComboBox_ = nullptr;
+    QLabel* noteLabel_ = nullptr;
+    QLabel* centsLabel_ = nullptr;
+    QLabel* frequencyLabel_ = nullptr;
+};
+
+} // namespace finirig::ui
@@ -1,7 +1,7 @@
 #include "finirig/amps/AmpModel.h"
 
 // Base implementation is mostly abstract
-// Concrete amp models will inherit and implement
+// Concrete amp models (see TubeAmp) inherit and implement
 
 namespace finirig::amps {
 
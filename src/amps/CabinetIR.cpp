@@ -0,0 +1,357 @@
+#include "finirig/amps/CabinetIR.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace finirig::amps {
+
+using finirig::dsp::PartitionedConvolver;
+
+namespace {
+
+constexpr double DEFAULT_SAMPLE_RATE = 44100.0;
+
+// An empty convolver stands for "no IR" so clearing can crossfade too
+bool isWet(const PartitionedConvolver* convolver) noexcept {
+    return convolver != nullptr && convolver->getImpulseResponseLength() > 0;
+}
+
+} // namespace
+
+/**
+ * @brief State shared between the cabinet, the loader thread and the audio thread
+ *
+ * Control-side fields are guarded by mutex. The audio thread only touches
+ * the atomics: it takes from pending and puts spent convolvers into an
+ * empty retired slot; publishers delete whatever they find there.
+ */
+struct CabinetIR::Handoff {
+    static constexpr int RETIRE_SLOTS = 4;
+
+    std::mutex mutex;
+    uint64_t generation = 0;       // bumped by every load, set and clear
+    double sampleRate = 0.0;       // rate given to prepare(), 0 before
+    double kernelSampleRate = 0.0; // rate of the newest published kernel
+    juce::File file;               // current source, reloaded on a rate change
+    std::shared_ptr<const std::vector<float>> samples;
+    bool normaliseSamples = false; // reader loads are normalised like files
+
+    std::atomic<int> length{0};
+    std::atomic<double> sourceSampleRate{0.0};
+
+    std::atomic<PartitionedConvolver*> pending{nullptr};
+    std::array<std::atomic<PartitionedConvolver*>, RETIRE_SLOTS> retired{};
+
+    ~Handoff() {
+        delete pending.load();
+        collectRetired();
+    }
+
+    [[nodiscard]] bool hasSource() const {
+        return file.getFullPathName().isNotEmpty() || samples != nullptr;
+    }
+
+    // Caller holds mutex
+    void publish(const std::shared_ptr<const ImpulseResponseLoader::Prepared>& prepared, int partitionSize) {
+        collectRetired();
+
+        auto convolver = std::make_unique<PartitionedConvolver>(partitionSize);
+        if (prepared) {
+            convolver->setKernel(prepared->kernel);
+        }
+
+        length.store(prepared ? prepared->kernel->length : 0, std::memory_order_relaxed);
+        sourceSampleRate.store(prepared ? prepared->sourceSampleRate : 0.0, std::memory_order_relaxed);
+        kernelSampleRate = prepared ? prepared->sampleRate : 0.0;
+
+        // One not yet taken by the audio thread is simply superseded
+        delete pending.exchange(convolver.release(), std::memory_order_acq_rel);
+    }
+
+    void collectRetired() {
+        for (auto& slot : retired) {
+            delete slot.exchange(nullptr, std::memory_order_acquire);
+        }
+    }
+
+    [[nodiscard]] bool hasFreeRetireSlot() const noexcept {
+        return std::any_of(retired.begin(), retired.end(), [](const auto& slot) {
+            return slot.load(std::memory_order_relaxed) == nullptr;
+        });
+    }
+
+    // Audio thread; only it fills slots, so a free slot seen earlier is still free
+    void retire(PartitionedConvolver* convolver) noexcept {
+        for (auto& slot : retired) {
+            PartitionedConvolver* expected = nullptr;
+            if (slot.compare_exchange_strong(expected, convolver, std::memory_order_release)) {
+                return;
+            }
+        }
+    }
+
+    static ImpulseResponseLoader::Callback makeCallback(
+        std::weak_ptr<Handoff> weakHandoff,
+        uint64_t generation,
+        int partitionSize,
+        LoadCallback onComplete
+    ) {
+        return [weakHandoff, generation, partitionSize, onComplete = std::move(onComplete)](
+                   std::shared_ptr<const ImpulseResponseLoader::Prepared> prepared,
+                   const juce::String& error
+               ) {
+            if (auto handoff = weakHandoff.lock(); handoff && prepared) {
+                std::lock_guard<std::mutex> lock(handoff->mutex);
+                // A later load or clear wins; a kernel for a stale rate is
+                // dropped because prepare() already asked for a reload
+                const bool current = generation == handoff->generation;
+                const bool rateMatches = handoff->sampleRate <= 0.0
+                    || prepared->sampleRate == handoff->sampleRate;
+                if (current && rateMatches) {
+                    handoff->publish(prepared, partitionSize);
+                }
+            }
+            if (onComplete) {
+                onComplete(prepared != nullptr, error);
+            }
+        };
+    }
+};
+
+CabinetIR::CabinetIR(int partitionSize, std::shared_ptr<ImpulseResponseLoader> loader)
+    : partitionSize_(partitionSize)
+    , loader_(loader ? std::move(loader) : ImpulseResponseLoader::getShared())
+    , handoff_(std::make_shared<Handoff>())
+    , active_(new PartitionedConvolver(partitionSize))
+    , fadeLength_(static_cast<int>(std::lround(FADE_SECONDS * DEFAULT_SAMPLE_RATE)))
+{
+}
+
+CabinetIR::~CabinetIR() {
+    delete active_;
+    delete fadingOut_;
+}
+
+void CabinetIR::loadImpulseResponse(const juce::File& file) {
+    double sampleRate = 0.0;
+    {
+        std::lock_guard<std::mutex> lock(handoff_->mutex);
+        sampleRate = handoff_->sampleRate;
+    }
+
+    auto prepared = loader_->load(file, sampleRate, partitionSize_);
+
+    std::lock_guard<std::mutex> lock(handoff_->mutex);
+    ++handoff_->generation;
+    handoff_->file = file;
+    handoff_->samples.reset();
+    handoff_->publish(prepared, partitionSize_);
+}
+
+void CabinetIR::loadImpulseResponse(juce::AudioFormatReader& reader) {
+    setSamples(
+        std::make_shared<const std::vector<float>>(ImpulseResponseLoader::read(reader)),
+        reader.sampleRate,
+        true
+    );
+}
+
+void CabinetIR::loadImpulseResponseAsync(const juce::File& file, LoadCallback onComplete) {
+    std::lock_guard<std::mutex> lock(handoff_->mutex);
+    const auto generation = ++handoff_->generation;
+    handoff_->file = file;
+    handoff_->samples.reset();
+
+    loader_->loadAsync(
+        file,
+        handoff_->sampleRate,
+        partitionSize_,
+        Handoff::makeCallback(handoff_, generation, partitionSize_, std::move(onComplete))
+    );
+}
+
+void CabinetIR::setImpulseResponse(const float* samples, int numSamples, double sampleRate) {
+    // Memory IRs are used at their own level; only the rate is matched
+    setSamples(
+        std::make_shared<const std::vector<float>>(samples, samples + std::max(0, numSamples)),
+        sampleRate,
+        false
+    );
+}
+
+void CabinetIR::setSamples(std::shared_ptr<const std::vector<float>> samples, double sampleRate, bool normalise) {
+    double targetRate = 0.0;
+    {
+        std::lock_guard<std::mutex> lock(handoff_->mutex);
+        targetRate = handoff_->sampleRate;
+    }
+
+    auto prepared = ImpulseResponseLoader::prepare(
+        samples->data(),
+        static_cast<int>(samples->size()),
+        sampleRate,
+        targetRate,
+        partitionSize_,
+        normalise
+    );
+
+    std::lock_guard<std::mutex> lock(handoff_->mutex);
+    ++handoff_->generation;
+    handoff_->file = juce::File();
+    handoff_->samples = std::move(samples);
+    handoff_->normaliseSamples = normalise;
+    handoff_->publish(prepared, partitionSize_);
+}
+
+void CabinetIR::clearImpulseResponse() {
+    std::lock_guard<std::mutex> lock(handoff_->mutex);
+    ++handoff_->generation;
+    handoff_->file = juce::File();
+    handoff_->samples.reset();
+    handoff_->publish(nullptr, partitionSize_);
+}
+
+bool CabinetIR::hasImpulseResponse() const noexcept {
+    return handoff_->length.load(std::memory_order_relaxed) > 0;
+}
+
+int CabinetIR::getImpulseResponseLength() const noexcept {
+    return handoff_->length.load(std::memory_order_relaxed);
+}
+
+double CabinetIR::getImpulseResponseSampleRate() const noexcept {
+    return handoff_->sourceSampleRate.load(std::memory_order_relaxed);
+}
+
+void CabinetIR::processChannels(
+    float* const* channelData,
+    int numChannels,
+    int numSamples
+) noexcept {
+    if (numChannels <= 0) {
+        return;
+    }
+
+    takePendingConvolver();
+
+    float* data = channelData[0];
+    if (fadingOut_ != nullptr) {
+        processCrossfade(data, numSamples);
+    } else if (isWet(active_)) {
+        active_->process(data, numSamples);
+    } else {
+        return;
+    }
+
+    for (int channel = 1; channel < numChannels; ++channel) {
+        juce::FloatVectorOperations::copy(channelData[channel], data, numSamples);
+    }
+}
+
+void CabinetIR::takePendingConvolver() noexcept {
+    // One swap at a time, and only with a retire slot for the outgoing one
+    if (fadingOut_ != nullptr || handoff_->pending.load(std::memory_order_relaxed) == nullptr) {
+        return;
+    }
+    if (!handoff_->hasFreeRetireSlot()) {
+        return;
+    }
+
+    auto* next = handoff_->pending.exchange(nullptr, std::memory_order_acq_rel);
+    if (next == nullptr) {
+        return;
+    }
+
+    if (isWet(active_)) {
+        fadingOut_ = active_;
+        fadePosition_ = 0;
+    } else {
+        // Nothing audible to fade from
+        handoff_->retire(active_);
+    }
+    active_ = next;
+}
+
+void CabinetIR::processCrossfade(float* data, int numSamples) noexcept {
+    const bool wet = isWet(active_);
+    const float fadeStep = 1.0f / static_cast<float>(fadeLength_);
+
+    for (int offset = 0; offset < numSamples; offset += SCRATCH_SIZE) {
+        const int count = std::min(SCRATCH_SIZE, numSamples - offset);
+        float* block = data + offset;
+
+        std::copy(block, block + count, scratch_.begin());
+        fadingOut_->process(scratch_.data(), count);
+        if (wet) {
+            active_->process(block, count);
+        }
+
+        // Linear: consecutive IRs are mostly correlated, so this holds level
+        for (int i = 0; i < count; ++i) {
+            const float gain = std::min(1.0f, static_cast<float>(fadePosition_ + i) * fadeStep);
+            block[i] = scratch_[static_cast<size_t>(i)] + gain * (block[i] - scratch_[static_cast<size_t>(i)]);
+        }
+        fadePosition_ = std::min(fadeLength_, fadePosition_ + count);
+    }
+
+    if (fadePosition_ >= fadeLength_) {
+        handoff_->retire(fadingOut_);
+        fadingOut_ = nullptr;
+    }
+}
+
+void CabinetIR::prepare(double sampleRate) {
+    fadeLength_ = std::max(1, static_cast<int>(std::lround(FADE_SECONDS * sampleRate)));
+
+    std::lock_guard<std::mutex> lock(handoff_->mutex);
+
+    // Not processing, so swap directly instead of fading
+    handoff_->collectRetired();
+    if (auto* next = handoff_->pending.exchange(nullptr, std::memory_order_acq_rel)) {
+        delete active_;
+        active_ = next;
+    }
+    delete fadingOut_;
+    fadingOut_ = nullptr;
+
+    // Also reload when a load still in flight targets the old rate
+    const bool rateChanged = sampleRate != handoff_->kernelSampleRate || sampleRate != handoff_->sampleRate;
+    handoff_->sampleRate = sampleRate;
+    if (rateChanged && handoff_->hasSource()) {
+        requestReload(sampleRate);
+    }
+
+    active_->reset();
+}
+
+void CabinetIR::reset() {
+    if (fadingOut_ != nullptr) {
+        delete fadingOut_;
+        fadingOut_ = nullptr;
+    }
+    active_->reset();
+}
+
+void CabinetIR::requestReload(double sampleRate) {
+    // Caller holds handoff_->mutex. Same generation: this continues the
+    // current source rather than replacing it
+    auto callback = Handoff::makeCallback(handoff_, handoff_->generation, partitionSize_, {});
+
+    if (handoff_->samples) {
+        loader_->prepareAsync(
+            handoff_->samples,
+            handoff_->sourceSampleRate.load(std::memory_order_relaxed),
+            sampleRate,
+            partitionSize_,
+            handoff_->normaliseSamples,
+            std::move(callback)
+        );
+    } else {
+        loader_->loadAsync(handoff_->file, sampleRate, partitionSize_, std::move(callback));
+    }
+}
+
+} // namespace finirig::amps
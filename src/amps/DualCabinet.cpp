@@ -0,0 +1,63 @@
+#include "finirig/amps/DualCabinet.h"
+#include <algorithm>
+
+namespace finirig::amps {
+
+DualCabinet::DualCabinet(int partitionSize, std::shared_ptr<ImpulseResponseLoader> loader)
+    : left_(partitionSize, loader)
+    , right_(partitionSize, loader)
+    , scratch_(std::make_unique<std::array<float, SCRATCH_SIZE>>())
+{
+}
+
+DualCabinet::~DualCabinet() = default;
+
+void DualCabinet::processChannels(
+    float* const* channelData,
+    int numChannels,
+    int numSamples
+) noexcept {
+    if (numChannels <= 0) {
+        return;
+    }
+
+    if (numChannels > 1) {
+        float* leftChannel[] = {channelData[0]};
+        float* rightChannel[] = {channelData[1]};
+        left_.processChannels(leftChannel, 1, numSamples);
+        right_.processChannels(rightChannel, 1, numSamples);
+
+        // Any further channels alternate left / right
+        for (int channel = 2; channel < numChannels; ++channel) {
+            juce::FloatVectorOperations::copy(channelData[channel], channelData[channel % 2], numSamples);
+        }
+        return;
+    }
+
+    // Mono destination: average the two cabinets
+    float* scratch = scratch_->data();
+    float* scratchChannel[] = {scratch};
+    for (int offset = 0; offset < numSamples; offset += SCRATCH_SIZE) {
+        const int count = std::min(SCRATCH_SIZE, numSamples - offset);
+        float* data = channelData[0] + offset;
+        float* dataChannel[] = {data};
+
+        juce::FloatVectorOperations::copy(scratch, data, count);
+        left_.processChannels(dataChannel, 1, count);
+        right_.processChannels(scratchChannel, 1, count);
+        juce::FloatVectorOperations::add(data, scratch, count);
+        juce::FloatVectorOperations::multiply(data, 0.5f, count);
+    }
+}
+
+void DualCabinet::prepare(double sampleRate) {
+    left_.prepare(sampleRate);
+    right_.prepare(sampleRate);
+}
+
+void DualCabinet::reset() {
+    left_.reset();
+    right_.reset();
+}
+
+} // namespace finirig::amps
@@ -0,0 +1,234 @@
+#include "finirig/amps/ImpulseResponseLoader.h"
+#include "finirig/dsp/Resampling.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace finirig::amps {
+
+ImpulseResponseLoader::ImpulseResponseLoader()
+    : worker_([this] { run(); })
+{
+}
+
+ImpulseResponseLoader::~ImpulseResponseLoader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wakeUp_.notify_all();
+    worker_.join();
+}
+
+std::shared_ptr<ImpulseResponseLoader> ImpulseResponseLoader::getShared() {
+    static const auto shared = std::make_shared<ImpulseResponseLoader>();
+    return shared;
+}
+
+void ImpulseResponseLoader::loadAsync(
+    const juce::File& file,
+    double sampleRate,
+    int partitionSize,
+    Callback onComplete
+) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        jobs_.push_back([this, file, sampleRate, partitionSize, onComplete = std::move(onComplete)] {
+            std::shared_ptr<const Prepared> prepared;
+            juce::String error;
+            try {
+                prepared = load(file, sampleRate, partitionSize);
+            } catch (const std::exception& exception) {
+                error = exception.what();
+            }
+            if (onComplete) {
+                onComplete(std::move(prepared), error);
+            }
+        });
+    }
+    wakeUp_.notify_one();
+}
+
+void ImpulseResponseLoader::prepareAsync(
+    std::shared_ptr<const std::vector<float>> samples,
+    double sourceSampleRate,
+    double sampleRate,
+    int partitionSize,
+    bool normalise,
+    Callback onComplete
+) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        jobs_.push_back([samples = std::move(samples), sourceSampleRate, sampleRate, partitionSize, normalise,
+                         onComplete = std::move(onComplete)] {
+            std::shared_ptr<const Prepared> prepared;
+            juce::String error;
+            try {
+                prepared = prepare(
+                    samples->data(),
+                    static_cast<int>(samples->size()),
+                    sourceSampleRate,
+                    sampleRate,
+                    partitionSize,
+                    normalise
+                );
+            } catch (const std::exception& exception) {
+                error = exception.what();
+            }
+            if (onComplete) {
+                onComplete(std::move(prepared), error);
+            }
+        });
+    }
+    wakeUp_.notify_one();
+}
+
+std::shared_ptr<const ImpulseResponseLoader::Prepared> ImpulseResponseLoader::load(
+    const juce::File& file,
+    double sampleRate,
+    int partitionSize
+) {
+    const auto key = makeCacheKey(file, sampleRate, partitionSize);
+    if (auto cached = findCached(key)) {
+        return cached;
+    }
+
+    juce::AudioFormatManager formatManager;
+    formatManager.registerBasicFormats();
+
+    std::unique_ptr<juce::AudioFormatReader> reader(formatManager.createReaderFor(file));
+    if (!reader) {
+        throw std::runtime_error(
+            "Cannot read impulse response: " + file.getFullPathName().toStdString()
+        );
+    }
+
+    const auto samples = read(*reader);
+    auto prepared = prepare(
+        samples.data(),
+        static_cast<int>(samples.size()),
+        reader->sampleRate,
+        sampleRate,
+        partitionSize,
+        true
+    );
+    storeCached(key, prepared);
+    return prepared;
+}
+
+std::vector<float> ImpulseResponseLoader::read(juce::AudioFormatReader& reader) {
+    const auto maxLength = static_cast<juce::int64>(std::ceil(MAX_IR_SECONDS * reader.sampleRate));
+    const auto length = static_cast<int>(std::min(reader.lengthInSamples, maxLength));
+    if (length <= 0) {
+        throw std::runtime_error("Impulse response is empty");
+    }
+
+    // First channel only; cabinets are mono
+    juce::AudioBuffer<float> buffer(1, length);
+    if (!reader.read(&buffer, 0, length, 0, true, false)) {
+        throw std::runtime_error("Failed to read impulse response");
+    }
+    return std::vector<float>(buffer.getReadPointer(0), buffer.getReadPointer(0) + length);
+}
+
+std::shared_ptr<const ImpulseResponseLoader::Prepared> ImpulseResponseLoader::prepare(
+    const float* samples,
+    int numSamples,
+    double sourceSampleRate,
+    double sampleRate,
+    int partitionSize,
+    bool normalise
+) {
+    const bool convert = sampleRate > 0.0 && sourceSampleRate > 0.0 && sampleRate != sourceSampleRate;
+    const double targetRate = convert ? sampleRate : sourceSampleRate;
+    auto impulseResponse = convert
+        ? finirig::dsp::resample(samples, numSamples, sourceSampleRate, targetRate)
+        : std::vector<float>(samples, samples + std::max(0, numSamples));
+
+    // Resampling keeps sample values; an IR also needs its gain scaled by
+    // the rate ratio to sound equally loud at the new rate
+    double gain = convert ? sourceSampleRate / targetRate : 1.0;
+
+    if (normalise) {
+        double energy = 0.0;
+        for (float sample : impulseResponse) {
+            energy += static_cast<double>(sample) * sample;
+        }
+        gain = energy > 0.0 ? 1.0 / std::sqrt(energy) : 1.0;
+    }
+
+    for (auto& sample : impulseResponse) {
+        sample = static_cast<float>(sample * gain);
+    }
+
+    auto prepared = std::make_shared<Prepared>();
+    prepared->kernel = finirig::dsp::PartitionedConvolver::createKernel(
+        impulseResponse.data(),
+        static_cast<int>(impulseResponse.size()),
+        partitionSize
+    );
+    prepared->sourceSampleRate = sourceSampleRate;
+    prepared->sampleRate = targetRate;
+    return prepared;
+}
+
+size_t ImpulseResponseLoader::getCacheSize() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cache_.size();
+}
+
+void ImpulseResponseLoader::clearCache() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cache_.clear();
+}
+
+void ImpulseResponseLoader::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        wakeUp_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+        if (stopping_) {
+            return;
+        }
+
+        auto job = std::move(jobs_.front());
+        jobs_.pop_front();
+
+        lock.unlock();
+        job();
+        lock.lock();
+    }
+}
+
+std::string ImpulseResponseLoader::makeCacheKey(const juce::File& file, double sampleRate, int partitionSize) {
+    // Modification time makes an edited file miss the cache
+    return file.getFullPathName().toStdString()
+        + "|" + std::to_string(file.getLastModificationTime().toMilliseconds())
+        + "|" + std::to_string(static_cast<long long>(std::llround(sampleRate)))
+        + "|" + std::to_string(partitionSize);
+}
+
+std::shared_ptr<const ImpulseResponseLoader::Prepared> ImpulseResponseLoader::findCached(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = cache_.find(key);
+    if (it == cache_.end()) {
+        return nullptr;
+    }
+    it->second.lastUsed = ++useCounter_;
+    return it->second.prepared;
+}
+
+void ImpulseResponseLoader::storeCached(const std::string& key, std::shared_ptr<const Prepared> prepared) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Evict the least recently used entry when full
+    if (cache_.size() >= MAX_CACHE_ENTRIES && cache_.find(key) == cache_.end()) {
+        auto oldest = std::min_element(cache_.begin(), cache_.end(), [](const auto& a, const auto& b) {
+            return a.second.lastUsed < b.second.lastUsed;
+        });
+        cache_.erase(oldest);
+    }
+
+    cache_[key] = CacheEntry{std::move(prepared), ++useCounter_};
+}
+
+} // namespace finirig::amps
@@ -0,0 +1,154 @@
+#include "finirig/amps/NeuralAmp.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace finirig::amps {
+
+namespace {
+
+constexpr float GAIN_RANGE_DB = 36.0f;  // full knob travel, centre unity
+constexpr float OUTPUT_RANGE = 2.0f;    // master 0.5 = unity
+
+} // namespace
+
+NeuralAmp::NeuralAmp() {
+    prepare(44100.0);
+}
+
+NeuralAmp::~NeuralAmp() {
+    delete network_.load(std::memory_order_relaxed);
+}
+
+void NeuralAmp::setGain(float gain) noexcept {
+    gain_.setValue(gain);
+}
+
+void NeuralAmp::setMasterVolume(float volume) noexcept {
+    master_.setValue(volume);
+}
+
+void NeuralAmp::loadModel(const juce::File& file) {
+    if (!file.existsAsFile()) {
+        throw std::runtime_error("Model file not found: " + file.getFullPathName().toStdString());
+    }
+    loadModelFromJson(file.loadFileAsString());
+}
+
+void NeuralAmp::loadModelFromJson(const juce::String& json) {
+    const auto weights = NeuralNetwork::parseJson(json);
+    try {
+        setModel(weights);
+    } catch (const std::invalid_argument& error) {
+        throw std::runtime_error(error.what());
+    }
+}
+
+void NeuralAmp::setModel(const NeuralNetwork::Weights& weights) {
+    installNetwork(NeuralNetwork::create(weights), weights.sampleRate);
+}
+
+void NeuralAmp::clearModel() {
+    installNetwork(nullptr, 0.0);
+}
+
+bool NeuralAmp::hasModel() const noexcept {
+    return hiddenSize_.load(std::memory_order_relaxed) > 0;
+}
+
+double NeuralAmp::getModelSampleRate() const noexcept {
+    return modelSampleRate_.load(std::memory_order_relaxed);
+}
+
+int NeuralAmp::getHiddenSize() const noexcept {
+    return hiddenSize_.load(std::memory_order_relaxed);
+}
+
+void NeuralAmp::installNetwork(std::unique_ptr<NeuralNetwork> network, double modelSampleRate) {
+    std::lock_guard<std::mutex> lock(modelMutex_);
+
+    if (network) {
+        network->reset();
+    }
+    hiddenSize_.store(network ? network->getHiddenSize() : 0, std::memory_order_relaxed);
+    modelSampleRate_.store(modelSampleRate, std::memory_order_relaxed);
+
+    auto* previous = network_.exchange(network.release(), std::memory_order_seq_cst);
+
+    // After this the audio thread can no longer be inside the old network
+    processEpoch_.synchronize();
+    delete previous;
+}
+
+void NeuralAmp::prepare(double sampleRate) {
+    gain_.prepare(sampleRate);
+    master_.prepare(sampleRate);
+    reset();
+}
+
+void NeuralAmp::reset() {
+    // The network state and smoothers belong to the audio thread, so the
+    // reset is done there, at the start of the next block
+    resetRequested_.store(true, std::memory_order_release);
+}
+
+void NeuralAmp::processChannels(
+    float* const* channelData,
+    int numChannels,
+    int numSamples
+) noexcept {
+    if (numChannels <= 0) {
+        return;
+    }
+
+    const finirig::audio::RealtimeEpoch::ScopedReader reader(processEpoch_);
+    auto* network = network_.load(std::memory_order_seq_cst);
+    float* data = channelData[0];
+
+    if (resetRequested_.exchange(false, std::memory_order_acquire)) {
+        resetState(network);
+    }
+
+    for (int offset = 0; offset < numSamples;) {
+        if (samplesUntilUpdate_ == 0) {
+            gain_.advance(PARAMETER_UPDATE_INTERVAL);
+            master_.advance(PARAMETER_UPDATE_INTERVAL);
+            updateGains();
+            samplesUntilUpdate_ = PARAMETER_UPDATE_INTERVAL;
+        }
+
+        const int count = std::min(numSamples - offset, samplesUntilUpdate_);
+        float* slice = data + offset;
+
+        if (network != nullptr) {
+            juce::FloatVectorOperations::multiply(slice, inputGain_, count);
+            network->process(slice, count);
+            juce::FloatVectorOperations::multiply(slice, outputGain_, count);
+        }
+
+        samplesUntilUpdate_ -= count;
+        offset += count;
+    }
+
+    for (int channel = 1; channel < numChannels; ++channel) {
+        juce::FloatVectorOperations::copy(channelData[channel], data, numSamples);
+    }
+}
+
+void NeuralAmp::resetState(NeuralNetwork* network) noexcept {
+    gain_.reset();
+    master_.reset();
+    samplesUntilUpdate_ = 0;
+    updateGains();
+
+    if (network != nullptr) {
+        network->reset();
+    }
+}
+
+void NeuralAmp::updateGains() noexcept {
+    inputGain_ = std::pow(10.0f, (gain_.getCurrentValue() - 0.5f) * GAIN_RANGE_DB / 20.0f);
+    outputGain_ = OUTPUT_RANGE * master_.getCurrentValue();
+}
+
+} // namespace finirig::amps
@@ -0,0 +1,465 @@
+#include "finirig/amps/NeuralNetwork.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define FINIRIG_SIMD_X86 1
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define FINIRIG_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace finirig::amps {
+
+namespace {
+
+// 4-wide float operations on the baseline instruction set of each target
+// (no runtime dispatch needed: SSE2 is part of x86-64, NEON of AArch64).
+// No FMA, so every target rounds the same way.
+#if defined(FINIRIG_SIMD_X86)
+
+using Float4 = __m128;
+inline Float4 load4(const float* p) noexcept { return _mm_loadu_ps(p); }
+inline void store4(float* p, Float4 v) noexcept { _mm_storeu_ps(p, v); }
+inline Float4 set4(float x) noexcept { return _mm_set1_ps(x); }
+inline Float4 add4(Float4 a, Float4 b) noexcept { return _mm_add_ps(a, b); }
+inline Float4 sub4(Float4 a, Float4 b) noexcept { return _mm_sub_ps(a, b); }
+inline Float4 mul4(Float4 a, Float4 b) noexcept { return _mm_mul_ps(a, b); }
+inline Float4 div4(Float4 a, Float4 b) noexcept { return _mm_div_ps(a, b); }
+inline Float4 min4(Float4 a, Float4 b) noexcept { return _mm_min_ps(a, b); }
+inline Float4 max4(Float4 a, Float4 b) noexcept { return _mm_max_ps(a, b); }
+inline float sum4(Float4 v) noexcept {
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, v);
+    return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+}
+
+#elif defined(FINIRIG_SIMD_NEON)
+
+using Float4 = float32x4_t;
+inline Float4 load4(const float* p) noexcept { return vld1q_f32(p); }
+inline void store4(float* p, Float4 v) noexcept { vst1q_f32(p, v); }
+inline Float4 set4(float x) noexcept { return vdupq_n_f32(x); }
+inline Float4 add4(Float4 a, Float4 b) noexcept { return vaddq_f32(a, b); }
+inline Float4 sub4(Float4 a, Float4 b) noexcept { return vsubq_f32(a, b); }
+inline Float4 mul4(Float4 a, Float4 b) noexcept { return vmulq_f32(a, b); }
+inline Float4 div4(Float4 a, Float4 b) noexcept { return vdivq_f32(a, b); }
+inline Float4 min4(Float4 a, Float4 b) noexcept { return vminq_f32(a, b); }
+inline Float4 max4(Float4 a, Float4 b) noexcept { return vmaxq_f32(a, b); }
+inline float sum4(Float4 v) noexcept {
+    return (vgetq_lane_f32(v, 0) + vgetq_lane_f32(v, 1)) + (vgetq_lane_f32(v, 2) + vgetq_lane_f32(v, 3));
+}
+
+#else
+
+struct Float4 {
+    float lane[4];
+};
+template <typename Op>
+inline Float4 map4(Float4 a, Float4 b, Op op) noexcept {
+    return {{op(a.lane[0], b.lane[0]), op(a.lane[1], b.lane[1]), op(a.lane[2], b.lane[2]), op(a.lane[3], b.lane[3])}};
+}
+inline Float4 load4(const float* p) noexcept { return {{p[0], p[1], p[2], p[3]}}; }
+inline void store4(float* p, Float4 v) noexcept { std::copy(v.lane, v.lane + 4, p); }
+inline Float4 set4(float x) noexcept { return {{x, x, x, x}}; }
+inline Float4 add4(Float4 a, Float4 b) noexcept { return map4(a, b, [](float x, float y) { return x + y; }); }
+inline Float4 sub4(Float4 a, Float4 b) noexcept { return map4(a, b, [](float x, float y) { return x - y; }); }
+inline Float4 mul4(Float4 a, Float4 b) noexcept { return map4(a, b, [](float x, float y) { return x * y; }); }
+inline Float4 div4(Float4 a, Float4 b) noexcept { return map4(a, b, [](float x, float y) { return x / y; }); }
+inline Float4 min4(Float4 a, Float4 b) noexcept { return map4(a, b, [](float x, float y) { return std::min(x, y); }); }
+inline Float4 max4(Float4 a, Float4 b) noexcept { return map4(a, b, [](float x, float y) { return std::max(x, y); }); }
+inline float sum4(Float4 v) noexcept { return (v.lane[0] + v.lane[1]) + (v.lane[2] + v.lane[3]); }
+
+#endif
+
+/**
+ * @brief Rational tanh approximation (max error ~1e-6 over the float range)
+ *
+ * Odd 13th over even 6th order polynomial on the clamped input; past the
+ * clamp tanh is 1 to float precision.
+ */
+inline Float4 tanh4(Float4 x) noexcept {
+    const Float4 limit = set4(7.90531110763549805f);
+    x = min4(max4(x, sub4(set4(0.0f), limit)), limit);
+    const Float4 x2 = mul4(x, x);
+
+    Float4 p = set4(-2.76076847742355e-16f);
+    p = add4(mul4(p, x2), set4(2.00018790482477e-13f));
+    p = add4(mul4(p, x2), set4(-8.60467152213735e-11f));
+    p = add4(mul4(p, x2), set4(5.12229709037114e-08f));
+    p = add4(mul4(p, x2), set4(1.48572235717979e-05f));
+    p = add4(mul4(p, x2), set4(6.37261928875436e-04f));
+    p = add4(mul4(p, x2), set4(4.89352455891786e-03f));
+    p = mul4(p, x);
+
+    Float4 q = set4(1.19825839466702e-06f);
+    q = add4(mul4(q, x2), set4(1.18534705686654e-04f));
+    q = add4(mul4(q, x2), set4(2.26843463243900e-03f));
+    q = add4(mul4(q, x2), set4(4.89352518554385e-03f));
+
+    return div4(p, q);
+}
+
+inline Float4 sigmoid4(Float4 x) noexcept {
+    const Float4 half = set4(0.5f);
+    return add4(half, mul4(half, tanh4(mul4(half, x))));
+}
+
+/**
+ * @brief Rows x Cols matrix stored in 4-row panels
+ *
+ * Each panel holds, for every column, the 4 entries of its rows next to
+ * each other, so a matrix-vector product streams through memory once and
+ * keeps the partial sums of a panel in registers.
+ */
+template <int Rows, int Cols>
+class PanelMatrix {
+public:
+    static_assert(Rows % 4 == 0 && Cols % 4 == 0, "Sizes must be multiples of the SIMD width");
+
+    void assign(const std::vector<float>& rowMajor) noexcept {
+        for (int row = 0; row < Rows; ++row) {
+            for (int col = 0; col < Cols; ++col) {
+                values_[index(row, col)] = rowMajor[static_cast<size_t>(row * Cols + col)];
+            }
+        }
+    }
+
+    // out = bias + M * x, with x pre-broadcast one register per column
+    void multiply(const Float4* x, const float* bias, float* out) const noexcept {
+        const float* panel = values_.data();
+        for (int row = 0; row < Rows; row += 4) {
+            // Four independent sums so the adds are not one long dependency chain
+            Float4 sum0 = load4(bias + row);
+            Float4 sum1 = set4(0.0f);
+            Float4 sum2 = set4(0.0f);
+            Float4 sum3 = set4(0.0f);
+            for (int col = 0; col < Cols; col += 4) {
+                sum0 = add4(sum0, mul4(load4(panel + 4 * col), x[col]));
+                sum1 = add4(sum1, mul4(load4(panel + 4 * col + 4), x[col + 1]));
+                sum2 = add4(sum2, mul4(load4(panel + 4 * col + 8), x[col + 2]));
+                sum3 = add4(sum3, mul4(load4(panel + 4 * col + 12), x[col + 3]));
+            }
+            store4(out + row, add4(add4(sum0, sum1), add4(sum2, sum3)));
+            panel += 4 * Cols;
+        }
+    }
+
+private:
+    alignas(16) std::array<float, static_cast<size_t>(Rows * Cols)> values_{};
+
+    static constexpr size_t index(int row, int col) noexcept {
+        return static_cast<size_t>((row / 4) * 4 * Cols + col * 4 + row % 4);
+    }
+};
+
+template <int HiddenSize>
+using Vector = std::array<float, static_cast<size_t>(HiddenSize)>;
+
+template <int HiddenSize>
+inline float outputDot(const Vector<HiddenSize>& weights, const Vector<HiddenSize>& hidden) noexcept {
+    Float4 sum = set4(0.0f);
+    for (int i = 0; i < HiddenSize; i += 4) {
+        sum = add4(sum, mul4(load4(weights.data() + i), load4(hidden.data() + i)));
+    }
+    return sum4(sum);
+}
+
+void checkSize(const std::vector<float>& values, size_t expected, const char* name) {
+    if (values.size() != expected) {
+        throw std::invalid_argument(
+            std::string("Network ") + name + " has " + std::to_string(values.size())
+            + " values, expected " + std::to_string(expected)
+        );
+    }
+}
+
+/**
+ * @brief State and weights shared by the LSTM and GRU kernels
+ */
+template <int HiddenSize, int Gates>
+class RecurrentNetwork : public NeuralNetwork {
+public:
+    static constexpr int ROWS = Gates * HiddenSize;
+
+    explicit RecurrentNetwork(const Weights& weights) {
+        const auto rows = static_cast<size_t>(ROWS);
+        checkSize(weights.inputWeights, rows, "input weights");
+        checkSize(weights.recurrentWeights, rows * HiddenSize, "recurrent weights");
+        checkSize(weights.inputBias, rows, "input bias");
+        checkSize(weights.recurrentBias, rows, "recurrent bias");
+        checkSize(weights.outputWeights, static_cast<size_t>(HiddenSize), "output weights");
+
+        recurrent_.assign(weights.recurrentWeights);
+        std::copy(weights.inputWeights.begin(), weights.inputWeights.end(), inputWeights_.begin());
+        std::copy(weights.outputWeights.begin(), weights.outputWeights.end(), outputWeights_.begin());
+        outputBias_ = weights.outputBias;
+        skip_ = weights.skip;
+    }
+
+    [[nodiscard]] int getHiddenSize() const noexcept override { return HiddenSize; }
+
+protected:
+    PanelMatrix<ROWS, HiddenSize> recurrent_;
+    alignas(16) std::array<float, static_cast<size_t>(ROWS)> inputWeights_{};
+    alignas(16) Vector<HiddenSize> outputWeights_{};
+    float outputBias_ = 0.0f;
+    bool skip_ = false;
+
+    alignas(16) Vector<HiddenSize> hidden_{};
+    Float4 broadcastHidden_[HiddenSize]{}; // plain array: std::array drops __m128 attributes
+    alignas(16) std::array<float, static_cast<size_t>(ROWS)> preactivation_{};
+
+    // preactivation_ = bias + W_hh * h
+    void multiplyRecurrent(const float* bias) noexcept {
+        for (int i = 0; i < HiddenSize; ++i) {
+            broadcastHidden_[i] = set4(hidden_[static_cast<size_t>(i)]);
+        }
+        recurrent_.multiply(broadcastHidden_, bias, preactivation_.data());
+    }
+
+    [[nodiscard]] float output(float input) const noexcept {
+        const float y = outputDot<HiddenSize>(outputWeights_, hidden_) + outputBias_;
+        return skip_ ? y + input : y;
+    }
+};
+
+template <int HiddenSize>
+class LstmNetwork final : public RecurrentNetwork<HiddenSize, 4> {
+    using Base = RecurrentNetwork<HiddenSize, 4>;
+
+public:
+    explicit LstmNetwork(const NeuralNetwork::Weights& weights)
+        : Base(weights)
+    {
+        // Both biases are plain offsets for an LSTM, so fold them together
+        for (size_t row = 0; row < bias_.size(); ++row) {
+            bias_[row] = weights.inputBias[row] + weights.recurrentBias[row];
+        }
+    }
+
+    void process(float* data, int numSamples) noexcept override {
+        constexpr int H = HiddenSize;
+        float* gates = this->preactivation_.data();
+        const float* inputWeights = this->inputWeights_.data();
+
+        for (int sample = 0; sample < numSamples; ++sample) {
+            const float input = data[sample];
+            const Float4 x = set4(input);
+
+            this->multiplyRecurrent(bias_.data());
+
+            // Gate blocks: input i, forget f, cell candidate g, output o
+            for (int i = 0; i < H; i += 4) {
+                const Float4 inputGate = sigmoid4(add4(load4(gates + i), mul4(load4(inputWeights + i), x)));
+                const Float4 forgetGate = sigmoid4(add4(load4(gates + H + i), mul4(load4(inputWeights + H + i), x)));
+                const Float4 candidate = tanh4(add4(load4(gates + 2 * H + i), mul4(load4(inputWeights + 2 * H + i), x)));
+                const Float4 outputGate = sigmoid4(add4(load4(gates + 3 * H + i), mul4(load4(inputWeights + 3 * H + i), x)));
+
+                const Float4 cell = add4(mul4(forgetGate, load4(cell_.data() + i)), mul4(inputGate, candidate));
+                store4(cell_.data() + i, cell);
+                store4(this->hidden_.data() + i, mul4(outputGate, tanh4(cell)));
+            }
+
+            data[sample] = this->output(input);
+        }
+    }
+
+    void reset() noexcept override {
+        this->hidden_.fill(0.0f);
+        cell_.fill(0.0f);
+    }
+
+    [[nodiscard]] NeuralNetwork::CellType getCellType() const noexcept override {
+        return NeuralNetwork::CellType::Lstm;
+    }
+
+private:
+    alignas(16) std::array<float, static_cast<size_t>(4 * HiddenSize)> bias_{};
+    alignas(16) Vector<HiddenSize> cell_{};
+};
+
+template <int HiddenSize>
+class GruNetwork final : public RecurrentNetwork<HiddenSize, 3> {
+    using Base = RecurrentNetwork<HiddenSize, 3>;
+
+public:
+    explicit GruNetwork(const NeuralNetwork::Weights& weights)
+        : Base(weights)
+    {
+        // The candidate gate scales its recurrent part by r, so only the
+        // reset and update biases can be folded
+        for (size_t row = 0; row < recurrentBias_.size(); ++row) {
+            inputBias_[row] = weights.inputBias[row];
+            recurrentBias_[row] = weights.recurrentBias[row];
+        }
+    }
+
+    void process(float* data, int numSamples) noexcept override {
+        constexpr int H = HiddenSize;
+        const float* recurrentPart = this->preactivation_.data();
+        const float* inputWeights = this->inputWeights_.data();
+        const float* inputBias = inputBias_.data();
+
+        for (int sample = 0; sample < numSamples; ++sample) {
+            const float input = data[sample];
+            const Float4 x = set4(input);
+
+            this->multiplyRecurrent(recurrentBias_.data());
+
+            // Gate blocks: reset r, update z, candidate n
+            for (int i = 0; i < H; i += 4) {
+                const Float4 resetGate = sigmoid4(add4(
+                    load4(recurrentPart + i),
+                    add4(mul4(load4(inputWeights + i), x), load4(inputBias + i))
+                ));
+                const Float4 updateGate = sigmoid4(add4(
+                    load4(recurrentPart + H + i),
+                    add4(mul4(load4(inputWeights + H + i), x), load4(inputBias + H + i))
+                ));
+                const Float4 candidate = tanh4(add4(
+                    add4(mul4(load4(inputWeights + 2 * H + i), x), load4(inputBias + 2 * H + i)),
+                    mul4(resetGate, load4(recurrentPart + 2 * H + i))
+                ));
+
+                // h' = (1 - z) n + z h = n + z (h - n)
+                const Float4 previous = load4(this->hidden_.data() + i);
+                store4(this->hidden_.data() + i, add4(candidate, mul4(updateGate, sub4(previous, candidate))));
+            }
+
+            data[sample] = this->output(input);
+        }
+    }
+
+    void reset() noexcept override {
+        this->hidden_.fill(0.0f);
+    }
+
+    [[nodiscard]] NeuralNetwork::CellType getCellType() const noexcept override {
+        return NeuralNetwork::CellType::Gru;
+    }
+
+private:
+    alignas(16) std::array<float, static_cast<size_t>(3 * HiddenSize)> inputBias_{};
+    alignas(16) std::array<float, static_cast<size_t>(3 * HiddenSize)> recurrentBias_{};
+};
+
+template <int HiddenSize>
+std::unique_ptr<NeuralNetwork> createSized(const NeuralNetwork::Weights& weights) {
+    if (weights.cellType == NeuralNetwork::CellType::Lstm) {
+        return std::make_unique<LstmNetwork<HiddenSize>>(weights);
+    }
+    return std::make_unique<GruNetwork<HiddenSize>>(weights);
+}
+
+template <size_t... Index>
+std::unique_ptr<NeuralNetwork> createForSupportedSize(
+    const NeuralNetwork::Weights& weights,
+    std::index_sequence<Index...>
+) {
+    std::unique_ptr<NeuralNetwork> network;
+    ((weights.hiddenSize == NeuralNetwork::SUPPORTED_HIDDEN_SIZES[Index]
+        ? (void)(network = createSized<NeuralNetwork::SUPPORTED_HIDDEN_SIZES[Index]>(weights))
+        : (void)0), ...);
+    return network;
+}
+
+// Flattens nested JSON arrays (PyTorch tensors) row-major
+void flatten(const juce::var& value, std::vector<float>& out) {
+    if (value.isArray()) {
+        for (int i = 0; i < value.size(); ++i) {
+            flatten(value[i], out);
+        }
+    } else {
+        out.push_back(static_cast<float>(static_cast<double>(value)));
+    }
+}
+
+std::vector<float> readTensor(const juce::var& stateDict, const char* name, size_t expected) {
+    const auto& tensor = stateDict[name];
+    if (!tensor.isArray()) {
+        throw std::runtime_error(std::string("Model is missing ") + name);
+    }
+
+    std::vector<float> values;
+    values.reserve(expected);
+    flatten(tensor, values);
+    if (values.size() != expected) {
+        throw std::runtime_error(
+            std::string("Model tensor ") + name + " has " + std::to_string(values.size())
+            + " values, expected " + std::to_string(expected)
+        );
+    }
+    return values;
+}
+
+int readInt(const juce::var& object, const char* name, int defaultValue) {
+    return object.hasProperty(name) ? static_cast<int>(object[name]) : defaultValue;
+}
+
+} // namespace
+
+std::unique_ptr<NeuralNetwork> NeuralNetwork::create(const Weights& weights) {
+    auto network = createForSupportedSize(
+        weights,
+        std::make_index_sequence<SUPPORTED_HIDDEN_SIZES.size()>()
+    );
+    if (!network) {
+        throw std::invalid_argument(
+            "Unsupported hidden size " + std::to_string(weights.hiddenSize)
+        );
+    }
+    return network;
+}
+
+NeuralNetwork::Weights NeuralNetwork::parseJson(const juce::String& json) {
+    const auto root = juce::JSON::parse(json);
+    if (!root.isObject()) {
+        throw std::runtime_error("Model is not a JSON object");
+    }
+
+    const auto& modelData = root["model_data"];
+    const auto& stateDict = root["state_dict"];
+    if (!modelData.isObject() || !stateDict.isObject()) {
+        throw std::runtime_error("Model needs model_data and state_dict");
+    }
+
+    Weights weights;
+    const auto unitType = modelData["unit_type"].toString();
+    if (unitType == "LSTM") {
+        weights.cellType = CellType::Lstm;
+    } else if (unitType == "GRU") {
+        weights.cellType = CellType::Gru;
+    } else {
+        throw std::runtime_error("Unsupported unit_type: " + unitType.toStdString());
+    }
+
+    if (readInt(modelData, "input_size", 1) != 1 || readInt(modelData, "output_size", 1) != 1
+        || readInt(modelData, "num_layers", 1) != 1) {
+        throw std::runtime_error("Only single-layer models with one input and one output are supported");
+    }
+
+    weights.hiddenSize = readInt(modelData, "hidden_size", 0);
+    if (weights.hiddenSize <= 0) {
+        throw std::runtime_error("Model hidden_size is missing");
+    }
+    weights.skip = readInt(modelData, "skip", 0) != 0;
+    if (modelData.hasProperty("sample_rate")) {
+        weights.sampleRate = static_cast<double>(modelData["sample_rate"]);
+    }
+
+    const auto hidden = static_cast<size_t>(weights.hiddenSize);
+    const auto rows = static_cast<size_t>(getNumGates(weights.cellType)) * hidden;
+    weights.inputWeights = readTensor(stateDict, "rec.weight_ih_l0", rows);
+    weights.recurrentWeights = readTensor(stateDict, "rec.weight_hh_l0", rows * hidden);
+    weights.inputBias = readTensor(stateDict, "rec.bias_ih_l0", rows);
+    weights.recurrentBias = readTensor(stateDict, "rec.bias_hh_l0", rows);
+    weights.outputWeights = readTensor(stateDict, "lin.weight", hidden);
+    weights.outputBias = readTensor(stateDict, "lin.bias", 1)[0];
+    return weights;
+}
+
+} // namespace finirig::amps
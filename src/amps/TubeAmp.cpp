@@ -0,0 +1,327 @@
+#include "finirig/amps/TubeAmp.h"
+#include <algorithm>
+#include <cmath>
+
+namespace finirig::amps {
+
+namespace {
+
+constexpr double PI = 3.14159265358979323846;
+
+// Preamp
+constexpr float GAIN_MIN_DB = -6.0f;
+constexpr float GAIN_RANGE_DB = 48.0f;
+constexpr std::array<float, TubeAmp::NUM_PREAMP_STAGES - 1> INTERSTAGE_GAIN = {2.5f, 2.0f};
+constexpr float TRIODE_BIAS = 0.4f;
+constexpr double COUPLING_CUTOFF_HZ = 20.0;
+constexpr double MILLER_CUTOFF_HZ = 10000.0;
+
+// Tone stack
+constexpr double BASS_HZ = 120.0;
+constexpr double MIDDLE_HZ = 700.0;
+constexpr double MIDDLE_Q = 0.7;
+constexpr double TREBLE_HZ = 3000.0;
+constexpr double TONE_RANGE_DB = 24.0; // full knob travel, centre flat
+
+// Power amp
+constexpr float POWER_DRIVE_MIN = 0.5f;
+constexpr float POWER_DRIVE_RANGE = 2.5f;
+constexpr float OUTPUT_LEVEL = 0.8f;
+constexpr float SAG_DEPTH = 0.6f;
+constexpr double SAG_ATTACK_SECONDS = 0.005;
+constexpr double SAG_RELEASE_SECONDS = 0.15;
+
+// Common-cathode triode: grid conduction clips the positive swing hard,
+// cutoff rounds off the negative one more gently. Biased so that silence
+// stays at zero, and inverting like the real stage.
+float triodeCurve(float x) {
+    auto shape = [](double v) {
+        return v >= 0.0 ? std::tanh(v) : 1.6 * std::tanh(v / 1.6);
+    };
+    return static_cast<float>(-(shape(x + TRIODE_BIAS) - shape(TRIODE_BIAS)));
+}
+
+const finirig::dsp::LookupTable& getTriodeTable() {
+    static const finirig::dsp::LookupTable table(triodeCurve, -8.0f, 8.0f);
+    return table;
+}
+
+// Push-pull output stage: symmetric, so only odd harmonics
+const finirig::dsp::LookupTable& getPowerAmpTable() {
+    static const finirig::dsp::LookupTable table(
+        [](float x) { return static_cast<float>(std::tanh(static_cast<double>(x))); },
+        -6.0f,
+        6.0f
+    );
+    return table;
+}
+
+float onePoleCoefficient(double cutoffHz, double sampleRate) {
+    return static_cast<float>(std::exp(-2.0 * PI * cutoffHz / sampleRate));
+}
+
+float envelopeCoefficient(double seconds, double sampleRate) {
+    return static_cast<float>(1.0 - std::exp(-1.0 / (seconds * sampleRate)));
+}
+
+// RBJ audio EQ cookbook shelves and peak, normalised by a0
+template <typename Biquad>
+void setShelf(Biquad& filter, bool high, double frequency, double gainDb, double sampleRate) {
+    const double a = std::pow(10.0, gainDb / 40.0);
+    const double w0 = 2.0 * PI * frequency / sampleRate;
+    const double cosW0 = std::cos(w0);
+    const double alpha = std::sin(w0) / 2.0 * std::sqrt(2.0); // shelf slope 1
+    const double rootA = 2.0 * std::sqrt(a) * alpha;
+    const double sign = high ? -1.0 : 1.0;
+
+    const double b0 = a * ((a + 1.0) - sign * (a - 1.0) * cosW0 + rootA);
+    const double b1 = sign * 2.0 * a * ((a - 1.0) - sign * (a + 1.0) * cosW0);
+    const double b2 = a * ((a + 1.0) - sign * (a - 1.0) * cosW0 - rootA);
+    const double a0 = (a + 1.0) + sign * (a - 1.0) * cosW0 + rootA;
+    const double a1 = -sign * 2.0 * ((a - 1.0) + sign * (a + 1.0) * cosW0);
+    const double a2 = (a + 1.0) + sign * (a - 1.0) * cosW0 - rootA;
+
+    filter.b0 = static_cast<float>(b0 / a0);
+    filter.b1 = static_cast<float>(b1 / a0);
+    filter.b2 = static_cast<float>(b2 / a0);
+    filter.a1 = static_cast<float>(a1 / a0);
+    filter.a2 = static_cast<float>(a2 / a0);
+}
+
+template <typename Biquad>
+void setPeak(Biquad& filter, double frequency, double q, double gainDb, double sampleRate) {
+    const double a = std::pow(10.0, gainDb / 40.0);
+    const double w0 = 2.0 * PI * frequency / sampleRate;
+    const double cosW0 = std::cos(w0);
+    const double alpha = std::sin(w0) / (2.0 * q);
+    const double a0 = 1.0 + alpha / a;
+
+    filter.b0 = static_cast<float>((1.0 + alpha * a) / a0);
+    filter.b1 = static_cast<float>((-2.0 * cosW0) / a0);
+    filter.b2 = static_cast<float>((1.0 - alpha * a) / a0);
+    filter.a1 = filter.b1;
+    filter.a2 = static_cast<float>((1.0 - alpha / a) / a0);
+}
+
+} // namespace
+
+TubeAmp::TubeAmp()
+    : oversampler_(OVERSAMPLING_FACTOR)
+    , triode_(getTriodeTable())
+    , powerAmp_(getPowerAmpTable())
+{
+    for (auto& coupling : couplings_) {
+        coupling.highpass = true;
+    }
+    prepare(44100.0);
+}
+
+void TubeAmp::setGain(float gain) noexcept {
+    gain_.setValue(gain);
+}
+
+void TubeAmp::setMasterVolume(float volume) noexcept {
+    master_.setValue(volume);
+}
+
+void TubeAmp::setBass(float bass) noexcept {
+    bass_.setValue(bass);
+}
+
+void TubeAmp::setMiddle(float middle) noexcept {
+    middle_.setValue(middle);
+}
+
+void TubeAmp::setTreble(float treble) noexcept {
+    treble_.setValue(treble);
+}
+
+void TubeAmp::setSag(float sag) noexcept {
+    sag_.setValue(sag);
+}
+
+void TubeAmp::prepare(double sampleRate) {
+    oversampledRate_ = sampleRate * OVERSAMPLING_FACTOR;
+
+    for (auto* parameter : {&gain_, &bass_, &middle_, &treble_, &master_, &sag_}) {
+        parameter->prepare(sampleRate);
+    }
+
+    for (auto& coupling : couplings_) {
+        coupling.coeff = onePoleCoefficient(COUPLING_CUTOFF_HZ, oversampledRate_);
+    }
+    for (auto& miller : millers_) {
+        miller.coeff = onePoleCoefficient(MILLER_CUTOFF_HZ, oversampledRate_);
+    }
+    sagAttack_ = envelopeCoefficient(SAG_ATTACK_SECONDS, oversampledRate_);
+    sagRelease_ = envelopeCoefficient(SAG_RELEASE_SECONDS, oversampledRate_);
+
+    oversampler_.prepare(PARAMETER_UPDATE_INTERVAL);
+    reset();
+}
+
+void TubeAmp::reset() {
+    for (auto* parameter : {&gain_, &bass_, &middle_, &treble_, &master_, &sag_}) {
+        parameter->reset();
+    }
+    samplesUntilUpdate_ = 0;
+
+    for (auto& coupling : couplings_) {
+        coupling.reset();
+    }
+    for (auto& miller : millers_) {
+        miller.reset();
+    }
+    for (auto& filter : toneStack_) {
+        filter.reset();
+    }
+    sagEnvelope_ = 0.0f;
+
+    oversampler_.reset();
+    updateToneStack();
+    updateGains();
+}
+
+int TubeAmp::getLatencySamples() const noexcept {
+    return static_cast<int>(std::lround(oversampler_.getLatencySamples()));
+}
+
+void TubeAmp::processChannels(
+    float* const* channelData,
+    int numChannels,
+    int numSamples
+) noexcept {
+    if (numChannels <= 0) {
+        return;
+    }
+
+    float* data = channelData[0];
+
+    // Parameters hold still between updates, so each slice runs with
+    // constant gains and coefficients
+    for (int offset = 0; offset < numSamples;) {
+        if (samplesUntilUpdate_ == 0) {
+            updateParameters();
+            samplesUntilUpdate_ = PARAMETER_UPDATE_INTERVAL;
+        }
+
+        const int count = std::min(numSamples - offset, samplesUntilUpdate_);
+        processSlice(data + offset, count);
+        samplesUntilUpdate_ -= count;
+        offset += count;
+    }
+
+    for (int channel = 1; channel < numChannels; ++channel) {
+        juce::FloatVectorOperations::copy(channelData[channel], data, numSamples);
+    }
+}
+
+void TubeAmp::processSlice(float* data, int numSamples) noexcept {
+    float* oversampled = oversampler_.upsample(data, numSamples);
+    const int count = numSamples * OVERSAMPLING_FACTOR;
+
+    juce::FloatVectorOperations::multiply(oversampled, inputGain_, count);
+
+    // Each stage runs over the whole slice before the next one starts
+    for (int stage = 0; stage < NUM_PREAMP_STAGES; ++stage) {
+        triode_.process(oversampled, count);
+        couplings_[static_cast<size_t>(stage)].process(oversampled, count);
+
+        if (stage < NUM_PREAMP_STAGES - 1) {
+            millers_[static_cast<size_t>(stage)].process(oversampled, count);
+            juce::FloatVectorOperations::multiply(
+                oversampled,
+                INTERSTAGE_GAIN[static_cast<size_t>(stage)],
+                count
+            );
+        }
+    }
+
+    for (auto& filter : toneStack_) {
+        filter.process(oversampled, count);
+    }
+
+    processPowerAmp(oversampled, count);
+    oversampler_.downsample(data, numSamples);
+}
+
+void TubeAmp::processPowerAmp(float* data, int numSamples) noexcept {
+    const float drive = powerDrive_;
+    const float output = outputGain_;
+    const float depth = sagDepth_;
+    float envelope = sagEnvelope_;
+
+    for (int sample = 0; sample < numSamples; ++sample) {
+        // Heavy current draw pulls the supply down: less drive and less
+        // headroom until the rectifier catches up
+        const float supply = 1.0f / (1.0f + depth * envelope);
+        const float y = powerAmp_(data[sample] * drive * supply);
+
+        const float level = std::abs(y);
+        envelope += (level > envelope ? sagAttack_ : sagRelease_) * (level - envelope);
+
+        data[sample] = y * output * supply;
+    }
+
+    sagEnvelope_ = envelope;
+}
+
+void TubeAmp::updateParameters() noexcept {
+    gain_.advance(PARAMETER_UPDATE_INTERVAL);
+    master_.advance(PARAMETER_UPDATE_INTERVAL);
+    sag_.advance(PARAMETER_UPDATE_INTERVAL);
+
+    // Each advance() must run, so no short-circuit here
+    const bool bassMoved = bass_.advance(PARAMETER_UPDATE_INTERVAL);
+    const bool middleMoved = middle_.advance(PARAMETER_UPDATE_INTERVAL);
+    const bool trebleMoved = treble_.advance(PARAMETER_UPDATE_INTERVAL);
+    if (bassMoved || middleMoved || trebleMoved) {
+        updateToneStack();
+    }
+
+    updateGains();
+}
+
+void TubeAmp::updateGains() noexcept {
+    const float master = master_.getCurrentValue();
+    inputGain_ = std::pow(10.0f, (GAIN_MIN_DB + GAIN_RANGE_DB * gain_.getCurrentValue()) / 20.0f);
+    powerDrive_ = POWER_DRIVE_MIN + POWER_DRIVE_RANGE * master;
+    outputGain_ = OUTPUT_LEVEL * master;
+    sagDepth_ = SAG_DEPTH * sag_.getCurrentValue();
+}
+
+void TubeAmp::updateToneStack() noexcept {
+    auto toDb = [](const Parameter& knob) {
+        return (knob.getCurrentValue() - 0.5) * TONE_RANGE_DB;
+    };
+
+    setShelf(toneStack_[0], false, BASS_HZ, toDb(bass_), oversampledRate_);
+    setPeak(toneStack_[1], MIDDLE_HZ, MIDDLE_Q, toDb(middle_), oversampledRate_);
+    setShelf(toneStack_[2], true, TREBLE_HZ, toDb(treble_), oversampledRate_);
+}
+
+void TubeAmp::Biquad::process(float* data, int numSamples) noexcept {
+    float s1 = z1;
+    float s2 = z2;
+    for (int sample = 0; sample < numSamples; ++sample) {
+        const float x = data[sample];
+        const float y = b0 * x + s1;
+        s1 = b1 * x - a1 * y + s2;
+        s2 = b2 * x - a2 * y;
+        data[sample] = y;
+    }
+    z1 = s1;
+    z2 = s2;
+}
+
+void TubeAmp::OnePole::process(float* data, int numSamples) noexcept {
+    const float inputCoeff = 1.0f - coeff;
+    float lowpassed = state;
+    for (int sample = 0; sample < numSamples; ++sample) {
+        lowpassed = lowpassed * coeff + data[sample] * inputCoeff;
+        data[sample] = highpass ? data[sample] - lowpassed : lowpassed;
+    }
+    state = lowpassed;
+}
+
+} // namespace finirig::amps
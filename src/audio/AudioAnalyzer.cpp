@@ -0,0 +1,93 @@
+#include "finirig/audio/AudioAnalyzer.h"
+#include <chrono>
+
+namespace finirig::audio {
+
+namespace {
+// Latency of the display; the tap holds far more than one interval
+constexpr auto POLL_INTERVAL = std::chrono::milliseconds(15);
+}
+
+AudioAnalyzer::AudioAnalyzer(AudioTap& tap)
+    : tap_(tap)
+    , scratch_(PULL_SIZE)
+{
+}
+
+AudioAnalyzer::~AudioAnalyzer() {
+    stop();
+}
+
+void AudioAnalyzer::start(double sampleRate) {
+    std::lock_guard<std::mutex> lifecycle(lifecycleMutex_);
+    stopThread();
+
+    // The thread is joined, so this thread may act as the tap's reader
+    tap_.discardPending();
+    sampleRate_ = sampleRate;
+    spectrum_.reset();
+    pitch_.prepare(sampleRate);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shouldExit_ = false;
+        results_ = Results{};
+        results_.spectrumDb = spectrum_.getMagnitudesDb();
+        results_.binWidthHz = spectrum_.getBinFrequency(1, sampleRate);
+    }
+    thread_ = std::thread([this] { run(); });
+}
+
+void AudioAnalyzer::stop() {
+    std::lock_guard<std::mutex> lifecycle(lifecycleMutex_);
+    stopThread();
+}
+
+bool AudioAnalyzer::isRunning() const {
+    std::lock_guard<std::mutex> lifecycle(lifecycleMutex_);
+    return thread_.joinable();
+}
+
+void AudioAnalyzer::stopThread() {
+    if (!thread_.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shouldExit_ = true;
+    }
+    condition_.notify_one();
+    thread_.join();
+}
+
+AudioAnalyzer::Results AudioAnalyzer::getResults() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return results_;
+}
+
+void AudioAnalyzer::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!shouldExit_) {
+        lock.unlock();
+
+        int spectrumFrames = 0;
+        int pitchDetections = 0;
+        while (const auto count = tap_.pull(scratch_.data(), scratch_.size())) {
+            spectrumFrames += spectrum_.process(scratch_.data(), static_cast<int>(count));
+            pitchDetections += pitch_.process(scratch_.data(), static_cast<int>(count));
+        }
+
+        lock.lock();
+        if (spectrumFrames > 0) {
+            results_.spectrumDb = spectrum_.getMagnitudesDb();
+        }
+        if (pitchDetections > 0) {
+            results_.pitch = pitch_.getResult();
+        }
+        results_.droppedSamples = tap_.getDroppedSampleCount();
+
+        condition_.wait_for(lock, POLL_INTERVAL, [this] { return shouldExit_; });
+    }
+}
+
+} // namespace finirig::audio
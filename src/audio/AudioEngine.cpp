@@ -2,25 +2,47 @@
 #include "finirig/audio/AudioProcessor.h"
 #include <juce_audio_devices/juce_audio_devices.h>
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 
 namespace finirig::audio {
 
 AudioEngine::AudioEngine() {
-    // Initialize audio device manager with default settings
-    // Request at least 1 input channel for guitar input, 2 output channels for stereo
-    deviceManager_.initialiseWithDefaultDevices(1, 2);
+    // Nothing is opened or scanned here; initialize() opens the device, so
+    // the engine can be constructed on the UI thread without blocking it
 }
 
 AudioEngine::~AudioEngine() {
     stop();
     deviceManager_.removeAudioCallback(this);
     deviceManager_.closeAudioDevice();
+    pipeline_.stop();
+
+    // No callback or pipeline thread can be running any more, so the active processor can go
+    const std::unique_ptr<AudioProcessor> active(processor_.exchange(nullptr));
 }
 
 bool AudioEngine::initialize(double sampleRate, int bufferSize) {
-    sampleRate_ = sampleRate;
-    bufferSize_ = bufferSize;
+    sampleRate_.store(sampleRate, std::memory_order_relaxed);
+    bufferSize_.store(bufferSize, std::memory_order_relaxed);
+
+    // Enumerate devices in the background only once the first open is
+    // over, so the catalogue never probes a driver while it is being opened
+    const bool firstOpen = deviceManager_.getCurrentAudioDevice() == nullptr;
+
+    if (firstOpen) {
+        // First open: go straight to the requested format on the default
+        // devices (1 input for the guitar, 2 outputs for stereo) instead of
+        // opening at the device defaults and reopening
+        juce::AudioDeviceManager::AudioDeviceSetup preferred;
+        preferred.sampleRate = sampleRate;
+        preferred.bufferSize = bufferSize;
+        const auto error = deviceManager_.initialise(1, 2, nullptr, true, {}, &preferred);
+        if (error.isNotEmpty()) {
+            deviceCatalogue_.requestRescan();
+            return false;
+        }
+    }
 
     juce::AudioDeviceManager::AudioDeviceSetup setup;
     deviceManager_.getAudioDeviceSetup(setup);
@@ -40,7 +62,11 @@ bool AudioEngine::initialize(double sampleRate, int bufferSize) {
         }
     }
 
+    // Success or not, the device is settled by the time this returns
     auto error = deviceManager_.setAudioDeviceSetup(setup, true);
+    if (firstOpen) {
+        deviceCatalogue_.requestRescan();
+    }
     if (error.isNotEmpty()) {
         return false;
     }
@@ -68,40 +94,73 @@ void AudioEngine::stop() {
 }
 
 void AudioEngine::setProcessor(std::unique_ptr<AudioProcessor> processor) {
-    processor_ = std::move(processor);
-    if (processor_) {
-        processor_->prepare(sampleRate_);
+    AudioProcessor* retired = nullptr;
+    {
+        // A device restart now waits until the new processor is published,
+        // then prepares it at the new rate; it cannot slip in between
+        std::lock_guard<std::mutex> lock(prepareMutex_);
+
+        // Prepare off the audio thread, before the callback can see it
+        if (processor) {
+            processor->prepare(sampleRate_.load(std::memory_order_relaxed));
+        }
+
+        // Publish with one atomic store; the callback picks it up on its next pass
+        retired = processor_.exchange(processor.release(), std::memory_order_seq_cst);
     }
+
+    // The callback may still be using the old processor; defer its destruction
+    releasePool_.retire(std::unique_ptr<AudioProcessor>(retired));
 }
 
-juce::StringArray AudioEngine::getInputDeviceNames() {
-    juce::StringArray names;
-    auto& deviceTypes = deviceManager_.getAvailableDeviceTypes();
-    for (auto* type : deviceTypes) {
-        if (type) {
-            type->scanForDevices();
-            auto devices = type->getDeviceNames(true); // true = input devices
-            for (const auto& device : devices) {
-                names.add(type->getTypeName() + ": " + device);
-            }
-        }
+void AudioEngine::setAnalysisSource(AudioTap::Point point) {
+    if (point == audioTap_.getPoint()) {
+        return;
+    }
+    audioTap_.setPoint(point);
+
+    // Otherwise audioDeviceAboutToStart() starts it with the device
+    if (point == AudioTap::Point::Off) {
+        analyzer_.stop();
+    } else if (isRunning_) {
+        analyzer_.start(sampleRate_.load(std::memory_order_relaxed));
     }
-    return names;
 }
 
-juce::StringArray AudioEngine::getOutputDeviceNames() {
-    juce::StringArray names;
-    auto& deviceTypes = deviceManager_.getAvailableDeviceTypes();
-    for (auto* type : deviceTypes) {
-        if (type) {
-            type->scanForDevices();
-            auto devices = type->getDeviceNames(false); // false = output devices
-            for (const auto& device : devices) {
-                names.add(type->getTypeName() + ": " + device);
-            }
-        }
+void AudioEngine::setProcessingMode(ProcessingMode mode) {
+    if (mode == processingMode_) {
+        return;
+    }
+
+    // Detaching stops the device callbacks (audioDeviceStopped), re-attaching
+    // restarts them in the new mode (audioDeviceAboutToStart)
+    const bool wasRunning = isRunning_;
+    stop();
+    processingMode_ = mode;
+    if (wasRunning) {
+        start();
     }
-    return names;
+}
+
+int AudioEngine::getProcessingLatencySamples() const noexcept {
+    const auto* processor = processor_.load(std::memory_order_acquire);
+    return (processor ? processor->getLatencySamples() : 0) + pipeline_.getLatencySamples();
+}
+
+int AudioEngine::getTotalLatencySamples() const {
+    int latency = getProcessingLatencySamples();
+    if (auto* device = deviceManager_.getCurrentAudioDevice()) {
+        latency += device->getInputLatencyInSamples() + device->getOutputLatencyInSamples();
+    }
+    return latency;
+}
+
+juce::StringArray AudioEngine::getInputDeviceNames() const {
+    return deviceCatalogue_.getSnapshot().getInputDeviceNames();
+}
+
+juce::StringArray AudioEngine::getOutputDeviceNames() const {
+    return deviceCatalogue_.getSnapshot().getOutputDeviceNames();
 }
 
 juce::String AudioEngine::getCurrentInputDeviceName() const {
@@ -138,8 +197,8 @@ bool AudioEngine::setInputDevice(const juce::String& deviceName) {
         // Update sample rate and buffer size after device change
         auto* device = deviceManager_.getCurrentAudioDevice();
         if (device) {
-            sampleRate_ = device->getCurrentSampleRate();
-            bufferSize_ = device->getCurrentBufferSizeSamples();
+            sampleRate_.store(device->getCurrentSampleRate(), std::memory_order_relaxed);
+            bufferSize_.store(device->getCurrentBufferSizeSamples(), std::memory_order_relaxed);
         }
     }
     return error.isEmpty();
@@ -163,8 +222,8 @@ bool AudioEngine::setOutputDevice(const juce::String& deviceName) {
         // Update sample rate and buffer size after device change
         auto* device = deviceManager_.getCurrentAudioDevice();
         if (device) {
-            sampleRate_ = device->getCurrentSampleRate();
-            bufferSize_ = device->getCurrentBufferSizeSamples();
+            sampleRate_.store(device->getCurrentSampleRate(), std::memory_order_relaxed);
+            bufferSize_.store(device->getCurrentBufferSizeSamples(), std::memory_order_relaxed);
         }
     }
     return error.isEmpty();
@@ -182,40 +241,14 @@ juce::String AudioEngine::getDeviceInfo() const {
     info << "Sample Rate: " << device->getCurrentSampleRate() << " Hz\n";
     info << "Buffer Size: " << device->getCurrentBufferSizeSamples() << " samples\n";
     info << "Input Channels: " << device->getInputChannelNames().size() << "\n";
-    info << "Output Channels: " << device->getOutputChannelNames().size();
+    info << "Output Channels: " << device->getOutputChannelNames().size() << "\n";
+    info << "Processing Mode: " << (processingMode_ == ProcessingMode::Pipelined ? "Pipelined" : "Direct") << "\n";
+    info << "Processing Latency: " << getProcessingLatencySamples() << " samples\n";
+    info << "Total Latency: " << getTotalLatencySamples() << " samples";
     
     return info;
 }
 
-void AudioEngine::updateLevels(
-    const float* const* inputChannelData,
-    int numInputChannels,
-    const float* const* outputChannelData,
-    int numOutputChannels,
-    int numSamples
-) noexcept {
-    // Calculate peak levels (real-time safe)
-    float inputPeak = 0.0f;
-    if (numInputChannels > 0 && inputChannelData[0] != nullptr) {
-        for (int sample = 0; sample < numSamples; ++sample) {
-            float absValue = std::abs(inputChannelData[0][sample]);
-            inputPeak = std::max(inputPeak, absValue);
-        }
-    }
-    
-    float outputPeak = 0.0f;
-    if (numOutputChannels > 0 && outputChannelData[0] != nullptr) {
-        for (int sample = 0; sample < numSamples; ++sample) {
-            float absValue = std::abs(outputChannelData[0][sample]);
-            outputPeak = std::max(outputPeak, absValue);
-        }
-    }
-    
-    // Update atomically (safe for UI thread to read)
-    inputLevel_.store(inputPeak, std::memory_order_relaxed);
-    outputLevel_.store(outputPeak, std::memory_order_relaxed);
-}
-
 void AudioEngine::audioDeviceIOCallbackWithContext(
     const float* const* inputChannelData,
     int numInputChannels,
@@ -225,71 +258,162 @@ void AudioEngine::audioDeviceIOCallbackWithContext(
     const juce::AudioIODeviceCallbackContext& context
 ) {
     (void)context; // Context not used in this implementation
-    
-    // Update levels first (real-time safe)
-    updateLevels(inputChannelData, numInputChannels, outputChannelData, numOutputChannels, numSamples);
-    
-    // Clear output buffers
-    for (int channel = 0; channel < numOutputChannels; ++channel) {
-        if (outputChannelData[channel] != nullptr) {
-            juce::FloatVectorOperations::clear(
-                outputChannelData[channel],
-                numSamples
-            );
+
+    // Decaying filter tails fall into subnormals once the guitar goes quiet;
+    // flush them to zero rather than let the FPU take the slow path
+    const juce::ScopedNoDenormals noDenormals;
+
+    // Monotonic timestamp for DSP load measurement
+    const auto callbackStart = std::chrono::steady_clock::now();
+
+    const float* input = (numInputChannels > 0 && inputChannelData != nullptr) ? inputChannelData[0] : nullptr;
+    const bool hasOutput = numOutputChannels > 0 && outputChannelData[0] != nullptr;
+
+    // Meter and tap the input first: the device may hand us one buffer for input
+    // and output, and processing runs in place on it
+    const auto tapPoint = audioTap_.getPoint();
+    if (input != nullptr) {
+        inputMeter_.measure(&input, 1, numSamples);
+        if (tapPoint == AudioTap::Point::Input) {
+            audioTap_.push(input, numSamples);
         }
     }
 
-    // Process input if available
-    // Note: Check both numInputChannels and that we actually have data
-    if (numInputChannels > 0 && inputChannelData != nullptr && inputChannelData[0] != nullptr) {
-        // Process mono input to stereo output (or mono to mono)
-        const float* input = inputChannelData[0];
-        float* output = outputChannelData[0];
-        
-        if (processor_) {
-            // Process through audio processor
-            for (int sample = 0; sample < numSamples; ++sample) {
-                output[sample] = processor_->processSample(input[sample]);
-            }
-            
-            // Copy to second channel if stereo output
-            if (numOutputChannels > 1 && outputChannelData[1] != nullptr) {
-                juce::FloatVectorOperations::copy(
-                    outputChannelData[1],
-                    output,
-                    numSamples
-                );
-            }
+    // Output channels written below; only the rest need clearing
+    int numChannels = 0;
+
+    if (input != nullptr && hasOutput) {
+        // Mono input to mono or stereo output; processors see at most two channels
+        numChannels = (numOutputChannels > 1 && outputChannelData[1] != nullptr) ? 2 : 1;
+
+        if (pipelined_) {
+            // Only exchange buffers; the pipeline thread runs the processor
+            pipeline_.process(input, outputChannelData, numChannels, numSamples);
         } else {
-            // No processor - pass through
-            juce::FloatVectorOperations::copy(output, input, numSamples);
-            if (numOutputChannels > 1 && outputChannelData[1] != nullptr) {
-                juce::FloatVectorOperations::copy(
-                    outputChannelData[1],
-                    input,
-                    numSamples
-                );
+            // Everything in this scope may dereference processor_; see setProcessor()
+            const RealtimeEpoch::ScopedReader epochReader(callbackEpoch_);
+
+            // Process straight on the device buffer; the copy is only needed
+            // when input and output are separate buffers
+            if (input != outputChannelData[0]) {
+                juce::FloatVectorOperations::copy(outputChannelData[0], input, numSamples);
             }
+            processOutput(outputChannelData, numChannels, numSamples);
+        }
+    }
+
+    for (int channel = numChannels; channel < numOutputChannels; ++channel) {
+        if (outputChannelData[channel] != nullptr) {
+            juce::FloatVectorOperations::clear(outputChannelData[channel], numSamples);
         }
-    } else {
-        // No input - output silence (already cleared above)
     }
+
+    // One meter frame per callback; the UI drains them all
+    if (numChannels > 0) {
+        outputMeter_.measure(outputChannelData, numChannels, numSamples);
+        if (tapPoint == AudioTap::Point::Output) {
+            audioTap_.push(outputChannelData[0], numSamples);
+        }
+    }
+
+    // In pipelined mode the load is the pipeline thread's, recorded there;
+    // the exchange above says nothing about how close processing runs to
+    // its deadline
+    const double sampleRate = sampleRate_.load(std::memory_order_relaxed);
+    if (sampleRate > 0.0 && !pipelined_) {
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - callbackStart;
+        loadMonitor_.recordCallback(elapsed.count(), numSamples / sampleRate);
+    }
+}
+
+void AudioEngine::processOutput(float* const* channelData, int numChannels, int numSamples) noexcept {
+    auto* processor = processor_.load(std::memory_order_seq_cst);
+
+    // Mono processors (and no processor) run on one channel and are copied
+    // out afterwards; stereo ones get the input on both channels
+    const bool stereo = numChannels > 1 && processor != nullptr
+        && processor->getChannelLayout() == AudioProcessor::ChannelLayout::Stereo;
+    const int processedChannels = stereo ? numChannels : 1;
+    if (stereo) {
+        juce::FloatVectorOperations::copy(channelData[1], channelData[0], numSamples);
+    }
+
+    if (processor != nullptr) {
+        // One block call per callback
+        const auto processStart = std::chrono::steady_clock::now();
+        processor->processChannels(channelData, processedChannels, numSamples);
+        processor->getStats().record(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - processStart
+            ).count(),
+            numSamples
+        );
+    }
+
+    for (int channel = processedChannels; channel < numChannels; ++channel) {
+        juce::FloatVectorOperations::copy(channelData[channel], channelData[0], numSamples);
+    }
+}
+
+void AudioEngine::processPipelineBlock(float* const* channelData, int numChannels, int numSamples) noexcept {
+    // The pipeline thread is the epoch reader while pipelined_ is set
+    const auto blockStart = std::chrono::steady_clock::now();
+    {
+        const RealtimeEpoch::ScopedReader epochReader(callbackEpoch_);
+        processOutput(channelData, numChannels, numSamples);
+    }
+
+    // The block has a whole period to finish; this thread is the load
+    // monitor's only writer while pipelined_ is set
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - blockStart;
+    loadMonitor_.recordCallback(elapsed.count(), numSamples / sampleRate_.load(std::memory_order_relaxed));
 }
 
 void AudioEngine::audioDeviceAboutToStart(juce::AudioIODevice* device) {
     if (device) {
-        sampleRate_ = device->getCurrentSampleRate();
-        bufferSize_ = device->getCurrentBufferSizeSamples();
+        const double sampleRate = device->getCurrentSampleRate();
+        const int bufferSize = device->getCurrentBufferSizeSamples();
+        loadMonitor_.requestReset();
+        inputMeter_.reset();
+        outputMeter_.reset();
         
-        if (processor_) {
-            processor_->prepare(sampleRate_);
+        // Not concurrent with the callback, but setProcessor() may be. The
+        // lock makes the rate and the processor change together: one being
+        // prepared now either finishes at the old rate and is re-prepared
+        // here, or starts after this and reads the new rate.
+        {
+            std::lock_guard<std::mutex> lock(prepareMutex_);
+            sampleRate_.store(sampleRate, std::memory_order_relaxed);
+            bufferSize_.store(bufferSize, std::memory_order_relaxed);
+
+            const RealtimeEpoch::ScopedReader epochReader(callbackEpoch_);
+            if (auto* processor = processor_.load(std::memory_order_seq_cst)) {
+                processor->prepare(sampleRate);
+            }
+        }
+
+        // Callbacks start after this returns, so they see the new mode
+        pipelined_ = processingMode_ == ProcessingMode::Pipelined;
+        if (pipelined_) {
+            const int numOutputs = device->getActiveOutputChannels().countNumberOfSetBits();
+            pipeline_.start(bufferSize, std::min(numOutputs, AudioPipeline::MAX_CHANNELS));
+        }
+
+        if (audioTap_.getPoint() != AudioTap::Point::Off) {
+            analyzer_.start(sampleRate);
         }
     }
 }
 
 void AudioEngine::audioDeviceStopped() {
-    if (processor_) {
-        processor_->reset();
+    // No more callbacks; stop the pipeline thread before touching the processor
+    pipeline_.stop();
+    pipelined_ = false;
+    analyzer_.stop();
+
+    const RealtimeEpoch::ScopedReader epochReader(callbackEpoch_);
+    if (auto* processor = processor_.load(std::memory_order_seq_cst)) {
+        processor->reset();
     }
 }
 
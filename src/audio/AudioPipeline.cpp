@@ -0,0 +1,171 @@
+#include "finirig/audio/AudioPipeline.h"
+#include "finirig/audio/RealtimeThread.h"
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <algorithm>
+#include <stdexcept>
+
+namespace finirig::audio {
+
+AudioPipeline::AudioPipeline(Stage& stage) : stage_(stage) {}
+
+AudioPipeline::~AudioPipeline() {
+    stop();
+}
+
+void AudioPipeline::start(int blockSize, int numChannels) {
+    if (blockSize <= 0) {
+        throw std::invalid_argument("AudioPipeline block size must be positive");
+    }
+    stop();
+
+    numChannels_ = std::clamp(numChannels, 1, MAX_CHANNELS);
+    const auto ringSize = static_cast<std::size_t>(blockSize) * RING_BLOCKS;
+    inputRing_ = std::make_unique<SpscRingBuffer<float>>(ringSize);
+
+    for (int channel = 0; channel < numChannels_; ++channel) {
+        auto& scratch = scratch_[static_cast<std::size_t>(channel)];
+        auto& ring = outputRings_[static_cast<std::size_t>(channel)];
+        scratch.assign(static_cast<std::size_t>(blockSize), 0.0f);
+        scratchChannels_[static_cast<std::size_t>(channel)] = scratch.data();
+        ring = std::make_unique<SpscRingBuffer<float>>(ringSize);
+
+        // One block of silence is the pipeline latency: the first callback
+        // plays it while the pipeline thread works on the first input block
+        ring->write(scratch.data(), scratch.size());
+    }
+
+    samplesToSkip_ = 0;
+    underruns_.store(0, std::memory_order_relaxed);
+    latencySamples_.store(blockSize, std::memory_order_relaxed);
+    stopping_.store(false, std::memory_order_relaxed);
+
+    thread_ = std::thread([this] { threadLoop(); });
+    requestRealtimePriority(thread_);
+}
+
+void AudioPipeline::stop() {
+    if (!thread_.joinable()) {
+        return;
+    }
+
+    stopping_.store(true, std::memory_order_relaxed);
+    blocksPushed_.fetch_add(1, std::memory_order_release);
+    blocksPushed_.notify_one();
+    notifySpace();
+    thread_.join();
+
+    latencySamples_.store(0, std::memory_order_relaxed);
+}
+
+void AudioPipeline::process(const float* input, float* const* outputs, int numOutputs, int numSamples) noexcept {
+    const auto count = static_cast<std::size_t>(numSamples);
+
+    if (inputRing_->write(input, count)) {
+        // notify_one only enters the kernel if the thread is asleep
+        blocksPushed_.fetch_add(1, std::memory_order_release);
+        blocksPushed_.notify_one();
+    } else {
+        // Hopelessly behind: this block will never come out, so it no
+        // longer needs skipping either
+        samplesToSkip_ -= std::min(samplesToSkip_, count);
+    }
+
+    // The pipeline thread writes the channels in order, so the last ring
+    // bounds what is ready on all of them
+    const auto last = static_cast<std::size_t>(numChannels_ - 1);
+    auto ready = outputRings_[last]->getNumReady();
+
+    // Blocks that missed their slot are dropped once they turn up, keeping
+    // input and output exactly one pipeline latency apart
+    if (samplesToSkip_ > 0 && ready > count) {
+        const auto skipped = std::min(samplesToSkip_, ready - count);
+        for (int channel = 0; channel < numChannels_; ++channel) {
+            outputRings_[static_cast<std::size_t>(channel)]->discard(skipped);
+        }
+        samplesToSkip_ -= skipped;
+        ready -= skipped;
+        notifySpace();
+    }
+
+    if (ready < count) {
+        for (int channel = 0; channel < numOutputs; ++channel) {
+            juce::FloatVectorOperations::clear(outputs[channel], numSamples);
+        }
+        samplesToSkip_ += count;
+        underruns_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    for (int channel = 0; channel < numChannels_; ++channel) {
+        auto& ring = *outputRings_[static_cast<std::size_t>(channel)];
+        if (channel < numOutputs) {
+            ring.read(outputs[channel], count);
+        } else {
+            ring.discard(count);
+        }
+    }
+    for (int channel = numChannels_; channel < numOutputs; ++channel) {
+        juce::FloatVectorOperations::copy(outputs[channel], outputs[numChannels_ - 1], numSamples);
+    }
+
+    notifySpace();
+}
+
+void AudioPipeline::notifySpace() noexcept {
+    // Room in the output rings for a pipeline thread waiting to write
+    blocksPopped_.fetch_add(1, std::memory_order_release);
+    blocksPopped_.notify_one();
+}
+
+void AudioPipeline::threadLoop() noexcept {
+    // FTZ/DAZ are per-thread state; set them once for the thread's lifetime
+    const juce::ScopedNoDenormals noDenormals;
+    auto seen = blocksPushed_.load(std::memory_order_acquire);
+    const auto blockSize = scratch_[0].size();
+
+    while (true) {
+        // Drain everything pushed so far, at most one block per stage call
+        while (const auto ready = inputRing_->getNumReady()) {
+            const auto count = std::min(ready, blockSize);
+            inputRing_->read(scratchChannels_[0], count);
+            stage_.processPipelineBlock(scratchChannels_.data(), numChannels_, static_cast<int>(count));
+
+            // process() already counts this block as on its way, so dropping
+            // it would shift the output against the input. Wait for the
+            // callback to make room instead; the input ring absorbs the delay.
+            if (!waitForSpace(count)) {
+                return;
+            }
+            for (int channel = 0; channel < numChannels_; ++channel) {
+                outputRings_[static_cast<std::size_t>(channel)]->write(scratchChannels_[static_cast<std::size_t>(channel)], count);
+            }
+        }
+
+        if (stopping_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        blocksPushed_.wait(seen, std::memory_order_acquire);
+        seen = blocksPushed_.load(std::memory_order_acquire);
+    }
+}
+
+bool AudioPipeline::waitForSpace(std::size_t count) noexcept {
+    // Read the counter before checking, so a pop in between ends the wait
+    auto seen = blocksPopped_.load(std::memory_order_acquire);
+    while (true) {
+        bool fits = true;
+        for (int channel = 0; channel < numChannels_; ++channel) {
+            fits = fits && outputRings_[static_cast<std::size_t>(channel)]->getFreeSpace() >= count;
+        }
+        if (fits) {
+            return true;
+        }
+        if (stopping_.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        blocksPopped_.wait(seen, std::memory_order_acquire);
+        seen = blocksPopped_.load(std::memory_order_acquire);
+    }
+}
+
+} // namespace finirig::audio
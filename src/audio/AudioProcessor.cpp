@@ -2,6 +2,12 @@
 
 namespace finirig::audio {
 
+void AudioProcessor::notifyLatencyChanged() {
+    if (auto* parent = latencyParent_.load(std::memory_order_acquire)) {
+        parent->stageLatencyChanged();
+    }
+}
+
 void AudioProcessor::processBlock(
     float* buffer,
     int numChannels,
@@ -19,5 +25,26 @@ void AudioProcessor::processBlock(
     }
 }
 
+void AudioProcessor::processChannels(
+    float* const* channelData,
+    int numChannels,
+    int numSamples
+) noexcept {
+    if (numChannels <= 0) {
+        return;
+    }
+
+    // Default implementation: process the first channel sample by sample
+    float* data = channelData[0];
+    for (int sample = 0; sample < numSamples; ++sample) {
+        data[sample] = processSample(data[sample]);
+    }
+
+    // Mono to stereo/mono: copy the result to the remaining channels
+    for (int channel = 1; channel < numChannels; ++channel) {
+        juce::FloatVectorOperations::copy(channelData[channel], data, numSamples);
+    }
+}
+
 } // namespace finirig::audio
 
@@ -0,0 +1,27 @@
+#include "finirig/audio/AudioTap.h"
+#include <algorithm>
+
+namespace finirig::audio {
+
+AudioTap::AudioTap(std::size_t capacitySamples) : fifo_(capacitySamples) {}
+
+void AudioTap::push(const float* samples, int numSamples) noexcept {
+    if (numSamples <= 0) {
+        return;
+    }
+    if (!fifo_.write(samples, static_cast<std::size_t>(numSamples))) {
+        droppedSamples_.fetch_add(static_cast<std::uint64_t>(numSamples), std::memory_order_relaxed);
+    }
+}
+
+std::size_t AudioTap::pull(float* samples, std::size_t maxSamples) noexcept {
+    const auto count = std::min(fifo_.getNumReady(), maxSamples);
+    fifo_.read(samples, count);
+    return count;
+}
+
+void AudioTap::discardPending() noexcept {
+    fifo_.discard(fifo_.getNumReady());
+}
+
+} // namespace finirig::audio
@@ -0,0 +1,129 @@
+#include "finirig/audio/AudioWorkerPool.h"
+#include "finirig/audio/RealtimeThread.h"
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <algorithm>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+namespace finirig::audio {
+
+AudioWorkerPool::AudioWorkerPool(int numWorkers) {
+    if (numWorkers < 0 || numWorkers > MAX_WORKERS) {
+        throw std::invalid_argument("AudioWorkerPool worker count out of range");
+    }
+
+    threads_.reserve(static_cast<size_t>(numWorkers));
+    for (int index = 1; index <= numWorkers; ++index) {
+        threads_.emplace_back([this, index] { workerLoop(index); });
+        requestRealtimePriority(threads_.back());
+    }
+}
+
+AudioWorkerPool::~AudioWorkerPool() {
+    stopping_.store(true, std::memory_order_relaxed);
+    generation_.fetch_add(1, std::memory_order_release);
+    generation_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+int AudioWorkerPool::getDefaultWorkerCount() noexcept {
+    const auto cores = static_cast<int>(std::thread::hardware_concurrency());
+    return std::clamp(cores - 1, 0, 3);
+}
+
+void AudioWorkerPool::pause() noexcept {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#else
+    std::this_thread::yield();
+#endif
+}
+
+void AudioWorkerPool::run(Job& job, const int* initialTasks, int numInitialTasks, int numTasks) noexcept {
+    if (numTasks <= 0) {
+        return;
+    }
+
+    job_.store(&job, std::memory_order_relaxed);
+    remainingTasks_.store(numTasks, std::memory_order_relaxed);
+    for (int i = 0; i < numInitialTasks; ++i) {
+        queues_[0].push(initialTasks[i]);
+    }
+
+    // Wake the workers; notify_all only enters the kernel if one is asleep
+    if (!threads_.empty()) {
+        generation_.fetch_add(1, std::memory_order_release);
+        generation_.notify_all();
+    }
+
+    participate(0);
+}
+
+void AudioWorkerPool::workerLoop(int index) noexcept {
+    // Workers run graph nodes too, so they need the same FTZ/DAZ mode as the
+    // audio thread
+    const juce::ScopedNoDenormals noDenormals;
+    auto seen = generation_.load(std::memory_order_acquire);
+
+    while (true) {
+        // Spin first: the next sub-block usually follows within microseconds
+        int spins = 0;
+        while (generation_.load(std::memory_order_acquire) == seen && spins < SPIN_ITERATIONS) {
+            pause();
+            ++spins;
+        }
+        generation_.wait(seen, std::memory_order_acquire);
+        seen = generation_.load(std::memory_order_acquire);
+
+        if (stopping_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        participate(index);
+    }
+}
+
+void AudioWorkerPool::participate(int index) noexcept {
+    std::array<int, MAX_TASKS> ready{};
+
+    while (remainingTasks_.load(std::memory_order_acquire) > 0) {
+        int task = 0;
+        if (!findTask(index, task)) {
+            // Everything left is running elsewhere or waits on it
+            pause();
+            continue;
+        }
+
+        // A task taken from a queue belongs to the job that pushed it
+        auto* job = job_.load(std::memory_order_relaxed);
+        const int numReady = job->runTask(task, ready.data());
+        for (int i = 0; i < numReady; ++i) {
+            queues_[static_cast<size_t>(index)].push(ready[static_cast<size_t>(i)]);
+        }
+        remainingTasks_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
+
+bool AudioWorkerPool::findTask(int index, int& task) noexcept {
+    if (queues_[static_cast<size_t>(index)].pop(task)) {
+        return true;
+    }
+
+    // Steal round-robin starting after our own queue, audio thread included
+    const int participants = getNumWorkers() + 1;
+    for (int offset = 1; offset < participants; ++offset) {
+        const int victim = (index + offset) % participants;
+        if (queues_[static_cast<size_t>(victim)].steal(task)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace finirig::audio
@@ -0,0 +1,68 @@
+#include "finirig/audio/CallbackLoadMonitor.h"
+#include <algorithm>
+
+namespace finirig::audio {
+
+namespace {
+// Smoothing for averageLoad; roughly the last 30 callbacks
+constexpr float AVERAGE_COEFF = 1.0f / 30.0f;
+}
+
+void CallbackLoadMonitor::recordCallback(double elapsedSeconds, double periodSeconds) noexcept {
+    if (resetRequested_.exchange(false, std::memory_order_relaxed)) {
+        clear();
+    }
+
+    if (periodSeconds <= 0.0) {
+        return;
+    }
+
+    const auto load = static_cast<float>(elapsedSeconds / periodSeconds);
+
+    // Single writer: plain load/store pairs are enough, readers only need
+    // each value to be untorn
+    const auto bin = std::clamp(static_cast<int>(load / BIN_WIDTH), 0, NUM_BINS - 1);
+    auto& counter = histogram_[static_cast<size_t>(bin)];
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+    if (load >= 1.0f) {
+        numOverruns_.store(numOverruns_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    if (load > maxLoad_.load(std::memory_order_relaxed)) {
+        maxLoad_.store(load, std::memory_order_relaxed);
+    }
+
+    const auto average = averageLoad_.load(std::memory_order_relaxed);
+    averageLoad_.store(average + (load - average) * AVERAGE_COEFF, std::memory_order_relaxed);
+    currentLoad_.store(load, std::memory_order_relaxed);
+
+    // Published last so a reader that sees the count sees the rest
+    numCallbacks_.store(numCallbacks_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+CallbackLoadMonitor::Snapshot CallbackLoadMonitor::getSnapshot() const noexcept {
+    Snapshot snapshot;
+    snapshot.numCallbacks = numCallbacks_.load(std::memory_order_acquire);
+    for (size_t bin = 0; bin < histogram_.size(); ++bin) {
+        snapshot.histogram[bin] = histogram_[bin].load(std::memory_order_relaxed);
+    }
+    snapshot.numOverruns = numOverruns_.load(std::memory_order_relaxed);
+    snapshot.currentLoad = currentLoad_.load(std::memory_order_relaxed);
+    snapshot.averageLoad = averageLoad_.load(std::memory_order_relaxed);
+    snapshot.maxLoad = maxLoad_.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+void CallbackLoadMonitor::clear() noexcept {
+    for (auto& counter : histogram_) {
+        counter.store(0, std::memory_order_relaxed);
+    }
+    numOverruns_.store(0, std::memory_order_relaxed);
+    currentLoad_.store(0.0f, std::memory_order_relaxed);
+    averageLoad_.store(0.0f, std::memory_order_relaxed);
+    maxLoad_.store(0.0f, std::memory_order_relaxed);
+    numCallbacks_.store(0, std::memory_order_release);
+}
+
+} // namespace finirig::audio
@@ -0,0 +1,215 @@
+#include "finirig/audio/DeviceCatalogue.h"
+#include <algorithm>
+#include <utility>
+
+namespace finirig::audio {
+
+namespace {
+
+juce::StringArray prefixWithType(const std::vector<DeviceCatalogue::DeviceType>& types, bool input) {
+    juce::StringArray names;
+    for (const auto& type : types) {
+        for (const auto& device : input ? type.inputDevices : type.outputDevices) {
+            names.add(type.typeName + ": " + device);
+        }
+    }
+    return names;
+}
+
+bool sameDevices(const DeviceCatalogue::DeviceType& a, const DeviceCatalogue::DeviceType& b) {
+    return a.typeName == b.typeName
+        && a.inputDevices == b.inputDevices
+        && a.outputDevices == b.outputDevices;
+}
+
+/**
+ * Scans the platform's JUCE device types.
+ *
+ * The types are created on the constructing thread, which is cheap and
+ * keeps their OS notification hooks on the thread JUCE expects; only
+ * scanForDevices(), the slow part, runs on the catalogue thread. These
+ * are separate instances from the engine's AudioDeviceManager, so a scan
+ * never touches the device that is playing.
+ */
+class JuceDeviceScanner final : public DeviceCatalogue::Scanner {
+public:
+    JuceDeviceScanner() {
+        // The manager only serves as the factory for this platform's types
+        juce::AudioDeviceManager factory;
+        factory.createAudioDeviceTypes(types_);
+
+        for (auto* type : types_) {
+            listeners_.push_back(std::make_unique<TypeListener>(*this, type->getTypeName()));
+            type->addListener(listeners_.back().get());
+        }
+    }
+
+    ~JuceDeviceScanner() override {
+        for (int i = 0; i < types_.size(); ++i) {
+            types_[i]->removeListener(listeners_[static_cast<std::size_t>(i)].get());
+        }
+    }
+
+    int getNumTypes() override { return types_.size(); }
+
+    juce::String getTypeName(int typeIndex) override { return types_[typeIndex]->getTypeName(); }
+
+    DeviceCatalogue::DeviceType scan(int typeIndex) override {
+        auto* type = types_[typeIndex];
+        type->scanForDevices();
+        return {type->getTypeName(), type->getDeviceNames(true), type->getDeviceNames(false)};
+    }
+
+    void setListChangedCallback(std::function<void(const juce::String&)> callback) override {
+        listChanged_ = std::move(callback);
+    }
+
+private:
+    // One per type, so the notification knows which type to rescan
+    struct TypeListener final : juce::AudioIODeviceType::Listener {
+        TypeListener(JuceDeviceScanner& owner, juce::String typeName)
+            : owner_(owner)
+            , typeName_(std::move(typeName))
+        {
+        }
+
+        void audioDeviceListChanged() override {
+            if (owner_.listChanged_) {
+                owner_.listChanged_(typeName_);
+            }
+        }
+
+        JuceDeviceScanner& owner_;
+        juce::String typeName_;
+    };
+
+    juce::OwnedArray<juce::AudioIODeviceType> types_;
+    std::vector<std::unique_ptr<TypeListener>> listeners_;
+    std::function<void(const juce::String&)> listChanged_;
+};
+
+} // namespace
+
+juce::StringArray DeviceCatalogue::Snapshot::getInputDeviceNames() const {
+    return prefixWithType(types, true);
+}
+
+juce::StringArray DeviceCatalogue::Snapshot::getOutputDeviceNames() const {
+    return prefixWithType(types, false);
+}
+
+DeviceCatalogue::DeviceCatalogue(std::unique_ptr<Scanner> scanner)
+    : scanner_(scanner ? std::move(scanner) : std::make_unique<JuceDeviceScanner>())
+{
+    scanner_->setListChangedCallback([this](const juce::String& typeName) { requestRescan(typeName); });
+    thread_ = std::thread([this] { run(); });
+}
+
+DeviceCatalogue::~DeviceCatalogue() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shouldExit_ = true;
+    }
+    condition_.notify_one();
+    thread_.join();
+
+    // Unhook hot-plug notifications while the rest of the catalogue is alive
+    scanner_.reset();
+}
+
+void DeviceCatalogue::setChangeCallback(ChangeCallback callback) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    changeCallback_ = std::move(callback);
+}
+
+void DeviceCatalogue::requestRescan() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        rescanAll_ = true;
+    }
+    condition_.notify_one();
+}
+
+void DeviceCatalogue::requestRescan(const juce::String& typeName) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (std::find(pendingTypes_.begin(), pendingTypes_.end(), typeName) == pendingTypes_.end()) {
+            pendingTypes_.push_back(typeName);
+        }
+    }
+    condition_.notify_one();
+}
+
+DeviceCatalogue::Snapshot DeviceCatalogue::getSnapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return snapshot_;
+}
+
+std::uint64_t DeviceCatalogue::getTypeScanCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return typeScanCount_;
+}
+
+void DeviceCatalogue::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        condition_.wait(lock, [this] { return shouldExit_ || rescanAll_ || !pendingTypes_.empty(); });
+        if (shouldExit_) {
+            break;
+        }
+
+        // Take everything requested so far; requests arriving during the
+        // scan are picked up by the next pass
+        const bool allTypes = std::exchange(rescanAll_, false);
+        const auto typeNames = std::exchange(pendingTypes_, {});
+
+        lock.unlock();
+        scan(allTypes, typeNames);
+        lock.lock();
+    }
+}
+
+void DeviceCatalogue::scan(bool allTypes, const std::vector<juce::String>& typeNames) {
+    const auto numTypes = static_cast<std::size_t>(std::max(0, scanner_->getNumTypes()));
+    if (types_.size() != numTypes) {
+        types_.resize(numTypes);
+        allTypes = true;
+    }
+
+    bool changed = false;
+    std::uint64_t typesScanned = 0;
+    for (std::size_t i = 0; i < numTypes; ++i) {
+        const int typeIndex = static_cast<int>(i);
+        if (!allTypes) {
+            const auto typeName = scanner_->getTypeName(typeIndex);
+            if (std::find(typeNames.begin(), typeNames.end(), typeName) == typeNames.end()) {
+                continue;
+            }
+        }
+
+        auto type = scanner_->scan(typeIndex);
+        ++typesScanned;
+        if (!sameDevices(type, types_[i])) {
+            types_[i] = std::move(type);
+            changed = true;
+        }
+    }
+
+    ChangeCallback callback;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        typeScanCount_ += typesScanned;
+        if (changed || !snapshot_.scanned) {
+            snapshot_.types = types_;
+            snapshot_.scanned = true;
+            ++snapshot_.generation;
+            callback = changeCallback_;
+        }
+    }
+
+    if (callback) {
+        callback();
+    }
+}
+
+} // namespace finirig::audio
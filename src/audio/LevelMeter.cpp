@@ -0,0 +1,130 @@
+#include "finirig/audio/LevelMeter.h"
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <algorithm>
+#include <cmath>
+
+namespace finirig::audio {
+
+namespace {
+
+float getPeak(const float* data, int numSamples) noexcept {
+    const auto range = juce::FloatVectorOperations::findMinAndMax(data, numSamples);
+    return std::max(-range.getStart(), range.getEnd());
+}
+
+} // namespace
+
+// ITU-R BS.1770-4 Annex 2 polyphase interpolator, one row per phase
+const float LevelMeter::TRUE_PEAK_COEFFICIENTS[TRUE_PEAK_PHASES][TRUE_PEAK_TAPS] = {
+    { 0.0017089843750f,  0.0109863281250f, -0.0196533203125f,  0.0332031250000f,
+     -0.0594482421875f,  0.1373291015625f,  0.9721679687500f, -0.1022949218750f,
+      0.0476074218750f, -0.0266113281250f,  0.0148925781250f, -0.0083007812500f},
+    {-0.0291748046875f,  0.0292968750000f, -0.0517578125000f,  0.0891113281250f,
+     -0.1665039062500f,  0.4650878906250f,  0.7797851562500f, -0.2003173828125f,
+      0.1015625000000f, -0.0582275390625f,  0.0330810546875f, -0.0189208984375f},
+    {-0.0189208984375f,  0.0330810546875f, -0.0582275390625f,  0.1015625000000f,
+     -0.2003173828125f,  0.7797851562500f,  0.4650878906250f, -0.1665039062500f,
+      0.0891113281250f, -0.0517578125000f,  0.0292968750000f, -0.0291748046875f},
+    {-0.0083007812500f,  0.0148925781250f, -0.0266113281250f,  0.0476074218750f,
+     -0.1022949218750f,  0.9721679687500f,  0.1373291015625f, -0.0594482421875f,
+      0.0332031250000f, -0.0196533203125f,  0.0109863281250f,  0.0017089843750f}
+};
+
+void LevelMeter::Frame::merge(const Frame& other) noexcept {
+    const int total = numSamples + other.numSamples;
+    for (int channel = 0; channel < other.numChannels; ++channel) {
+        auto& levels = channels[static_cast<std::size_t>(channel)];
+        const auto& next = other.channels[static_cast<std::size_t>(channel)];
+
+        // A channel this frame lacks contributed silence so far
+        const float energy = channel < numChannels ? levels.rms * levels.rms * static_cast<float>(numSamples) : 0.0f;
+        const float nextEnergy = next.rms * next.rms * static_cast<float>(other.numSamples);
+        levels.rms = total > 0 ? std::sqrt((energy + nextEnergy) / static_cast<float>(total)) : 0.0f;
+
+        levels.peak = std::max(levels.peak, next.peak);
+        levels.truePeak = std::max(levels.truePeak, next.truePeak);
+        levels.clipped = levels.clipped || next.clipped;
+    }
+    numChannels = std::max(numChannels, other.numChannels);
+    numSamples = total;
+}
+
+LevelMeter::LevelMeter(std::size_t capacityFrames)
+    : frames_(capacityFrames)
+    , dotProduct_(dsp::getDotProductKernel())
+{
+}
+
+void LevelMeter::measure(const float* const* channelData, int numChannels, int numSamples) noexcept {
+    if (numSamples <= 0) {
+        return;
+    }
+
+    Frame frame;
+    frame.numChannels = std::clamp(numChannels, 0, MAX_CHANNELS);
+    frame.numSamples = numSamples;
+
+    for (int channel = 0; channel < frame.numChannels; ++channel) {
+        const float* data = channelData[channel];
+        auto& levels = frame.channels[static_cast<std::size_t>(channel)];
+
+        levels.peak = getPeak(data, numSamples);
+        levels.rms = std::sqrt(dotProduct_(data, data, numSamples) / static_cast<float>(numSamples));
+        levels.truePeak = std::max(levels.peak, measureTruePeak(channel, data, numSamples));
+        levels.clipped = levels.peak >= CLIP_LEVEL;
+    }
+
+    if (!frames_.write(&frame, 1)) {
+        droppedFrames_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void LevelMeter::reset() noexcept {
+    for (auto& history : history_) {
+        history.fill(0.0f);
+    }
+}
+
+int LevelMeter::drain(Frame& total) noexcept {
+    Frame frame;
+    int count = 0;
+    while (frames_.read(&frame, 1)) {
+        if (count == 0) {
+            total = frame;
+        } else {
+            total.merge(frame);
+        }
+        ++count;
+    }
+    return count;
+}
+
+float LevelMeter::measureTruePeak(int channel, const float* data, int numSamples) noexcept {
+    constexpr int OVERLAP = TRUE_PEAK_TAPS - 1;
+    auto& history = history_[static_cast<std::size_t>(channel)];
+    float truePeak = 0.0f;
+
+    for (int offset = 0; offset < numSamples; offset += CHUNK_SIZE) {
+        const int count = std::min(CHUNK_SIZE, numSamples - offset);
+        std::copy(data + offset, data + offset + count, history.data() + OVERLAP);
+
+        // Transposed FIR: one vector multiply-add pass per tap and phase
+        // instead of a short dot product per output sample
+        for (const auto& phase : TRUE_PEAK_COEFFICIENTS) {
+            juce::FloatVectorOperations::clear(interpolated_.data(), count);
+            for (int tap = 0; tap < TRUE_PEAK_TAPS; ++tap) {
+                juce::FloatVectorOperations::addWithMultiply(
+                    interpolated_.data(), history.data() + OVERLAP - tap, phase[tap], count
+                );
+            }
+            truePeak = std::max(truePeak, getPeak(interpolated_.data(), count));
+        }
+
+        // Keep the newest samples for the next chunk's first outputs
+        std::copy(history.data() + count, history.data() + count + OVERLAP, history.data());
+    }
+
+    return truePeak;
+}
+
+} // namespace finirig::audio
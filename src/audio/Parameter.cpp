@@ -0,0 +1,85 @@
+#include "finirig/audio/Parameter.h"
+#include <algorithm>
+#include <cmath>
+
+namespace finirig::audio {
+
+namespace {
+constexpr double DEFAULT_SAMPLE_RATE = 44100.0;
+}
+
+Parameter::Parameter(
+    float defaultValue,
+    float minValue,
+    float maxValue,
+    Smoothing smoothing,
+    double rampSeconds
+) noexcept
+    : minValue_(minValue)
+    , maxValue_(maxValue)
+    , smoothing_(smoothing)
+    , rampSeconds_(std::max(0.0, rampSeconds))
+    , target_(std::clamp(defaultValue, minValue, maxValue))
+    , current_(target_.load(std::memory_order_relaxed))
+    , rampTarget_(current_)
+{
+    prepare(DEFAULT_SAMPLE_RATE);
+}
+
+void Parameter::setValue(float value) noexcept {
+    target_.store(std::clamp(value, minValue_, maxValue_), std::memory_order_relaxed);
+}
+
+void Parameter::prepare(double sampleRate) noexcept {
+    rampSamples_ = std::max(1, static_cast<int>(std::lround(rampSeconds_ * sampleRate)));
+
+    // Per-sample decay that closes 60 dB of the gap over the ramp
+    sampleDecay_ = std::exp(std::log(0.001) / rampSamples_);
+    blockDecaySize_ = 0;
+
+    reset();
+}
+
+void Parameter::reset() noexcept {
+    current_ = target_.load(std::memory_order_relaxed);
+    rampTarget_ = current_;
+    remaining_ = 0;
+}
+
+bool Parameter::advance(int numSamples) noexcept {
+    const float target = target_.load(std::memory_order_relaxed);
+    if (target != rampTarget_) {
+        startRamp(target);
+    }
+
+    if (remaining_ <= 0 || numSamples <= 0) {
+        return false;
+    }
+
+    remaining_ -= numSamples;
+    if (remaining_ <= 0) {
+        remaining_ = 0;
+        current_ = rampTarget_;
+        return true;
+    }
+
+    if (smoothing_ == Smoothing::Linear) {
+        current_ += linearStep_ * static_cast<float>(numSamples);
+    } else {
+        // Blocks are nearly always the same size, so the pow() is cached
+        if (numSamples != blockDecaySize_) {
+            blockDecay_ = std::pow(sampleDecay_, numSamples);
+            blockDecaySize_ = numSamples;
+        }
+        current_ = rampTarget_ + static_cast<float>((current_ - rampTarget_) * blockDecay_);
+    }
+    return true;
+}
+
+void Parameter::startRamp(float target) noexcept {
+    rampTarget_ = target;
+    remaining_ = rampSamples_;
+    linearStep_ = (target - current_) / static_cast<float>(rampSamples_);
+}
+
+} // namespace finirig::audio
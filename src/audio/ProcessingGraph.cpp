@@ -0,0 +1,441 @@
+#include "finirig/audio/ProcessingGraph.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace finirig::audio {
+
+static_assert(ProcessingGraph::MAX_NODES <= AudioWorkerPool::MAX_TASKS,
+              "Every node of a slice must fit in one worker pool job");
+
+ProcessingGraph::ProcessingGraph(int numWorkers)
+    : inputScratch_(std::make_unique<Buffer>())
+    , outputScratch_(std::make_unique<Buffer>())
+    , pool_(std::make_unique<AudioWorkerPool>(numWorkers))
+{
+    connections_.reserve(MAX_NODES * 2);
+    publish(compile());
+}
+
+ProcessingGraph::~ProcessingGraph() = default;
+
+int ProcessingGraph::addNode(std::unique_ptr<AudioProcessor> processor) {
+    std::lock_guard<std::mutex> lock(controlMutex_);
+    const auto slot = std::find(nodes_.begin(), nodes_.end(), nullptr);
+    if (slot == nodes_.end()) {
+        throw std::length_error("ProcessingGraph is full");
+    }
+    if (!processor) {
+        throw std::invalid_argument("ProcessingGraph node must not be null");
+    }
+
+    if (sampleRate_ > 0.0) {
+        processor->prepare(sampleRate_);
+    }
+    setLatencyParent(*processor, this);
+    *slot = std::move(processor);
+
+    // Unconnected nodes are not scheduled, so nothing to publish yet
+    return static_cast<int>(slot - nodes_.begin());
+}
+
+std::unique_ptr<AudioProcessor> ProcessingGraph::removeNode(int node) {
+    std::unique_lock<std::mutex> lock(controlMutex_);
+    checkNode(node);
+
+    auto processor = std::move(nodes_[static_cast<size_t>(node)]);
+
+    // Keep the removed connections alive until the audio thread has let go
+    std::vector<std::unique_ptr<Connection>> removed;
+    for (auto it = connections_.begin(); it != connections_.end();) {
+        if ((*it)->source == node || (*it)->destination == node) {
+            removed.push_back(std::move(*it));
+            it = connections_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    const bool latencyChanged = publish(compile());
+    setLatencyParent(*processor, nullptr);
+
+    lock.unlock();
+    if (latencyChanged) {
+        notifyLatencyChanged();
+    }
+    return processor;
+}
+
+void ProcessingGraph::connect(int source, int destination, float gain) {
+    std::unique_lock<std::mutex> lock(controlMutex_);
+    checkEndpoint(source, true);
+    checkEndpoint(destination, false);
+
+    for (const auto& connection : connections_) {
+        if (connection->source == source && connection->destination == destination) {
+            connection->gain.store(gain, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    connections_.push_back(std::make_unique<Connection>(source, destination, gain));
+    bool latencyChanged = false;
+    try {
+        latencyChanged = publish(compile());
+    } catch (...) {
+        connections_.pop_back();
+        throw;
+    }
+
+    lock.unlock();
+    if (latencyChanged) {
+        notifyLatencyChanged();
+    }
+}
+
+void ProcessingGraph::disconnect(int source, int destination) {
+    std::unique_lock<std::mutex> lock(controlMutex_);
+    const auto it = std::find_if(connections_.begin(), connections_.end(), [&](const auto& connection) {
+        return connection->source == source && connection->destination == destination;
+    });
+    if (it == connections_.end()) {
+        return;
+    }
+
+    const auto removed = std::move(*it);
+    connections_.erase(it);
+    const bool latencyChanged = publish(compile());
+
+    lock.unlock();
+    if (latencyChanged) {
+        notifyLatencyChanged();
+    }
+}
+
+bool ProcessingGraph::isConnected(int source, int destination) const {
+    std::lock_guard<std::mutex> lock(controlMutex_);
+    return std::any_of(connections_.begin(), connections_.end(), [&](const auto& connection) {
+        return connection->source == source && connection->destination == destination;
+    });
+}
+
+AudioProcessor* ProcessingGraph::getNode(int node) const {
+    std::lock_guard<std::mutex> lock(controlMutex_);
+    checkNode(node);
+    return nodes_[static_cast<size_t>(node)].get();
+}
+
+int ProcessingGraph::getNumNodes() const {
+    std::lock_guard<std::mutex> lock(controlMutex_);
+    return static_cast<int>(std::count_if(nodes_.begin(), nodes_.end(), [](const auto& node) {
+        return node != nullptr;
+    }));
+}
+
+void ProcessingGraph::prepare(double sampleRate) {
+    std::lock_guard<std::mutex> lock(controlMutex_);
+    sampleRate_ = sampleRate;
+    for (auto& node : nodes_) {
+        if (node) {
+            node->prepare(sampleRate);
+        }
+    }
+
+    // Node latencies can depend on the sample rate
+    updateLatency();
+}
+
+void ProcessingGraph::reset() {
+    std::lock_guard<std::mutex> lock(controlMutex_);
+    for (auto& node : nodes_) {
+        if (node) {
+            node->reset();
+        }
+    }
+}
+
+void ProcessingGraph::processBlock(
+    float* buffer,
+    int numChannels,
+    int numSamples
+) noexcept {
+    if (numChannels <= 0) {
+        return;
+    }
+
+    const RealtimeEpoch::ScopedReader reader(processEpoch_);
+    auto& schedule = *schedule_.load(std::memory_order_seq_cst);
+    float* input = inputScratch_->samples.data();
+    const float* output = outputScratch_->samples.data();
+
+    // Deinterleave the first channel, run the graph, write the result to
+    // every channel (mono to stereo/mono)
+    for (int offset = 0; offset < numSamples; offset += SUB_BLOCK_SIZE) {
+        const int count = std::min(SUB_BLOCK_SIZE, numSamples - offset);
+        float* frames = buffer + static_cast<ptrdiff_t>(offset) * numChannels;
+
+        for (int sample = 0; sample < count; ++sample) {
+            input[sample] = frames[sample * numChannels];
+        }
+
+        runSlice(schedule, input, outputScratch_->samples.data(), count);
+
+        for (int sample = 0; sample < count; ++sample) {
+            for (int channel = 0; channel < numChannels; ++channel) {
+                frames[sample * numChannels + channel] = output[sample];
+            }
+        }
+    }
+}
+
+void ProcessingGraph::processChannels(
+    float* const* channelData,
+    int numChannels,
+    int numSamples
+) noexcept {
+    if (numChannels <= 0) {
+        return;
+    }
+
+    const RealtimeEpoch::ScopedReader reader(processEpoch_);
+    auto& schedule = *schedule_.load(std::memory_order_seq_cst);
+    float* data = channelData[0];
+    float* output = outputScratch_->samples.data();
+
+    // The input is read straight from the channel; the output goes to
+    // scratch first because the dry path may still need the input
+    for (int offset = 0; offset < numSamples; offset += SUB_BLOCK_SIZE) {
+        const int count = std::min(SUB_BLOCK_SIZE, numSamples - offset);
+        runSlice(schedule, data + offset, output, count);
+        juce::FloatVectorOperations::copy(data + offset, output, count);
+    }
+
+    for (int channel = 1; channel < numChannels; ++channel) {
+        juce::FloatVectorOperations::copy(channelData[channel], data, numSamples);
+    }
+}
+
+void ProcessingGraph::runSlice(Schedule& schedule, const float* input, float* output, int numSamples) noexcept {
+    runningSchedule_ = &schedule;
+    sliceInput_ = input;
+    sliceSamples_ = numSamples;
+
+    // Published to the workers by the queue push inside run()
+    for (auto& task : schedule.tasks) {
+        task.pending.store(task.numDependencies, std::memory_order_relaxed);
+    }
+
+    pool_->run(
+        *this,
+        schedule.roots.data(),
+        static_cast<int>(schedule.roots.size()),
+        static_cast<int>(schedule.tasks.size())
+    );
+
+    mixInputs(schedule.outputs, output);
+}
+
+int ProcessingGraph::runTask(int taskIndex, int* readyTasks) noexcept {
+    auto& tasks = runningSchedule_->tasks;
+    auto& task = tasks[static_cast<size_t>(taskIndex)];
+
+    mixInputs(task.inputs, task.buffer);
+    float* channels[] = {task.buffer};
+    task.processor->processChannels(channels, 1, sliceSamples_);
+
+    // The last input to finish hands the dependent on; acq_rel carries
+    // every input's buffer writes along with the count
+    int numReady = 0;
+    for (int dependent : task.dependents) {
+        if (tasks[static_cast<size_t>(dependent)].pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            readyTasks[numReady++] = dependent;
+        }
+    }
+    return numReady;
+}
+
+void ProcessingGraph::mixInputs(const std::vector<Input>& inputs, float* destination) const noexcept {
+    const int numSamples = sliceSamples_;
+    if (inputs.empty()) {
+        juce::FloatVectorOperations::clear(destination, numSamples);
+        return;
+    }
+
+    for (size_t index = 0; index < inputs.size(); ++index) {
+        const auto& input = inputs[index];
+        const float* source = input.source != nullptr ? input.source : sliceInput_;
+        const float gain = input.connection->gain.load(std::memory_order_relaxed);
+        if (index == 0) {
+            juce::FloatVectorOperations::multiply(destination, source, gain, numSamples);
+        } else {
+            juce::FloatVectorOperations::addWithMultiply(destination, source, gain, numSamples);
+        }
+    }
+}
+
+void ProcessingGraph::checkNode(int node) const {
+    if (node < 0 || node >= MAX_NODES || !nodes_[static_cast<size_t>(node)]) {
+        throw std::out_of_range("ProcessingGraph node id is unknown");
+    }
+}
+
+void ProcessingGraph::checkEndpoint(int endpoint, bool isSource) const {
+    if (endpoint == (isSource ? INPUT : OUTPUT)) {
+        return;
+    }
+    if (endpoint == INPUT || endpoint == OUTPUT) {
+        throw std::invalid_argument(isSource ? "OUTPUT cannot be a source" : "INPUT cannot be a destination");
+    }
+    checkNode(endpoint);
+}
+
+std::vector<int> ProcessingGraph::sortNodes() const {
+    // Kahn's algorithm over node-to-node connections
+    std::array<int, MAX_NODES> numInputs{};
+    int numNodes = 0;
+    for (const auto& connection : connections_) {
+        if (connection->source != INPUT && connection->destination != OUTPUT) {
+            ++numInputs[static_cast<size_t>(connection->destination)];
+        }
+    }
+
+    std::vector<int> order;
+    order.reserve(MAX_NODES);
+    for (int node = 0; node < MAX_NODES; ++node) {
+        if (nodes_[static_cast<size_t>(node)]) {
+            ++numNodes;
+            if (numInputs[static_cast<size_t>(node)] == 0) {
+                order.push_back(node);
+            }
+        }
+    }
+
+    for (size_t next = 0; next < order.size(); ++next) {
+        for (const auto& connection : connections_) {
+            if (connection->source == order[next] && connection->destination != OUTPUT
+                && --numInputs[static_cast<size_t>(connection->destination)] == 0) {
+                order.push_back(connection->destination);
+            }
+        }
+    }
+
+    if (static_cast<int>(order.size()) != numNodes) {
+        throw std::invalid_argument("ProcessingGraph connection would create a cycle");
+    }
+    return order;
+}
+
+std::unique_ptr<ProcessingGraph::Schedule> ProcessingGraph::compile() const {
+    const auto order = sortNodes();
+
+    // Only nodes that reach OUTPUT are scheduled: walk back from it
+    std::array<bool, MAX_NODES> feedsOutput{};
+    for (auto it = order.rbegin(); it != order.rend(); ++it) {
+        for (const auto& connection : connections_) {
+            if (connection->source == *it
+                && (connection->destination == OUTPUT || feedsOutput[static_cast<size_t>(connection->destination)])) {
+                feedsOutput[static_cast<size_t>(*it)] = true;
+            }
+        }
+    }
+
+    std::array<int, MAX_NODES> taskOf{};
+    taskOf.fill(-1);
+    int numTasks = 0;
+    for (int node : order) {
+        if (feedsOutput[static_cast<size_t>(node)]) {
+            taskOf[static_cast<size_t>(node)] = numTasks++;
+        }
+    }
+
+    auto schedule = std::make_unique<Schedule>();
+    schedule->tasks = std::vector<Task>(static_cast<size_t>(numTasks));
+    schedule->buffers.resize(static_cast<size_t>(numTasks));
+    for (int node : order) {
+        const int task = taskOf[static_cast<size_t>(node)];
+        if (task >= 0) {
+            schedule->tasks[static_cast<size_t>(task)].processor = nodes_[static_cast<size_t>(node)].get();
+            schedule->tasks[static_cast<size_t>(task)].buffer = schedule->buffers[static_cast<size_t>(task)].samples.data();
+        }
+    }
+
+    for (const auto& connection : connections_) {
+        const int sourceTask = connection->source == INPUT ? -1 : taskOf[static_cast<size_t>(connection->source)];
+        const int destinationTask = connection->destination == OUTPUT
+            ? -1
+            : taskOf[static_cast<size_t>(connection->destination)];
+        if ((connection->source != INPUT && sourceTask < 0)
+            || (connection->destination != OUTPUT && destinationTask < 0)) {
+            continue; // branch never reaches OUTPUT
+        }
+
+        const Input input{
+            connection.get(),
+            sourceTask >= 0 ? schedule->tasks[static_cast<size_t>(sourceTask)].buffer : nullptr
+        };
+
+        if (connection->destination == OUTPUT) {
+            schedule->outputs.push_back(input);
+            continue;
+        }
+
+        auto& destination = schedule->tasks[static_cast<size_t>(destinationTask)];
+        destination.inputs.push_back(input);
+        if (sourceTask >= 0) {
+            schedule->tasks[static_cast<size_t>(sourceTask)].dependents.push_back(destinationTask);
+            ++destination.numDependencies;
+        }
+    }
+
+    for (int task = 0; task < numTasks; ++task) {
+        if (schedule->tasks[static_cast<size_t>(task)].numDependencies == 0) {
+            schedule->roots.push_back(task);
+        }
+    }
+    return schedule;
+}
+
+bool ProcessingGraph::publish(std::unique_ptr<Schedule> schedule) {
+    schedule_.store(schedule.get(), std::memory_order_seq_cst);
+
+    // After this the audio thread can no longer be inside the old schedule
+    processEpoch_.synchronize();
+    published_ = std::move(schedule);
+
+    return updateLatency();
+}
+
+void ProcessingGraph::stageLatencyChanged() {
+    std::unique_lock<std::mutex> lock(controlMutex_);
+    const bool latencyChanged = updateLatency();
+
+    // Outer containers lock in the other order when they prepare this one
+    lock.unlock();
+    if (latencyChanged) {
+        notifyLatencyChanged();
+    }
+}
+
+bool ProcessingGraph::updateLatency() {
+    // Longest path: nodes in topological order, each adds its own latency
+    // to the slowest of its inputs
+    std::array<int, MAX_NODES> latency{};
+    for (int node : sortNodes()) {
+        int slowestInput = 0;
+        for (const auto& connection : connections_) {
+            if (connection->destination == node && connection->source != INPUT) {
+                slowestInput = std::max(slowestInput, latency[static_cast<size_t>(connection->source)]);
+            }
+        }
+        latency[static_cast<size_t>(node)] = slowestInput + nodes_[static_cast<size_t>(node)]->getLatencySamples();
+    }
+
+    int result = 0;
+    for (const auto& connection : connections_) {
+        if (connection->destination == OUTPUT && connection->source != INPUT) {
+            result = std::max(result, latency[static_cast<size_t>(connection->source)]);
+        }
+    }
+    return latencySamples_.exchange(result, std::memory_order_relaxed) != result;
+}
+
+} // namespace finirig::audio
@@ -0,0 +1,33 @@
+#include "finirig/audio/ProcessorStats.h"
+
+namespace finirig::audio {
+
+void ProcessorStats::record(std::int64_t elapsedNanoseconds, int numSamples) noexcept {
+    if (resetRequested_.exchange(false, std::memory_order_relaxed)) {
+        totalNanoseconds_.store(0, std::memory_order_relaxed);
+        numSamples_.store(0, std::memory_order_relaxed);
+        numBlocks_.store(0, std::memory_order_relaxed);
+        peakBlockNanoseconds_.store(0, std::memory_order_relaxed);
+    }
+
+    const auto elapsed = static_cast<std::uint64_t>(elapsedNanoseconds > 0 ? elapsedNanoseconds : 0);
+
+    // Single writer: load/store pairs instead of read-modify-write
+    totalNanoseconds_.store(totalNanoseconds_.load(std::memory_order_relaxed) + elapsed, std::memory_order_relaxed);
+    numSamples_.store(numSamples_.load(std::memory_order_relaxed) + static_cast<std::uint64_t>(numSamples), std::memory_order_relaxed);
+    if (elapsed > peakBlockNanoseconds_.load(std::memory_order_relaxed)) {
+        peakBlockNanoseconds_.store(elapsed, std::memory_order_relaxed);
+    }
+    numBlocks_.store(numBlocks_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+ProcessorStats::Snapshot ProcessorStats::getSnapshot() const noexcept {
+    Snapshot snapshot;
+    snapshot.numBlocks = numBlocks_.load(std::memory_order_acquire);
+    snapshot.totalNanoseconds = totalNanoseconds_.load(std::memory_order_relaxed);
+    snapshot.numSamples = numSamples_.load(std::memory_order_relaxed);
+    snapshot.peakBlockNanoseconds = peakBlockNanoseconds_.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+} // namespace finirig::audio
@@ -0,0 +1,24 @@
+#include "finirig/audio/RealtimeEpoch.h"
+#include <chrono>
+#include <thread>
+
+namespace finirig::audio {
+
+void RealtimeEpoch::synchronize() const {
+    const auto target = snapshot();
+
+    // A read section lasts at most one audio callback, so spin briefly
+    // before falling back to sleeping
+    for (int spin = 0; spin < 1000; ++spin) {
+        if (hasPassed(target)) {
+            return;
+        }
+        std::this_thread::yield();
+    }
+
+    while (!hasPassed(target)) {
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+}
+
+} // namespace finirig::audio
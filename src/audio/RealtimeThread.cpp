@@ -0,0 +1,23 @@
+#include "finirig/audio/RealtimeThread.h"
+#include <algorithm>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace finirig::audio {
+
+bool requestRealtimePriority(std::thread& thread) noexcept {
+#if defined(__linux__) || defined(__APPLE__)
+    // Just below the device callback, which usually runs near the top
+    sched_param parameters{};
+    parameters.sched_priority = std::max(sched_get_priority_min(SCHED_FIFO), sched_get_priority_max(SCHED_FIFO) - 10);
+    return pthread_setschedparam(thread.native_handle(), SCHED_FIFO, &parameters) == 0;
+#else
+    (void)thread;
+    return false;
+#endif
+}
+
+} // namespace finirig::audio
@@ -0,0 +1,83 @@
+#include "finirig/audio/ReleasePool.h"
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+
+namespace finirig::audio {
+
+namespace {
+// How often the garbage thread re-checks objects still visible to the reader
+constexpr auto COLLECT_INTERVAL = std::chrono::milliseconds(20);
+}
+
+ReleasePool::ReleasePool(const RealtimeEpoch& epoch)
+    : epoch_(epoch)
+    , thread_([this] { run(); })
+{
+}
+
+ReleasePool::~ReleasePool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shouldExit_ = true;
+    }
+    condition_.notify_one();
+    thread_.join();
+
+    // The owner has stopped the reader by now; release whatever is left
+    retired_.clear();
+}
+
+void ReleasePool::retireErased(std::shared_ptr<void> object) {
+    const auto epoch = epoch_.snapshot();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        retired_.push_back({std::move(object), epoch});
+    }
+    condition_.notify_one();
+}
+
+std::size_t ReleasePool::collect() {
+    // Move the expired objects out so destructors run without the lock held
+    std::vector<Retired> expired;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto firstExpired = std::stable_partition(
+            retired_.begin(),
+            retired_.end(),
+            [this](const Retired& entry) { return !epoch_.hasPassed(entry.epoch); }
+        );
+        expired.assign(
+            std::make_move_iterator(firstExpired),
+            std::make_move_iterator(retired_.end())
+        );
+        retired_.erase(firstExpired, retired_.end());
+    }
+    return expired.size();
+}
+
+std::size_t ReleasePool::getPendingCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return retired_.size();
+}
+
+void ReleasePool::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!shouldExit_) {
+        if (retired_.empty()) {
+            condition_.wait(lock, [this] { return shouldExit_ || !retired_.empty(); });
+        } else {
+            condition_.wait_for(lock, COLLECT_INTERVAL);
+        }
+
+        if (shouldExit_) {
+            break;
+        }
+
+        lock.unlock();
+        collect();
+        lock.lock();
+    }
+}
+
+} // namespace finirig::audio
@@ -0,0 +1,364 @@
+#include "finirig/audio/SignalChain.h"
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+namespace finirig::audio {
+
+SignalChain::SignalChain()
+    : activeList_(&stageLists_[0])
+    , scratch_(std::make_unique<ScratchBuffer>())
+{
+    stages_.reserve(MAX_STAGES);
+}
+
+SignalChain::~SignalChain() = default;
+
+int SignalChain::addStage(std::unique_ptr<AudioProcessor> stage) {
+    std::lock_guard<std::mutex> publishLock(publishMutex_);
+    std::unique_lock<std::mutex> lock(controlMutex_);
+    const auto index = static_cast<int>(stages_.size());
+    if (index >= MAX_STAGES) {
+        throw std::length_error("SignalChain is full");
+    }
+
+    auto entry = std::make_unique<Stage>();
+    entry->processor = std::move(stage);
+    if (entry->processor) {
+        if (sampleRate_ > 0.0) {
+            entry->processor->prepare(sampleRate_);
+        }
+        setLatencyParent(*entry->processor, this);
+    }
+    stages_.push_back(std::move(entry));
+    publishStages(lock);
+    return index;
+}
+
+void SignalChain::insertStage(int index, std::unique_ptr<AudioProcessor> stage) {
+    std::lock_guard<std::mutex> publishLock(publishMutex_);
+    std::unique_lock<std::mutex> lock(controlMutex_);
+    checkIndex(index, static_cast<int>(stages_.size()) + 1);
+    if (static_cast<int>(stages_.size()) >= MAX_STAGES) {
+        throw std::length_error("SignalChain is full");
+    }
+
+    auto entry = std::make_unique<Stage>();
+    entry->processor = std::move(stage);
+    if (entry->processor) {
+        if (sampleRate_ > 0.0) {
+            entry->processor->prepare(sampleRate_);
+        }
+        setLatencyParent(*entry->processor, this);
+    }
+    stages_.insert(stages_.begin() + index, std::move(entry));
+    publishStages(lock);
+}
+
+std::unique_ptr<AudioProcessor> SignalChain::removeStage(int index) {
+    std::lock_guard<std::mutex> publishLock(publishMutex_);
+    std::unique_lock<std::mutex> lock(controlMutex_);
+    checkIndex(index, static_cast<int>(stages_.size()));
+
+    auto entry = std::move(stages_[static_cast<size_t>(index)]);
+    stages_.erase(stages_.begin() + index);
+
+    // publishStages() waits for the audio thread, so the stage is unreferenced here
+    publishStages(lock);
+    if (entry->processor) {
+        setLatencyParent(*entry->processor, nullptr);
+    }
+    return std::move(entry->processor);
+}
+
+void SignalChain::moveStage(int fromIndex, int toIndex) {
+    std::lock_guard<std::mutex> publishLock(publishMutex_);
+    std::unique_lock<std::mutex> lock(controlMutex_);
+    const auto size = static_cast<int>(stages_.size());
+    checkIndex(fromIndex, size);
+    checkIndex(toIndex, size);
+    if (fromIndex == toIndex) {
+        return;
+    }
+
+    auto first = stages_.begin();
+    if (fromIndex < toIndex) {
+        std::rotate(first + fromIndex, first + fromIndex + 1, first + toIndex + 1);
+    } else {
+        std::rotate(first + toIndex, first + fromIndex, first + fromIndex + 1);
+    }
+    publishStages(lock);
+}
+
+void SignalChain::setStageBypassed(int index, bool bypassed) {
+    std::unique_lock<std::mutex> lock(controlMutex_);
+    checkIndex(index, static_cast<int>(stages_.size()));
+    stages_[static_cast<size_t>(index)]->bypassed.store(bypassed, std::memory_order_relaxed);
+    const bool latencyChanged = updateLatency();
+
+    lock.unlock();
+    if (latencyChanged) {
+        notifyLatencyChanged();
+    }
+}
+
+bool SignalChain::isStageBypassed(int index) const {
+    std::lock_guard<std::mutex> lock(controlMutex_);
+    checkIndex(index, static_cast<int>(stages_.size()));
+    return stages_[static_cast<size_t>(index)]->bypassed.load(std::memory_order_relaxed);
+}
+
+int SignalChain::getNumStages() const {
+    std::lock_guard<std::mutex> lock(controlMutex_);
+    return static_cast<int>(stages_.size());
+}
+
+AudioProcessor* SignalChain::getStage(int index) const {
+    std::lock_guard<std::mutex> lock(controlMutex_);
+    checkIndex(index, static_cast<int>(stages_.size()));
+    return stages_[static_cast<size_t>(index)]->processor.get();
+}
+
+std::vector<SignalChain::StageStatistics> SignalChain::getStageStatistics() const {
+    std::lock_guard<std::mutex> lock(controlMutex_);
+    std::vector<StageStatistics> statistics;
+    statistics.reserve(stages_.size());
+    for (const auto& stage : stages_) {
+        StageStatistics entry;
+        if (stage->processor) {
+            entry.name = stage->processor->getName();
+            entry.stats = stage->processor->getStats().getSnapshot();
+        }
+        entry.bypassed = stage->bypassed.load(std::memory_order_relaxed);
+        statistics.push_back(std::move(entry));
+    }
+    return statistics;
+}
+
+void SignalChain::resetStageStatistics() {
+    std::lock_guard<std::mutex> lock(controlMutex_);
+    for (auto& stage : stages_) {
+        if (stage->processor) {
+            stage->processor->getStats().requestReset();
+        }
+    }
+}
+
+float SignalChain::processSample(float input) noexcept {
+    const RealtimeEpoch::ScopedReader reader(processEpoch_);
+    const auto& list = *activeList_.load(std::memory_order_seq_cst);
+
+    float sample = input;
+    for (int index = 0; index < list.numStages; ++index) {
+        const auto* stage = list.stages[static_cast<size_t>(index)];
+        if (stage->processor && !stage->bypassed.load(std::memory_order_relaxed)) {
+            sample = stage->processor->processSample(sample);
+        }
+    }
+    return sample;
+}
+
+void SignalChain::processBlock(
+    float* buffer,
+    int numChannels,
+    int numSamples
+) noexcept {
+    if (numChannels <= 0) {
+        return;
+    }
+
+    const RealtimeEpoch::ScopedReader reader(processEpoch_);
+    const auto& list = *activeList_.load(std::memory_order_seq_cst);
+
+    // Deinterleave the first channel into scratch, run the chain there,
+    // then write the result to every channel (mono to stereo/mono)
+    float* scratch = scratch_->samples.data();
+    float* const scratchChannels[] = {scratch};
+
+    for (int offset = 0; offset < numSamples; offset += SUB_BLOCK_SIZE) {
+        const int count = std::min(SUB_BLOCK_SIZE, numSamples - offset);
+        float* frames = buffer + static_cast<ptrdiff_t>(offset) * numChannels;
+
+        for (int sample = 0; sample < count; ++sample) {
+            scratch[sample] = frames[sample * numChannels];
+        }
+
+        runStages(list, scratchChannels, 1, count);
+
+        for (int sample = 0; sample < count; ++sample) {
+            for (int channel = 0; channel < numChannels; ++channel) {
+                frames[sample * numChannels + channel] = scratch[sample];
+            }
+        }
+    }
+}
+
+void SignalChain::processChannels(
+    float* const* channelData,
+    int numChannels,
+    int numSamples
+) noexcept {
+    if (numChannels <= 0) {
+        return;
+    }
+
+    const RealtimeEpoch::ScopedReader reader(processEpoch_);
+    const auto& list = *activeList_.load(std::memory_order_seq_cst);
+
+    if (numSamples <= SUB_BLOCK_SIZE) {
+        runStages(list, channelData, numChannels, numSamples);
+        return;
+    }
+
+    // Larger blocks: walk the chain one sub-block at a time so every stage
+    // finds its input still in cache. Stages never see more than a stereo
+    // pair, so only that is walked; the rest is fanned out afterwards.
+    constexpr int pairChannels = 2;
+    const int channels = std::min(numChannels, pairChannels);
+    std::array<float*, pairChannels> offsetData{};
+
+    for (int offset = 0; offset < numSamples; offset += SUB_BLOCK_SIZE) {
+        const int count = std::min(SUB_BLOCK_SIZE, numSamples - offset);
+        for (int channel = 0; channel < channels; ++channel) {
+            offsetData[static_cast<size_t>(channel)] = channelData[channel] + offset;
+        }
+        runStages(list, offsetData.data(), channels, count);
+    }
+
+    // The pair holds the output (a mono result is already on both sides),
+    // so further channels repeat it as runStages() does for short blocks
+    for (int channel = pairChannels; channel < numChannels; ++channel) {
+        juce::FloatVectorOperations::copy(channelData[channel], channelData[channel % pairChannels], numSamples);
+    }
+}
+
+void SignalChain::prepare(double sampleRate) {
+    std::lock_guard<std::mutex> lock(controlMutex_);
+    sampleRate_ = sampleRate;
+    for (auto& stage : stages_) {
+        if (stage->processor) {
+            stage->processor->prepare(sampleRate);
+        }
+    }
+
+    // Stage latencies can depend on the sample rate
+    updateLatency();
+}
+
+void SignalChain::stageLatencyChanged() {
+    std::unique_lock<std::mutex> lock(controlMutex_);
+    const bool latencyChanged = updateLatency();
+
+    // Outer containers lock in the other order when they prepare this one
+    lock.unlock();
+    if (latencyChanged) {
+        notifyLatencyChanged();
+    }
+}
+
+bool SignalChain::updateLatency() noexcept {
+    // Stages run in series, so their delays add; bypassed stages are skipped
+    int latency = 0;
+    for (const auto& stage : stages_) {
+        if (stage->processor && !stage->bypassed.load(std::memory_order_relaxed)) {
+            latency += stage->processor->getLatencySamples();
+        }
+    }
+    return latencySamples_.exchange(latency, std::memory_order_relaxed) != latency;
+}
+
+void SignalChain::reset() {
+    std::lock_guard<std::mutex> lock(controlMutex_);
+    for (auto& stage : stages_) {
+        if (stage->processor) {
+            stage->processor->reset();
+        }
+    }
+}
+
+void SignalChain::publishStages(std::unique_lock<std::mutex>& lock) {
+    // Fill whichever list the audio thread is not reading
+    const auto* active = activeList_.load(std::memory_order_relaxed);
+    auto& next = (active == &stageLists_[0]) ? stageLists_[1] : stageLists_[0];
+
+    bool anyStereo = false;
+    next.numStages = static_cast<int>(stages_.size());
+    for (size_t index = 0; index < stages_.size(); ++index) {
+        const auto* processor = stages_[index]->processor.get();
+        next.stages[index] = stages_[index].get();
+        next.stereo[index] = processor && processor->getChannelLayout() == ChannelLayout::Stereo;
+        anyStereo = anyStereo || next.stereo[index];
+    }
+
+    activeList_.store(&next, std::memory_order_seq_cst);
+    stereo_.store(anyStereo, std::memory_order_relaxed);
+    const bool latencyChanged = updateLatency();
+
+    // Waiting out the audio thread can take a whole block; getters only
+    // need controlMutex_, so they are not held up. publishMutex_ stays
+    // held, so no other edit fills the old list before it is free.
+    lock.unlock();
+
+    // After this the old list (and any stage only it referenced) is unused
+    processEpoch_.synchronize();
+
+    if (latencyChanged) {
+        notifyLatencyChanged();
+    }
+}
+
+void SignalChain::checkIndex(int index, int size) const {
+    if (index < 0 || index >= size) {
+        throw std::out_of_range("SignalChain stage index out of range");
+    }
+}
+
+void SignalChain::runStages(
+    const StageList& list,
+    float* const* channelData,
+    int numChannels,
+    int numSamples
+) noexcept {
+    using Clock = std::chrono::steady_clock;
+    const bool profiling = profilingEnabled_.load(std::memory_order_relaxed);
+
+    // Live channels so far: the input is mono, and stays so until a
+    // stereo stage needs both sides
+    const int maxWidth = std::min(numChannels, 2);
+    int width = 1;
+
+    for (int index = 0; index < list.numStages; ++index) {
+        const auto* stage = list.stages[static_cast<size_t>(index)];
+        if (!stage->processor || stage->bypassed.load(std::memory_order_relaxed)) {
+            continue;
+        }
+
+        if (list.stereo[static_cast<size_t>(index)]) {
+            if (width < maxWidth) {
+                juce::FloatVectorOperations::copy(channelData[1], channelData[0], numSamples);
+                width = maxWidth;
+            }
+        } else if (width > 1) {
+            juce::FloatVectorOperations::add(channelData[0], channelData[1], numSamples);
+            juce::FloatVectorOperations::multiply(channelData[0], 0.5f, numSamples);
+            width = 1;
+        }
+
+        if (!profiling) {
+            stage->processor->processChannels(channelData, width, numSamples);
+            continue;
+        }
+
+        const auto start = Clock::now();
+        stage->processor->processChannels(channelData, width, numSamples);
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+        stage->processor->getStats().record(elapsed.count(), numSamples);
+    }
+
+    // Fan out once: mono to every channel, stereo pairs to the rest
+    for (int channel = width; channel < numChannels; ++channel) {
+        juce::FloatVectorOperations::copy(channelData[channel], channelData[channel % width], numSamples);
+    }
+}
+
+} // namespace finirig::audio
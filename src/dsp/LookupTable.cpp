@@ -0,0 +1,38 @@
+#include "finirig/dsp/LookupTable.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace finirig::dsp {
+
+LookupTable::LookupTable(
+    const std::function<float(float)>& function,
+    float minInput,
+    float maxInput,
+    int size
+)
+    : minInput_(minInput)
+    , maxInput_(maxInput)
+    , scale_(0.0f)
+    , lastIndex_(size - 1)
+{
+    if (size < 2 || !(maxInput > minInput)) {
+        throw std::invalid_argument("LookupTable needs at least two points over a non-empty range");
+    }
+
+    scale_ = static_cast<float>(lastIndex_) / (maxInput - minInput);
+
+    // Points computed in double so the grid itself adds no error
+    table_.resize(static_cast<size_t>(size));
+    const double step = (static_cast<double>(maxInput) - minInput) / lastIndex_;
+    for (int i = 0; i < size; ++i) {
+        table_[static_cast<size_t>(i)] = function(static_cast<float>(minInput + step * i));
+    }
+}
+
+void LookupTable::process(float* data, int numSamples) const noexcept {
+    for (int sample = 0; sample < numSamples; ++sample) {
+        data[sample] = (*this)(data[sample]);
+    }
+}
+
+} // namespace finirig::dsp
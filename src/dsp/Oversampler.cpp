@@ -0,0 +1,218 @@
+#include "finirig/dsp/Oversampler.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace finirig::dsp {
+
+namespace {
+
+// Half-band taps (non-zero branch) of the first octave per quality; later
+// octaves halve this because their transition band is relatively wider
+int firstStageHalfLength(Oversampler::Quality quality) noexcept {
+    switch (quality) {
+        case Oversampler::Quality::Low: return 4;
+        case Oversampler::Quality::Normal: return 8;
+        case Oversampler::Quality::High: return 16;
+    }
+    return 8;
+}
+
+double kaiserBeta(Oversampler::Quality quality) noexcept {
+    switch (quality) {
+        case Oversampler::Quality::Low: return 5.0;
+        case Oversampler::Quality::Normal: return 7.0;
+        case Oversampler::Quality::High: return 9.0;
+    }
+    return 7.0;
+}
+
+// Zeroth-order modified Bessel function (series form)
+double besselI0(double x) noexcept {
+    double sum = 1.0;
+    double term = 1.0;
+    const double halfX = 0.5 * x;
+    for (int k = 1; k < 32; ++k) {
+        term *= (halfX / k) * (halfX / k);
+        sum += term;
+        if (term < sum * 1.0e-12) {
+            break;
+        }
+    }
+    return sum;
+}
+
+// Non-zero taps h[0], h[2], ... h[4K-2] of a (4K-1)-tap half-band low-pass,
+// returned reversed and normalised so they sum to 0.5 (the centre tap
+// supplies the other half of the unity DC gain)
+std::vector<float> designHalfBand(int halfLength, double beta) {
+    const int length = 4 * halfLength - 1;
+    const double centre = 0.5 * (length - 1);
+    const double pi = 3.14159265358979323846;
+    const double windowNorm = besselI0(beta);
+
+    std::vector<double> taps(static_cast<size_t>(2 * halfLength));
+    double sum = 0.0;
+    for (int i = 0; i < 2 * halfLength; ++i) {
+        const double offset = 2.0 * i - centre;
+        const double x = pi * 0.5 * offset;
+        const double sinc = std::sin(x) / x;
+        const double ratio = offset / centre;
+        const double window = besselI0(beta * std::sqrt(std::max(0.0, 1.0 - ratio * ratio))) / windowNorm;
+        taps[static_cast<size_t>(i)] = 0.5 * sinc * window;
+        sum += taps[static_cast<size_t>(i)];
+    }
+
+    std::vector<float> reversed(taps.size());
+    for (size_t i = 0; i < taps.size(); ++i) {
+        reversed[taps.size() - 1 - i] = static_cast<float>(taps[i] * 0.5 / sum);
+    }
+    return reversed;
+}
+
+int factorToNumStages(int factor) {
+    switch (factor) {
+        case 1: return 0;
+        case 2: return 1;
+        case 4: return 2;
+        case 8: return 3;
+        default:
+            throw std::invalid_argument("Oversampling factor must be 1, 2, 4 or 8");
+    }
+}
+
+} // namespace
+
+Oversampler::Oversampler(int factor, Quality quality)
+    : factor_(factor)
+    , quality_(quality)
+    , stages_(static_cast<size_t>(factorToNumStages(factor)))
+{
+    int halfLength = firstStageHalfLength(quality);
+    for (auto& stage : stages_) {
+        stage.coefficients = designHalfBand(halfLength, kaiserBeta(quality));
+        stage.numTaps = static_cast<int>(stage.coefficients.size());
+        halfLength = std::max(2, halfLength / 2);
+    }
+}
+
+void Oversampler::prepare(int maxBlockSize) {
+    maxBlockSize_ = std::max(1, maxBlockSize);
+
+    int stageInput = maxBlockSize_;
+    for (auto& stage : stages_) {
+        const auto history = static_cast<size_t>(stage.numTaps - 1);
+        const auto input = static_cast<size_t>(stageInput);
+        stage.upBuffer.assign(history + input, 0.0f);
+        stage.downEven.assign(history + input, 0.0f);
+        stage.downOdd.assign(static_cast<size_t>(stage.numTaps / 2) + input, 0.0f);
+        stage.output.assign(2 * input, 0.0f);
+        stageInput *= 2;
+    }
+
+    // Factor 1 still hands out a buffer so callers need no special case
+    passthrough_.assign(stages_.empty() ? static_cast<size_t>(maxBlockSize_) : 0, 0.0f);
+}
+
+void Oversampler::reset() noexcept {
+    for (auto& stage : stages_) {
+        std::fill(stage.upBuffer.begin(), stage.upBuffer.end(), 0.0f);
+        std::fill(stage.downEven.begin(), stage.downEven.end(), 0.0f);
+        std::fill(stage.downOdd.begin(), stage.downOdd.end(), 0.0f);
+        std::fill(stage.output.begin(), stage.output.end(), 0.0f);
+    }
+}
+
+float* Oversampler::upsample(const float* input, int numSamples) noexcept {
+    numSamples = std::min(numSamples, maxBlockSize_);
+
+    if (stages_.empty()) {
+        std::copy(input, input + numSamples, passthrough_.data());
+        return passthrough_.data();
+    }
+
+    const float* stageInput = input;
+    for (auto& stage : stages_) {
+        upsampleStage(stage, stageInput, numSamples);
+        stageInput = stage.output.data();
+        numSamples *= 2;
+    }
+    return stages_.back().output.data();
+}
+
+void Oversampler::downsample(float* output, int numSamples) noexcept {
+    numSamples = std::min(numSamples, maxBlockSize_);
+
+    if (stages_.empty()) {
+        std::copy(passthrough_.data(), passthrough_.data() + numSamples, output);
+        return;
+    }
+
+    // Walk the cascade back down; each octave writes into the buffer of
+    // the octave below, which is no longer needed after upsample()
+    for (size_t index = stages_.size(); index-- > 0;) {
+        const int stageSamples = numSamples << index;
+        float* destination = index > 0 ? stages_[index - 1].output.data() : output;
+        downsampleStage(stages_[index], stages_[index].output.data(), destination, stageSamples);
+    }
+}
+
+double Oversampler::getLatencySamples() const noexcept {
+    // A (2*numTaps - 1)-tap half-band delays by numTaps - 1 samples at its
+    // high rate, once on the way up and once on the way down
+    double latency = 0.0;
+    double rate = 1.0;
+    for (const auto& stage : stages_) {
+        rate *= 2.0;
+        latency += 2.0 * (stage.numTaps - 1) / rate;
+    }
+    return latency;
+}
+
+void Oversampler::upsampleStage(HalfBandStage& stage, const float* input, int numSamples) noexcept {
+    const int history = stage.numTaps - 1;
+    const int delay = stage.numTaps / 2;
+    float* buffer = stage.upBuffer.data();
+    float* output = stage.output.data();
+    const float* coefficients = stage.coefficients.data();
+
+    std::copy(input, input + numSamples, buffer + history);
+
+    for (int i = 0; i < numSamples; ++i) {
+        // FIR branch, gain 2 to make up for the zero stuffing
+        output[2 * i] = 2.0f * dotProduct_(coefficients, buffer + i, stage.numTaps);
+        // Centre-tap branch is a pure delay
+        output[2 * i + 1] = buffer[delay + i];
+    }
+
+    std::copy(buffer + numSamples, buffer + numSamples + history, buffer);
+}
+
+void Oversampler::downsampleStage(
+    HalfBandStage& stage,
+    const float* input,
+    float* output,
+    int numSamples
+) noexcept {
+    const int history = stage.numTaps - 1;
+    const int delay = stage.numTaps / 2;
+    float* even = stage.downEven.data();
+    float* odd = stage.downOdd.data();
+    const float* coefficients = stage.coefficients.data();
+
+    // De-interleave the polyphase branches before writing anything, so
+    // output may alias input
+    for (int i = 0; i < numSamples; ++i) {
+        even[history + i] = input[2 * i];
+        odd[delay + i] = input[2 * i + 1];
+    }
+
+    for (int i = 0; i < numSamples; ++i) {
+        output[i] = dotProduct_(coefficients, even + i, stage.numTaps) + 0.5f * odd[i];
+    }
+
+    std::copy(even + numSamples, even + numSamples + history, even);
+    std::copy(odd + numSamples, odd + numSamples + delay, odd);
+}
+
+} // namespace finirig::dsp
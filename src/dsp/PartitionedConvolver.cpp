@@ -0,0 +1,196 @@
+#include "finirig/dsp/PartitionedConvolver.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace finirig::dsp {
+
+namespace {
+
+int fftOrderFor(int partitionSize) {
+    if (partitionSize < 8 || (partitionSize & (partitionSize - 1)) != 0) {
+        throw std::invalid_argument("Partition size must be a power of two of at least 8");
+    }
+
+    int order = 1; // FFT covers two partitions
+    while ((1 << order) < 2 * partitionSize) {
+        ++order;
+    }
+    return order;
+}
+
+} // namespace
+
+std::shared_ptr<const PartitionedConvolver::Kernel> PartitionedConvolver::createKernel(
+    const float* impulseResponse,
+    int length,
+    int partitionSize
+) {
+    juce::dsp::FFT fft(fftOrderFor(partitionSize));
+
+    auto kernel = std::make_shared<Kernel>();
+    kernel->partitionSize = partitionSize;
+    kernel->length = std::max(0, length);
+    const int headLength = std::min(kernel->length, partitionSize);
+
+    // Head taps reversed so each output is one forward dot product
+    kernel->head.assign(static_cast<size_t>(partitionSize), 0.0f);
+    for (int tap = 0; tap < headLength; ++tap) {
+        kernel->head[static_cast<size_t>(partitionSize - 1 - tap)] = impulseResponse[tap];
+    }
+
+    const int tailLength = kernel->length - headLength;
+    kernel->numPartitions = (tailLength + partitionSize - 1) / partitionSize;
+
+    const auto numBins = static_cast<size_t>(partitionSize + 1);
+    const auto spectrumSize = static_cast<size_t>(kernel->numPartitions) * numBins;
+    kernel->partitionsRe.assign(spectrumSize, 0.0f);
+    kernel->partitionsIm.assign(spectrumSize, 0.0f);
+
+    std::vector<float> buffer(static_cast<size_t>(4 * partitionSize));
+    for (int partition = 0; partition < kernel->numPartitions; ++partition) {
+        const int start = partitionSize * (partition + 1);
+        const int count = std::min(partitionSize, kernel->length - start);
+
+        // Zero-padded to the FFT length, as overlap-save requires
+        std::fill(buffer.begin(), buffer.end(), 0.0f);
+        std::copy(impulseResponse + start, impulseResponse + start + count, buffer.begin());
+        fft.performRealOnlyForwardTransform(buffer.data(), true);
+
+        const auto offset = static_cast<size_t>(partition) * numBins;
+        for (size_t bin = 0; bin < numBins; ++bin) {
+            kernel->partitionsRe[offset + bin] = buffer[2 * bin];
+            kernel->partitionsIm[offset + bin] = buffer[2 * bin + 1];
+        }
+    }
+
+    return kernel;
+}
+
+PartitionedConvolver::PartitionedConvolver(int partitionSize)
+    : partitionSize_(partitionSize)
+    , numBins_(partitionSize + 1)
+    , fft_(fftOrderFor(partitionSize))
+    , silentHead_(static_cast<size_t>(partitionSize), 0.0f)
+    , head_(silentHead_.data())
+    , inputBuffer_(static_cast<size_t>(2 * partitionSize), 0.0f)
+    , tailOutput_(static_cast<size_t>(partitionSize), 0.0f)
+    , fftBuffer_(static_cast<size_t>(4 * partitionSize), 0.0f)
+    , accumulatorRe_(static_cast<size_t>(partitionSize + 1), 0.0f)
+    , accumulatorIm_(static_cast<size_t>(partitionSize + 1), 0.0f)
+{
+}
+
+void PartitionedConvolver::setImpulseResponse(const float* impulseResponse, int length) {
+    setKernel(createKernel(impulseResponse, length, partitionSize_));
+}
+
+void PartitionedConvolver::setKernel(std::shared_ptr<const Kernel> kernel) {
+    if (kernel && kernel->partitionSize != partitionSize_) {
+        throw std::invalid_argument("Kernel partition size does not match the convolver");
+    }
+
+    kernel_ = std::move(kernel);
+    head_ = kernel_ ? kernel_->head.data() : silentHead_.data();
+    numPartitions_ = kernel_ ? kernel_->numPartitions : 0;
+
+    const auto spectrumSize = static_cast<size_t>(numPartitions_) * static_cast<size_t>(numBins_);
+    delayLineRe_.assign(spectrumSize, 0.0f);
+    delayLineIm_.assign(spectrumSize, 0.0f);
+
+    reset();
+}
+
+void PartitionedConvolver::reset() noexcept {
+    std::fill(inputBuffer_.begin(), inputBuffer_.end(), 0.0f);
+    std::fill(tailOutput_.begin(), tailOutput_.end(), 0.0f);
+    std::fill(delayLineRe_.begin(), delayLineRe_.end(), 0.0f);
+    std::fill(delayLineIm_.begin(), delayLineIm_.end(), 0.0f);
+    delayLineHead_ = 0;
+    position_ = 0;
+}
+
+void PartitionedConvolver::process(float* data, int numSamples) noexcept {
+    float* current = inputBuffer_.data() + partitionSize_;
+    const float* head = head_;
+
+    for (int offset = 0; offset < numSamples;) {
+        const int count = std::min(numSamples - offset, partitionSize_ - position_);
+
+        std::copy(data + offset, data + offset + count, current + position_);
+
+        for (int i = 0; i < count; ++i) {
+            const int index = position_ + i;
+            // Window ends at the sample just written
+            const float direct = dotProduct_(head, inputBuffer_.data() + index + 1, partitionSize_);
+            data[offset + i] = direct + tailOutput_[static_cast<size_t>(index)];
+        }
+
+        position_ += count;
+        offset += count;
+
+        if (position_ == partitionSize_) {
+            finishBlock();
+        }
+    }
+}
+
+void PartitionedConvolver::finishBlock() noexcept {
+    position_ = 0;
+
+    if (numPartitions_ > 0) {
+        const auto numBins = static_cast<size_t>(numBins_);
+
+        // Transform previous + current block into the newest delay line slot
+        std::copy(inputBuffer_.begin(), inputBuffer_.end(), fftBuffer_.begin());
+        std::fill(fftBuffer_.begin() + 2 * partitionSize_, fftBuffer_.end(), 0.0f);
+        fft_.performRealOnlyForwardTransform(fftBuffer_.data(), true);
+
+        delayLineHead_ = (delayLineHead_ + 1) % numPartitions_;
+        float* newestRe = delayLineRe_.data() + static_cast<size_t>(delayLineHead_) * numBins;
+        float* newestIm = delayLineIm_.data() + static_cast<size_t>(delayLineHead_) * numBins;
+        for (size_t bin = 0; bin < numBins; ++bin) {
+            newestRe[bin] = fftBuffer_[2 * bin];
+            newestIm[bin] = fftBuffer_[2 * bin + 1];
+        }
+
+        // Tail partition j (from 0) pairs with the input block j back
+        std::fill(accumulatorRe_.begin(), accumulatorRe_.end(), 0.0f);
+        std::fill(accumulatorIm_.begin(), accumulatorIm_.end(), 0.0f);
+        float* accRe = accumulatorRe_.data();
+        float* accIm = accumulatorIm_.data();
+
+        int slot = delayLineHead_;
+        for (int partition = 0; partition < numPartitions_; ++partition) {
+            const float* xRe = delayLineRe_.data() + static_cast<size_t>(slot) * numBins;
+            const float* xIm = delayLineIm_.data() + static_cast<size_t>(slot) * numBins;
+            const float* hRe = kernel_->partitionsRe.data() + static_cast<size_t>(partition) * numBins;
+            const float* hIm = kernel_->partitionsIm.data() + static_cast<size_t>(partition) * numBins;
+
+            // Split layout keeps this loop free of shuffles, so it vectorises
+            for (size_t bin = 0; bin < numBins; ++bin) {
+                accRe[bin] += xRe[bin] * hRe[bin] - xIm[bin] * hIm[bin];
+                accIm[bin] += xRe[bin] * hIm[bin] + xIm[bin] * hRe[bin];
+            }
+
+            slot = slot > 0 ? slot - 1 : numPartitions_ - 1;
+        }
+
+        for (size_t bin = 0; bin < numBins; ++bin) {
+            fftBuffer_[2 * bin] = accRe[bin];
+            fftBuffer_[2 * bin + 1] = accIm[bin];
+        }
+        fft_.performRealOnlyInverseTransform(fftBuffer_.data());
+
+        // Overlap-save: only the second half is free of wrap-around
+        std::copy(
+            fftBuffer_.begin() + partitionSize_,
+            fftBuffer_.begin() + 2 * partitionSize_,
+            tailOutput_.begin()
+        );
+    }
+
+    // Current block becomes the history for the next one
+    std::copy(inputBuffer_.begin() + partitionSize_, inputBuffer_.end(), inputBuffer_.begin());
+}
+
+} // namespace finirig::dsp
@@ -0,0 +1,126 @@
+#include "finirig/dsp/PitchDetector.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace finirig::dsp {
+
+PitchDetector::PitchDetector(float minFrequency, float maxFrequency)
+    : minFrequency_(minFrequency)
+    , maxFrequency_(maxFrequency)
+    , dotProduct_(getDotProductKernel())
+{
+    if (!(minFrequency > 0.0f && minFrequency < maxFrequency)) {
+        throw std::invalid_argument("PitchDetector needs 0 < minFrequency < maxFrequency");
+    }
+}
+
+void PitchDetector::prepare(double sampleRate) {
+    sampleRate_ = sampleRate;
+    minLag_ = std::max(2, static_cast<int>(sampleRate / maxFrequency_));
+    maxLag_ = static_cast<int>(std::ceil(sampleRate / minFrequency_));
+
+    // One period of the lowest note per window keeps latency down; YIN's
+    // normalisation copes with the short integration
+    windowSize_ = maxLag_;
+
+    buffer_.assign(static_cast<size_t>(windowSize_ + maxLag_ + 1), 0.0f);
+    bufferFill_ = 0;
+    difference_.assign(static_cast<size_t>(maxLag_ + 2), 1.0f);
+    result_ = Result{};
+}
+
+int PitchDetector::process(const float* samples, int numSamples) {
+    const int bufferSize = static_cast<int>(buffer_.size());
+    int detections = 0;
+
+    while (numSamples > 0) {
+        const int count = std::min(numSamples, bufferSize - bufferFill_);
+        std::copy(samples, samples + count, buffer_.begin() + bufferFill_);
+        bufferFill_ += count;
+        samples += count;
+        numSamples -= count;
+
+        if (bufferFill_ == bufferSize) {
+            detect();
+            ++detections;
+
+            // Slide by one window; the rest is the start of the next one
+            std::copy(buffer_.begin() + windowSize_, buffer_.end(), buffer_.begin());
+            bufferFill_ = bufferSize - windowSize_;
+        }
+    }
+    return detections;
+}
+
+void PitchDetector::detect() {
+    const float* x = buffer_.data();
+    const int lastLag = maxLag_ + 1;
+
+    // d(tau) = sum (x[j] - x[j + tau])^2 over the window, expanded as
+    // energy(0) + energy(tau) - 2 * dot(x, x + tau); energies slide along
+    const double energy = dotProduct_(x, x, windowSize_);
+    if (std::sqrt(energy / windowSize_) < SILENCE_RMS) {
+        result_ = Result{};
+        return;
+    }
+
+    double shiftedEnergy = energy;
+    double runningSum = 0.0;
+    difference_[0] = 1.0f;
+    for (int lag = 1; lag <= lastLag; ++lag) {
+        const double outgoing = x[lag - 1];
+        const double incoming = x[lag + windowSize_ - 1];
+        shiftedEnergy += incoming * incoming - outgoing * outgoing;
+
+        const double d = std::max(0.0, energy + shiftedEnergy - 2.0 * dotProduct_(x, x + lag, windowSize_));
+        runningSum += d;
+
+        // Cumulative mean normalisation removes the dip at lag 0 and
+        // scales the threshold to the signal
+        difference_[static_cast<size_t>(lag)] = runningSum > 0.0 ? static_cast<float>(d * lag / runningSum) : 1.0f;
+    }
+
+    // First dip under the threshold, followed down to its minimum
+    int period = -1;
+    for (int lag = minLag_; lag <= maxLag_; ++lag) {
+        if (difference_[static_cast<size_t>(lag)] < YIN_THRESHOLD) {
+            while (lag + 1 <= maxLag_ && difference_[static_cast<size_t>(lag + 1)] < difference_[static_cast<size_t>(lag)]) {
+                ++lag;
+            }
+            period = lag;
+            break;
+        }
+    }
+    if (period < 0) {
+        result_ = Result{};
+        return;
+    }
+
+    // Parabola through the dip and its neighbours for sub-sample accuracy
+    const float before = difference_[static_cast<size_t>(period - 1)];
+    const float at = difference_[static_cast<size_t>(period)];
+    const float after = difference_[static_cast<size_t>(period + 1)];
+    const float curvature = before - 2.0f * at + after;
+    const float offset = curvature > 0.0f ? std::clamp(0.5f * (before - after) / curvature, -0.5f, 0.5f) : 0.0f;
+
+    result_.frequency = static_cast<float>(sampleRate_ / (period + offset));
+    result_.confidence = std::clamp(1.0f - at, 0.0f, 1.0f);
+    result_.voiced = true;
+}
+
+PitchDetector::Note PitchDetector::toNote(float frequency, float referenceA4) noexcept {
+    if (frequency <= 0.0f || referenceA4 <= 0.0f) {
+        return Note{};
+    }
+    const float semitones = 69.0f + 12.0f * std::log2(frequency / referenceA4);
+    const float nearest = std::round(semitones);
+    return Note{static_cast<int>(nearest), 100.0f * (semitones - nearest)};
+}
+
+const char* PitchDetector::getNoteName(int midiNote) noexcept {
+    static constexpr const char* NAMES[12] = {"C", "C#", "D", "D#", "E", "F", "F#", "G", "G#", "A", "A#", "B"};
+    return NAMES[((midiNote % 12) + 12) % 12];
+}
+
+} // namespace finirig::dsp
@@ -0,0 +1,54 @@
+#include "finirig/dsp/Resampling.h"
+#include <algorithm>
+#include <cmath>
+
+namespace finirig::dsp {
+
+std::vector<float> resample(
+    const float* input,
+    int numSamples,
+    double sourceRate,
+    double targetRate
+) {
+    if (numSamples <= 0 || sourceRate <= 0.0 || targetRate <= 0.0) {
+        return {};
+    }
+    if (sourceRate == targetRate) {
+        return std::vector<float>(input, input + numSamples);
+    }
+
+    constexpr double pi = 3.14159265358979323846;
+    const double ratio = targetRate / sourceRate;
+
+    // Cutoff relative to the source Nyquist; downsampling must also remove
+    // everything above the target Nyquist
+    const double cutoff = std::min(1.0, ratio);
+    const double halfWidth = RESAMPLING_ZERO_CROSSINGS / cutoff; // in input samples
+
+    const auto numOutput = static_cast<int>(std::ceil(numSamples * targetRate / sourceRate));
+    std::vector<float> output(static_cast<size_t>(numOutput));
+
+    for (int n = 0; n < numOutput; ++n) {
+        const double position = n / ratio;
+        const int first = std::max(0, static_cast<int>(std::ceil(position - halfWidth)));
+        const int last = std::min(numSamples - 1, static_cast<int>(std::floor(position + halfWidth)));
+
+        double sum = 0.0;
+        for (int k = first; k <= last; ++k) {
+            const double offset = position - k;
+            const double x = pi * cutoff * offset;
+            const double sinc = x == 0.0 ? 1.0 : std::sin(x) / x;
+
+            // Blackman window over [-halfWidth, halfWidth]
+            const double phase = pi * (offset / halfWidth + 1.0);
+            const double window = 0.42 - 0.5 * std::cos(phase) + 0.08 * std::cos(2.0 * phase);
+
+            sum += input[k] * cutoff * sinc * window;
+        }
+        output[static_cast<size_t>(n)] = static_cast<float>(sum);
+    }
+
+    return output;
+}
+
+} // namespace finirig::dsp
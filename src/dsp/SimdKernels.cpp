@@ -0,0 +1,275 @@
+#include "finirig/dsp/SimdKernels.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define FINIRIG_SIMD_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#elif defined(__ARM_NEON) || defined(__aarch64__) || defined(_M_ARM64)
+#define FINIRIG_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+// GCC/Clang need per-function target attributes to emit AVX outside of
+// -mavx builds; MSVC allows the intrinsics anywhere
+#if defined(FINIRIG_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+#define FINIRIG_TARGET_AVX __attribute__((target("avx")))
+#else
+#define FINIRIG_TARGET_AVX
+#endif
+
+namespace finirig::dsp {
+
+namespace {
+
+void driveClipScalar(float* data, int numSamples, float gain) noexcept {
+    for (int i = 0; i < numSamples; ++i) {
+        data[i] = softClip(data[i] * gain);
+    }
+}
+
+float dotProductScalar(const float* a, const float* b, int numSamples) noexcept {
+    float sum = 0.0f;
+    for (int i = 0; i < numSamples; ++i) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+#if defined(FINIRIG_SIMD_X86)
+
+void driveClipSse2(float* data, int numSamples, float gain) noexcept {
+    const __m128 g = _mm_set1_ps(gain);
+    const __m128 lo = _mm_set1_ps(-3.0f);
+    const __m128 hi = _mm_set1_ps(3.0f);
+    const __m128 c27 = _mm_set1_ps(27.0f);
+    const __m128 c9 = _mm_set1_ps(9.0f);
+
+    int i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        __m128 x = _mm_mul_ps(_mm_loadu_ps(data + i), g);
+        x = _mm_min_ps(_mm_max_ps(x, lo), hi);
+        const __m128 x2 = _mm_mul_ps(x, x);
+        const __m128 num = _mm_mul_ps(x, _mm_add_ps(c27, x2));
+        const __m128 den = _mm_add_ps(c27, _mm_mul_ps(c9, x2));
+        _mm_storeu_ps(data + i, _mm_div_ps(num, den));
+    }
+    driveClipScalar(data + i, numSamples - i, gain);
+}
+
+float dotProductSse2(const float* a, const float* b, int numSamples) noexcept {
+    // Two accumulators hide the add latency
+    __m128 sum0 = _mm_setzero_ps();
+    __m128 sum1 = _mm_setzero_ps();
+
+    int i = 0;
+    for (; i + 8 <= numSamples; i += 8) {
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+        sum1 = _mm_add_ps(sum1, _mm_mul_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4)));
+    }
+    for (; i + 4 <= numSamples; i += 4) {
+        sum0 = _mm_add_ps(sum0, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    }
+
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, _mm_add_ps(sum0, sum1));
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + dotProductScalar(a + i, b + i, numSamples - i);
+}
+
+FINIRIG_TARGET_AVX
+float dotProductAvx(const float* a, const float* b, int numSamples) noexcept {
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+
+    int i = 0;
+    for (; i + 16 <= numSamples; i += 16) {
+        sum0 = _mm256_add_ps(sum0, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+        sum1 = _mm256_add_ps(sum1, _mm256_mul_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8)));
+    }
+    for (; i + 8 <= numSamples; i += 8) {
+        sum0 = _mm256_add_ps(sum0, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+
+    alignas(32) float lanes[8];
+    _mm256_store_ps(lanes, _mm256_add_ps(sum0, sum1));
+    _mm256_zeroupper();
+
+    float sum = 0.0f;
+    for (float lane : lanes) {
+        sum += lane;
+    }
+    return sum + dotProductScalar(a + i, b + i, numSamples - i);
+}
+
+FINIRIG_TARGET_AVX
+void driveClipAvx(float* data, int numSamples, float gain) noexcept {
+    const __m256 g = _mm256_set1_ps(gain);
+    const __m256 lo = _mm256_set1_ps(-3.0f);
+    const __m256 hi = _mm256_set1_ps(3.0f);
+    const __m256 c27 = _mm256_set1_ps(27.0f);
+    const __m256 c9 = _mm256_set1_ps(9.0f);
+
+    int i = 0;
+    for (; i + 8 <= numSamples; i += 8) {
+        __m256 x = _mm256_mul_ps(_mm256_loadu_ps(data + i), g);
+        x = _mm256_min_ps(_mm256_max_ps(x, lo), hi);
+        const __m256 x2 = _mm256_mul_ps(x, x);
+        const __m256 num = _mm256_mul_ps(x, _mm256_add_ps(c27, x2));
+        const __m256 den = _mm256_add_ps(c27, _mm256_mul_ps(c9, x2));
+        _mm256_storeu_ps(data + i, _mm256_div_ps(num, den));
+    }
+    // Leave the AVX state clean before running SSE/scalar code
+    _mm256_zeroupper();
+    driveClipScalar(data + i, numSamples - i, gain);
+}
+
+bool cpuSupportsAvx() noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_cpu_supports("avx");
+#elif defined(_MSC_VER)
+    int info[4] = {};
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    return osxsave && avx && (_xgetbv(0) & 0x6) == 0x6;
+#else
+    return false;
+#endif
+}
+
+#endif // FINIRIG_SIMD_X86
+
+#if defined(FINIRIG_SIMD_NEON)
+
+void driveClipNeon(float* data, int numSamples, float gain) noexcept {
+    const float32x4_t g = vdupq_n_f32(gain);
+    const float32x4_t lo = vdupq_n_f32(-3.0f);
+    const float32x4_t hi = vdupq_n_f32(3.0f);
+    const float32x4_t c27 = vdupq_n_f32(27.0f);
+    const float32x4_t c9 = vdupq_n_f32(9.0f);
+
+    int i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        float32x4_t x = vmulq_f32(vld1q_f32(data + i), g);
+        x = vminq_f32(vmaxq_f32(x, lo), hi);
+        const float32x4_t x2 = vmulq_f32(x, x);
+        const float32x4_t num = vmulq_f32(x, vaddq_f32(c27, x2));
+        const float32x4_t den = vaddq_f32(c27, vmulq_f32(c9, x2));
+#if defined(__aarch64__) || defined(_M_ARM64)
+        vst1q_f32(data + i, vdivq_f32(num, den));
+#else
+        // ARMv7 NEON has no divide; two Newton steps on the reciprocal estimate
+        float32x4_t recip = vrecpeq_f32(den);
+        recip = vmulq_f32(vrecpsq_f32(den, recip), recip);
+        recip = vmulq_f32(vrecpsq_f32(den, recip), recip);
+        vst1q_f32(data + i, vmulq_f32(num, recip));
+#endif
+    }
+    driveClipScalar(data + i, numSamples - i, gain);
+}
+
+float dotProductNeon(const float* a, const float* b, int numSamples) noexcept {
+    float32x4_t sum0 = vdupq_n_f32(0.0f);
+    float32x4_t sum1 = vdupq_n_f32(0.0f);
+
+    int i = 0;
+    for (; i + 8 <= numSamples; i += 8) {
+        sum0 = vmlaq_f32(sum0, vld1q_f32(a + i), vld1q_f32(b + i));
+        sum1 = vmlaq_f32(sum1, vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+    }
+    for (; i + 4 <= numSamples; i += 4) {
+        sum0 = vmlaq_f32(sum0, vld1q_f32(a + i), vld1q_f32(b + i));
+    }
+
+    const float32x4_t sum = vaddq_f32(sum0, sum1);
+    const float32x2_t half = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+    return vget_lane_f32(vpadd_f32(half, half), 0) + dotProductScalar(a + i, b + i, numSamples - i);
+}
+
+#endif // FINIRIG_SIMD_NEON
+
+SimdLevel detectSimdLevel() noexcept {
+#if defined(FINIRIG_SIMD_X86)
+    if (cpuSupportsAvx()) {
+        return SimdLevel::Avx;
+    }
+    return SimdLevel::Sse2;
+#elif defined(FINIRIG_SIMD_NEON)
+    return SimdLevel::Neon;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+} // namespace
+
+SimdLevel getSimdLevel() noexcept {
+    static const SimdLevel level = detectSimdLevel();
+    return level;
+}
+
+bool isSimdLevelSupported(SimdLevel level) noexcept {
+    switch (level) {
+        case SimdLevel::Scalar:
+            return true;
+#if defined(FINIRIG_SIMD_X86)
+        case SimdLevel::Sse2:
+            return true;
+        case SimdLevel::Avx:
+            return getSimdLevel() == SimdLevel::Avx;
+#endif
+#if defined(FINIRIG_SIMD_NEON)
+        case SimdLevel::Neon:
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+const char* getSimdLevelName(SimdLevel level) noexcept {
+    switch (level) {
+        case SimdLevel::Scalar: return "Scalar";
+        case SimdLevel::Sse2: return "SSE2";
+        case SimdLevel::Avx: return "AVX";
+        case SimdLevel::Neon: return "NEON";
+    }
+    return "Unknown";
+}
+
+DriveClipKernel getDriveClipKernel(SimdLevel level) noexcept {
+    if (!isSimdLevelSupported(level)) {
+        return driveClipScalar;
+    }
+
+    switch (level) {
+#if defined(FINIRIG_SIMD_X86)
+        case SimdLevel::Sse2: return driveClipSse2;
+        case SimdLevel::Avx: return driveClipAvx;
+#endif
+#if defined(FINIRIG_SIMD_NEON)
+        case SimdLevel::Neon: return driveClipNeon;
+#endif
+        default: return driveClipScalar;
+    }
+}
+
+DotProductKernel getDotProductKernel(SimdLevel level) noexcept {
+    if (!isSimdLevelSupported(level)) {
+        return dotProductScalar;
+    }
+
+    switch (level) {
+#if defined(FINIRIG_SIMD_X86)
+        case SimdLevel::Sse2: return dotProductSse2;
+        case SimdLevel::Avx: return dotProductAvx;
+#endif
+#if defined(FINIRIG_SIMD_NEON)
+        case SimdLevel::Neon: return dotProductNeon;
+#endif
+        default: return dotProductScalar;
+    }
+}
+
+} // namespace finirig::dsp
@@ -0,0 +1,94 @@
+#include "finirig/dsp/SpectrumAnalyzer.h"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <numeric>
+#include <stdexcept>
+
+namespace finirig::dsp {
+
+namespace {
+
+int checkedOrder(int fftOrder) {
+    if (fftOrder < 6 || fftOrder > 15) {
+        throw std::invalid_argument("SpectrumAnalyzer FFT order must be between 6 and 15");
+    }
+    return fftOrder;
+}
+
+} // namespace
+
+SpectrumAnalyzer::SpectrumAnalyzer(int fftOrder, float averaging)
+    : fft_(checkedOrder(fftOrder))
+    , fftSize_(1 << fftOrder)
+    , hopSize_(fftSize_ / 2)
+    , averaging_(averaging)
+    , window_(static_cast<size_t>(fftSize_))
+    , frame_(static_cast<size_t>(fftSize_), 0.0f)
+    , fftBuffer_(static_cast<size_t>(2 * fftSize_), 0.0f)
+    , power_(static_cast<size_t>(getNumBins()), 0.0f)
+    , magnitudesDb_(static_cast<size_t>(getNumBins()), MIN_DB)
+{
+    if (!(averaging >= 0.0f && averaging < 1.0f)) {
+        throw std::invalid_argument("SpectrumAnalyzer averaging must be in [0, 1)");
+    }
+
+    // Periodic Hann, so 50% overlapping frames sum to a constant
+    for (int i = 0; i < fftSize_; ++i) {
+        window_[static_cast<size_t>(i)] = static_cast<float>(
+            0.5 - 0.5 * std::cos(2.0 * std::numbers::pi * i / fftSize_)
+        );
+    }
+
+    // A sine of amplitude A peaks at A * sum(window) / 2 in its bin
+    amplitudeScale_ = 2.0f / std::accumulate(window_.begin(), window_.end(), 0.0f);
+}
+
+void SpectrumAnalyzer::reset() {
+    std::fill(frame_.begin(), frame_.end(), 0.0f);
+    frameFill_ = 0;
+    std::fill(power_.begin(), power_.end(), 0.0f);
+    std::fill(magnitudesDb_.begin(), magnitudesDb_.end(), MIN_DB);
+    frameCount_ = 0;
+}
+
+int SpectrumAnalyzer::process(const float* samples, int numSamples) {
+    int frames = 0;
+    while (numSamples > 0) {
+        const int count = std::min(numSamples, fftSize_ - frameFill_);
+        std::copy(samples, samples + count, frame_.begin() + frameFill_);
+        frameFill_ += count;
+        samples += count;
+        numSamples -= count;
+
+        if (frameFill_ == fftSize_) {
+            analyseFrame();
+            ++frames;
+
+            // Keep the newer half as the start of the next frame
+            std::copy(frame_.begin() + hopSize_, frame_.end(), frame_.begin());
+            frameFill_ = fftSize_ - hopSize_;
+        }
+    }
+    return frames;
+}
+
+void SpectrumAnalyzer::analyseFrame() {
+    juce::FloatVectorOperations::multiply(fftBuffer_.data(), frame_.data(), window_.data(), fftSize_);
+    fft_.performRealOnlyForwardTransform(fftBuffer_.data(), true);
+
+    const float newWeight = frameCount_ == 0 ? 1.0f : 1.0f - averaging_;
+    const float floorPower = std::pow(10.0f, MIN_DB / 10.0f);
+
+    for (int bin = 0; bin < getNumBins(); ++bin) {
+        const float re = fftBuffer_[static_cast<size_t>(2 * bin)] * amplitudeScale_;
+        const float im = fftBuffer_[static_cast<size_t>(2 * bin + 1)] * amplitudeScale_;
+        auto& power = power_[static_cast<size_t>(bin)];
+        power += newWeight * (re * re + im * im - power);
+        magnitudesDb_[static_cast<size_t>(bin)] = 10.0f * std::log10(std::max(power, floorPower));
+    }
+
+    ++frameCount_;
+}
+
+} // namespace finirig::dsp
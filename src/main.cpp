@@ -1,12 +1,18 @@
 #include "finirig/ui/MainWindow.h"
+#include "finirig/ui/StartupTimeline.h"
 #include <QApplication>
 #include <memory>
 
 int main(int argc, char* argv[]) {
+    // Started before anything else so every milestone is time since launch
+    finirig::ui::StartupTimeline timeline;
+
     QApplication app(argc, argv);
+    timeline.mark("Qt initialised");
 
-    finirig::ui::MainWindow window;
+    finirig::ui::MainWindow window(timeline);
     window.show();
+    timeline.mark("Window shown");
 
     return app.exec();
 }
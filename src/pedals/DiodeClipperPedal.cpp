@@ -0,0 +1,126 @@
+#include "finirig/pedals/DiodeClipperPedal.h"
+#include <algorithm>
+#include <cmath>
+
+namespace finirig::pedals {
+
+namespace {
+
+// Full scale input is treated as 1 V at the clipper's op-amp input
+constexpr float DRIVE_RANGE_DB = 40.0f;
+constexpr float SERIES_RESISTANCE = 2200.0f;
+constexpr float DARK_CAPACITANCE = 100e-9f;   // ~720 Hz corner
+constexpr float BRIGHT_CAPACITANCE = 10e-9f;  // ~7.2 kHz corner
+
+// Silicon diodes clip at roughly +-0.7 V; bring that back to full scale
+constexpr float OUTPUT_SCALE = 1.4f;
+
+} // namespace
+
+DiodeClipperPedal::DiodeClipperPedal()
+    : source_(SERIES_RESISTANCE)
+    , capacitor_(DARK_CAPACITANCE)
+{
+    prepare(44100.0);
+}
+
+void DiodeClipperPedal::setDrive(float drive) noexcept {
+    drive_.setValue(drive);
+}
+
+void DiodeClipperPedal::setTone(float tone) noexcept {
+    // The circuit is re-adapted on the audio thread in updateParameters()
+    tone_.setValue(tone);
+}
+
+void DiodeClipperPedal::setLevel(float level) noexcept {
+    level_.setValue(level);
+}
+
+void DiodeClipperPedal::prepare(double sampleRate) {
+    drive_.prepare(sampleRate);
+    tone_.prepare(sampleRate);
+    level_.prepare(sampleRate);
+    diodes_.prepare(sampleRate);
+    reset();
+}
+
+void DiodeClipperPedal::reset() {
+    drive_.reset();
+    tone_.reset();
+    level_.reset();
+    samplesUntilUpdate_ = 0;
+
+    diodes_.reset();
+    updateCapacitor();
+    updateGains();
+}
+
+float DiodeClipperPedal::processSampleImpl(float input) noexcept {
+    // Same update grid as the block path, so both produce identical ramps
+    if (samplesUntilUpdate_ == 0) {
+        updateParameters();
+        samplesUntilUpdate_ = PARAMETER_UPDATE_INTERVAL;
+    }
+    --samplesUntilUpdate_;
+
+    return processCircuit(input);
+}
+
+void DiodeClipperPedal::processChannelsImpl(
+    float* const* channelData,
+    int numChannels,
+    int numSamples
+) noexcept {
+    float* data = channelData[0];
+
+    for (int offset = 0; offset < numSamples;) {
+        if (samplesUntilUpdate_ == 0) {
+            updateParameters();
+            samplesUntilUpdate_ = PARAMETER_UPDATE_INTERVAL;
+        }
+
+        const int count = std::min(numSamples - offset, samplesUntilUpdate_);
+        for (int sample = offset; sample < offset + count; ++sample) {
+            data[sample] = processCircuit(data[sample]);
+        }
+        samplesUntilUpdate_ -= count;
+        offset += count;
+    }
+
+    for (int channel = 1; channel < numChannels; ++channel) {
+        juce::FloatVectorOperations::copy(channelData[channel], data, numSamples);
+    }
+}
+
+float DiodeClipperPedal::processCircuit(float input) noexcept {
+    source_.setVoltage(input * inputGain_);
+    diodes_.process();
+    return capacitor_.voltage() * outputGain_;
+}
+
+void DiodeClipperPedal::updateParameters() noexcept {
+    drive_.advance(PARAMETER_UPDATE_INTERVAL);
+    level_.advance(PARAMETER_UPDATE_INTERVAL);
+
+    // Re-adapting the tree only happens while the tone knob is moving
+    if (tone_.advance(PARAMETER_UPDATE_INTERVAL)) {
+        updateCapacitor();
+    }
+
+    updateGains();
+}
+
+void DiodeClipperPedal::updateGains() noexcept {
+    inputGain_ = std::pow(10.0f, DRIVE_RANGE_DB * drive_.getCurrentValue() / 20.0f);
+    outputGain_ = OUTPUT_SCALE * level_.getCurrentValue();
+}
+
+void DiodeClipperPedal::updateCapacitor() noexcept {
+    // Exponential sweep, so the corner frequency moves evenly in octaves
+    const float ratio = BRIGHT_CAPACITANCE / DARK_CAPACITANCE;
+    capacitor_.setCapacitance(DARK_CAPACITANCE * std::pow(ratio, tone_.getCurrentValue()));
+    diodes_.updatePortResistance();
+}
+
+} // namespace finirig::pedals
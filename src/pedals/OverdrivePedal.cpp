@@ -21,34 +21,50 @@ OverdrivePedal::OverdrivePedal() {
 }
 
 void OverdrivePedal::setDrive(float drive) noexcept {
-    drive_ = std::clamp(drive, 0.0f, 1.0f);
+    drive_.setValue(drive);
 }
 
 void OverdrivePedal::setTone(float tone) noexcept {
-    tone_ = std::clamp(tone, 0.0f, 1.0f);
-    updateFilterCoefficients();
+    // Coefficients follow on the audio thread in updateParameters()
+    tone_.setValue(tone);
 }
 
 void OverdrivePedal::setLevel(float level) noexcept {
-    level_ = std::clamp(level, 0.0f, 1.0f);
+    level_.setValue(level);
 }
 
 void OverdrivePedal::prepare(double sampleRate) {
     sampleRate_ = sampleRate;
-    updateFilterCoefficients();
+    drive_.prepare(sampleRate);
+    tone_.prepare(sampleRate);
+    level_.prepare(sampleRate);
     reset();
 }
 
 void OverdrivePedal::reset() {
+    drive_.reset();
+    tone_.reset();
+    level_.reset();
+    updateFilterCoefficients();
+    samplesUntilUpdate_ = 0;
     filterState_ = 0.0f;
 }
 
 float OverdrivePedal::processSampleImpl(float input) noexcept {
+    // Same update grid as the block path, so both produce identical ramps
+    if (samplesUntilUpdate_ == 0) {
+        updateParameters();
+        samplesUntilUpdate_ = PARAMETER_UPDATE_INTERVAL;
+    }
+    --samplesUntilUpdate_;
+
+    const float tone = tone_.getCurrentValue();
+
     // Apply drive (gain before clipping)
-    float driven = input * (1.0f + drive_ * 9.0f); // Drive range: 1x to 10x
+    float driven = input * (1.0f + drive_.getCurrentValue() * 9.0f); // Drive range: 1x to 10x
     
     // Soft clipping
-    float clipped = softClip(driven);
+    float clipped = finirig::dsp::softClip(driven);
     
     // Tone control (simple high-pass/low-pass blend)
     // Lowpass filter (one-pole)
@@ -59,18 +75,75 @@ float OverdrivePedal::processSampleImpl(float input) noexcept {
     float highpassed = clipped - lowpassed;
     
     // Blend based on tone control
-    float output = lowpassed * (1.0f - tone_) + highpassed * tone_;
+    float output = lowpassed * (1.0f - tone) + highpassed * tone;
     
     // Apply level
-    return output * level_;
+    return output * level_.getCurrentValue();
+}
+
+void OverdrivePedal::processChannelsImpl(
+    float* const* channelData,
+    int numChannels,
+    int numSamples
+) noexcept {
+    float* data = channelData[0];
+
+    // Parameters hold still between updates, so each slice runs with
+    // constant gains and coefficients
+    for (int offset = 0; offset < numSamples;) {
+        if (samplesUntilUpdate_ == 0) {
+            updateParameters();
+            samplesUntilUpdate_ = PARAMETER_UPDATE_INTERVAL;
+        }
+
+        const int count = std::min(numSamples - offset, samplesUntilUpdate_);
+        processSlice(data + offset, count);
+        samplesUntilUpdate_ -= count;
+        offset += count;
+    }
+
+    for (int channel = 1; channel < numChannels; ++channel) {
+        juce::FloatVectorOperations::copy(channelData[channel], data, numSamples);
+    }
 }
 
-void OverdrivePedal::updateFilterCoefficients() {
+void OverdrivePedal::processSlice(float* data, int numSamples) noexcept {
+    // Drive and soft clip have no state, so they run vectorised in place
+    driveClip_(data, numSamples, 1.0f + drive_.getCurrentValue() * 9.0f);
+
+    // Only the one-pole tone filter is recursive; it stays serial with the
+    // blend and level folded into the same pass
+    const float lowpassCoeff = lowpassCoeff_;
+    const float inputCoeff = 1.0f - lowpassCoeff_;
+    const float tone = tone_.getCurrentValue();
+    const float level = level_.getCurrentValue();
+    float state = filterState_;
+
+    for (int sample = 0; sample < numSamples; ++sample) {
+        const float clipped = data[sample];
+        state = state * lowpassCoeff + clipped * inputCoeff;
+        data[sample] = (state * (1.0f - tone) + (clipped - state) * tone) * level;
+    }
+
+    filterState_ = state;
+}
+
+void OverdrivePedal::updateParameters() noexcept {
+    drive_.advance(PARAMETER_UPDATE_INTERVAL);
+    level_.advance(PARAMETER_UPDATE_INTERVAL);
+
+    // The division below only runs while the tone knob is moving
+    if (tone_.advance(PARAMETER_UPDATE_INTERVAL)) {
+        updateFilterCoefficients();
+    }
+}
+
+void OverdrivePedal::updateFilterCoefficients() noexcept {
     // Simple one-pole filter coefficients
     // Cutoff frequency varies with tone control
     constexpr float minFreq = 200.0f;
     constexpr float maxFreq = 5000.0f;
-    float cutoffFreq = minFreq + tone_ * (maxFreq - minFreq);
+    float cutoffFreq = minFreq + tone_.getCurrentValue() * (maxFreq - minFreq);
     
     // Calculate filter coefficient
     float rc = 1.0f / (2.0f * static_cast<float>(M_PI) * cutoffFreq);
@@ -79,19 +152,5 @@ void OverdrivePedal::updateFilterCoefficients() {
     highpassCoeff_ = rc / (rc + dt);
 }
 
-float OverdrivePedal::softClip(float x) noexcept {
-    // Fast tanh approximation for soft clipping
-    // Using Pade approximation: x * (27 + x*x) / (27 + 9*x*x)
-    constexpr float threshold = 3.0f;
-    
-    if (std::abs(x) < threshold) {
-        float x2 = x * x;
-        return x * (27.0f + x2) / (27.0f + 9.0f * x2);
-    } else {
-        // Clamp for values beyond threshold
-        return x > 0.0f ? 1.0f : -1.0f;
-    }
-}
-
 } // namespace finirig::pedals
 
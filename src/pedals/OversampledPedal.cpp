@@ -0,0 +1,70 @@
+#include "finirig/pedals/OversampledPedal.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace finirig::pedals {
+
+OversampledPedal::OversampledPedal(
+    std::unique_ptr<PedalBase> pedal,
+    int factor,
+    finirig::dsp::Oversampler::Quality quality
+)
+    : pedal_(std::move(pedal))
+    , oversampler_(factor, quality)
+{
+    if (!pedal_) {
+        throw std::invalid_argument("OversampledPedal needs a pedal to wrap");
+    }
+    oversampler_.prepare(MAX_BLOCK_SIZE);
+}
+
+void OversampledPedal::prepare(double sampleRate) {
+    pedal_->prepare(sampleRate * oversampler_.getFactor());
+    oversampler_.prepare(MAX_BLOCK_SIZE);
+}
+
+void OversampledPedal::reset() {
+    pedal_->reset();
+    oversampler_.reset();
+}
+
+int OversampledPedal::getLatencySamples() const noexcept {
+    const double innerLatency =
+        static_cast<double>(pedal_->getLatencySamples()) / oversampler_.getFactor();
+    return static_cast<int>(std::lround(oversampler_.getLatencySamples() + innerLatency));
+}
+
+juce::String OversampledPedal::getName() const {
+    return pedal_->getName() + " (" + juce::String(oversampler_.getFactor()) + "x)";
+}
+
+float OversampledPedal::processSampleImpl(float input) noexcept {
+    float sample = input;
+    processOversampled(&sample, 1);
+    return sample;
+}
+
+void OversampledPedal::processChannelsImpl(
+    float* const* channelData,
+    int numChannels,
+    int numSamples
+) noexcept {
+    float* data = channelData[0];
+    for (int offset = 0; offset < numSamples; offset += MAX_BLOCK_SIZE) {
+        processOversampled(data + offset, std::min(MAX_BLOCK_SIZE, numSamples - offset));
+    }
+
+    for (int channel = 1; channel < numChannels; ++channel) {
+        juce::FloatVectorOperations::copy(channelData[channel], data, numSamples);
+    }
+}
+
+void OversampledPedal::processOversampled(float* data, int numSamples) noexcept {
+    float* oversampled = oversampler_.upsample(data, numSamples);
+    float* const channels[] = { oversampled };
+    pedal_->processChannels(channels, 1, numSamples * oversampler_.getFactor());
+    oversampler_.downsample(data, numSamples);
+}
+
+} // namespace finirig::pedals
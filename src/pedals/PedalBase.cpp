@@ -9,5 +9,32 @@ float PedalBase::processSample(float input) noexcept {
     return processSampleImpl(input);
 }
 
+void PedalBase::processChannels(
+    float* const* channelData,
+    int numChannels,
+    int numSamples
+) noexcept {
+    // Bypassed pedals leave the block untouched
+    if (!enabled_ || numChannels <= 0) {
+        return;
+    }
+    processChannelsImpl(channelData, numChannels, numSamples);
+}
+
+void PedalBase::processChannelsImpl(
+    float* const* channelData,
+    int numChannels,
+    int numSamples
+) noexcept {
+    float* data = channelData[0];
+    for (int sample = 0; sample < numSamples; ++sample) {
+        data[sample] = processSampleImpl(data[sample]);
+    }
+
+    for (int channel = 1; channel < numChannels; ++channel) {
+        juce::FloatVectorOperations::copy(channelData[channel], data, numSamples);
+    }
+}
+
 } // namespace finirig::pedals
 
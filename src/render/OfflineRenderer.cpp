@@ -0,0 +1,86 @@
+#include "finirig/render/OfflineRenderer.h"
+#include "finirig/audio/AudioProcessor.h"
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+namespace finirig::render {
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+}
+
+OfflineRenderer::OfflineRenderer(int chunkSize)
+    : chunkSize_(std::max(1, chunkSize))
+{
+}
+
+OfflineRenderer::Result OfflineRenderer::render(
+    juce::AudioFormatReader& reader,
+    juce::AudioFormatWriter& writer,
+    finirig::audio::AudioProcessor& processor
+) {
+    const auto renderStart = Clock::now();
+    const juce::ScopedNoDenormals noDenormals;
+
+    const int numChannels = std::max(1, static_cast<int>(writer.getNumChannels()));
+    juce::AudioBuffer<float> buffer(numChannels, chunkSize_);
+
+    processor.prepare(reader.sampleRate);
+    processor.reset();
+
+    Result result;
+    result.latencySamples = std::max(0, processor.getLatencySamples());
+    Clock::duration processingTime{};
+
+    // Run latency samples past the end of the input (reading silence there)
+    // and drop the same number from the start, so the output lines up with
+    // the input sample for sample
+    const juce::int64 totalSamples = reader.lengthInSamples + result.latencySamples;
+    juce::int64 samplesToSkip = result.latencySamples;
+
+    for (juce::int64 position = 0; position < totalSamples; position += chunkSize_) {
+        const auto numSamples = static_cast<int>(
+            std::min<juce::int64>(chunkSize_, totalSamples - position)
+        );
+        const auto numToRead = static_cast<int>(
+            std::clamp<juce::int64>(reader.lengthInSamples - position, 0, numSamples)
+        );
+
+        // Reader fills as many channels as it has; the processor works on
+        // channel 0 and fans the result out to the rest
+        buffer.clear();
+        if (numToRead > 0 && !reader.read(&buffer, 0, numToRead, position, true, true)) {
+            throw std::runtime_error("Failed to read input audio");
+        }
+
+        const auto processStart = Clock::now();
+        processor.processChannels(buffer.getArrayOfWritePointers(), numChannels, numSamples);
+        processingTime += Clock::now() - processStart;
+
+        const auto skipped = static_cast<int>(std::min<juce::int64>(samplesToSkip, numSamples));
+        samplesToSkip -= skipped;
+
+        const int numToWrite = numSamples - skipped;
+        if (numToWrite > 0 && !writer.writeFromAudioSampleBuffer(buffer, skipped, numToWrite)) {
+            throw std::runtime_error("Failed to write output audio");
+        }
+
+        result.numSamples += numToWrite;
+    }
+
+    writer.flush();
+
+    result.audioSeconds = reader.sampleRate > 0.0
+        ? static_cast<double>(result.numSamples) / reader.sampleRate
+        : 0.0;
+    result.processingSeconds = std::chrono::duration<double>(processingTime).count();
+    result.totalSeconds = secondsSince(renderStart);
+    return result;
+}
+
+} // namespace finirig::render
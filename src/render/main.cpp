@@ -0,0 +1,167 @@
+#include "finirig/render/OfflineRenderer.h"
+#include "finirig/audio/SignalChain.h"
+#include "finirig/amps/CabinetIR.h"
+#include "finirig/pedals/OverdrivePedal.h"
+#include "finirig/pedals/OversampledPedal.h"
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+namespace {
+
+void printUsage() {
+    std::cout
+        << "Usage: finirig_render <input> <output> [options]\n"
+        << "\n"
+        << "Streams <input> through the Finirig chain and writes <output>.\n"
+        << "The output format is chosen from the output file extension.\n"
+        << "\n"
+        << "Options:\n"
+        << "  --drive=<0..1>     Overdrive drive (default 0.5)\n"
+        << "  --tone=<0..1>      Overdrive tone (default 0.5)\n"
+        << "  --level=<0..1>     Overdrive level (default 0.7)\n"
+        << "  --oversample=<n>   Overdrive oversampling: 1, 2, 4 or 8 (default 2)\n"
+        << "  --quality=<q>      Oversampling filters: low, normal, high (default normal)\n"
+        << "  --ir=<file>        Cabinet impulse response (default: none)\n"
+        << "  --bits=<n>         Output bit depth (default: same as input)\n"
+        << "  --chunk=<samples>  Processing chunk size (default "
+        << finirig::render::OfflineRenderer::DEFAULT_CHUNK_SIZE << ")\n";
+}
+
+float getFloatOption(const juce::ArgumentList& args, const char* option, float defaultValue) {
+    return args.containsOption(option)
+        ? args.getValueForOption(option).getFloatValue()
+        : defaultValue;
+}
+
+int getIntOption(const juce::ArgumentList& args, const char* option, int defaultValue) {
+    return args.containsOption(option)
+        ? args.getValueForOption(option).getIntValue()
+        : defaultValue;
+}
+
+finirig::dsp::Oversampler::Quality getQualityOption(const juce::ArgumentList& args) {
+    using Quality = finirig::dsp::Oversampler::Quality;
+    if (!args.containsOption("--quality")) {
+        return Quality::Normal;
+    }
+
+    const auto value = args.getValueForOption("--quality").toLowerCase();
+    if (value == "low") {
+        return Quality::Low;
+    }
+    if (value == "high") {
+        return Quality::High;
+    }
+    if (value != "normal") {
+        throw std::invalid_argument("--quality must be low, normal or high");
+    }
+    return Quality::Normal;
+}
+
+std::unique_ptr<finirig::audio::SignalChain> createChain(const juce::ArgumentList& args, double sampleRate) {
+    auto pedal = std::make_unique<finirig::pedals::OverdrivePedal>();
+    pedal->setDrive(getFloatOption(args, "--drive", pedal->getDrive()));
+    pedal->setTone(getFloatOption(args, "--tone", pedal->getTone()));
+    pedal->setLevel(getFloatOption(args, "--level", pedal->getLevel()));
+
+    auto chain = std::make_unique<finirig::audio::SignalChain>();
+    chain->addStage(std::make_unique<finirig::pedals::OversampledPedal>(
+        std::move(pedal),
+        getIntOption(args, "--oversample", 2),
+        getQualityOption(args)
+    ));
+
+    if (args.containsOption("--ir")) {
+        // Prepared first so the IR is resampled once, to the render rate
+        auto cabinet = std::make_unique<finirig::amps::CabinetIR>();
+        cabinet->prepare(sampleRate);
+        cabinet->loadImpulseResponse(
+            juce::File::getCurrentWorkingDirectory().getChildFile(args.getValueForOption("--ir"))
+        );
+        chain->addStage(std::move(cabinet));
+    }
+    return chain;
+}
+
+int run(const juce::ArgumentList& args) {
+    if (args.size() < 2 || args.containsOption("--help|-h")) {
+        printUsage();
+        return args.containsOption("--help|-h") ? 0 : 1;
+    }
+
+    const auto inputFile = args[0].resolveAsFile();
+    const auto outputFile = args[1].resolveAsFile();
+
+    juce::AudioFormatManager formatManager;
+    formatManager.registerBasicFormats();
+
+    std::unique_ptr<juce::AudioFormatReader> reader(formatManager.createReaderFor(inputFile));
+    if (!reader) {
+        std::cerr << "Cannot read audio file: " << inputFile.getFullPathName() << "\n";
+        return 1;
+    }
+
+    auto* outputFormat = formatManager.findFormatForFileExtension(outputFile.getFileExtension());
+    if (outputFormat == nullptr) {
+        std::cerr << "Unsupported output format: " << outputFile.getFileName() << "\n";
+        return 1;
+    }
+
+    outputFile.deleteFile();
+    std::unique_ptr<juce::FileOutputStream> outputStream(outputFile.createOutputStream());
+    if (!outputStream) {
+        std::cerr << "Cannot open output file: " << outputFile.getFullPathName() << "\n";
+        return 1;
+    }
+
+    const int bitsPerSample = getIntOption(args, "--bits", static_cast<int>(reader->bitsPerSample));
+    std::unique_ptr<juce::AudioFormatWriter> writer(outputFormat->createWriterFor(
+        outputStream.get(),
+        reader->sampleRate,
+        reader->numChannels,
+        bitsPerSample,
+        {},
+        0
+    ));
+    if (!writer) {
+        std::cerr << "Cannot create " << outputFormat->getFormatName()
+                  << " writer (" << bitsPerSample << " bit)\n";
+        return 1;
+    }
+    outputStream.release(); // Owned by the writer now
+
+    auto chain = createChain(args, reader->sampleRate);
+    finirig::render::OfflineRenderer renderer(
+        getIntOption(args, "--chunk", finirig::render::OfflineRenderer::DEFAULT_CHUNK_SIZE)
+    );
+
+    const auto result = renderer.render(*reader, *writer, *chain);
+    writer.reset(); // Finalise the file header
+
+    std::cout << std::fixed << std::setprecision(2)
+              << "Rendered " << result.audioSeconds << " s of audio ("
+              << result.numSamples << " samples, " << reader->numChannels << " ch, "
+              << reader->sampleRate << " Hz)\n"
+              << "Latency compensated: " << result.latencySamples << " samples\n"
+              << "Processing: " << result.processingSeconds << " s, "
+              << result.getRealtimeFactor() << "x realtime\n"
+              << "Total (incl. I/O): " << result.totalSeconds << " s, "
+              << (result.totalSeconds > 0.0 ? result.audioSeconds / result.totalSeconds : 0.0)
+              << "x realtime\n";
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        return run(juce::ArgumentList(argc, argv));
+    } catch (const std::exception& error) {
+        std::cerr << "finirig_render: " << error.what() << "\n";
+        return 1;
+    }
+}
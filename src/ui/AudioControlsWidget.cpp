@@ -1,4 +1,5 @@
 #include "finirig/ui/AudioControlsWidget.h"
+#include <QCheckBox>
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QPushButton>
@@ -26,6 +27,16 @@ void AudioControlsWidget::setupUI() {
     );
     layout->addWidget(startStopButton_);
 
+    // Pipelined processing: one extra buffer of latency for more DSP headroom
+    pipelinedCheckBox_ = new QCheckBox("Pipelined processing (+1 buffer latency)", this);
+    connect(
+        pipelinedCheckBox_,
+        &QCheckBox::toggled,
+        this,
+        &AudioControlsWidget::pipelinedProcessingToggled
+    );
+    layout->addWidget(pipelinedCheckBox_);
+
     // Status label
     statusLabel_ = new QLabel("Status: Stopped", this);
     layout->addWidget(statusLabel_);
@@ -6,6 +6,8 @@
 #include <QLabel>
 #include <QComboBox>
 #include <QGroupBox>
+#include <QPushButton>
+#include <QSignalBlocker>
 #include <QString>
 
 namespace finirig::ui {
@@ -14,6 +16,16 @@ DeviceInfoWidget::DeviceInfoWidget(QWidget* parent)
     : QWidget(parent)
 {
     setupUI();
+
+    // The catalogue emits from its own thread; the combos are only
+    // repopulated once the event reaches the UI thread
+    connect(
+        this,
+        &DeviceInfoWidget::deviceListChanged,
+        this,
+        &DeviceInfoWidget::populateDeviceLists,
+        Qt::QueuedConnection
+    );
 }
 
 void DeviceInfoWidget::setupUI() {
@@ -28,6 +40,10 @@ void DeviceInfoWidget::setupUI() {
     
     selectionLayout->addRow("Input Device:", inputDeviceCombo_);
     selectionLayout->addRow("Output Device:", outputDeviceCombo_);
+
+    rescanButton_ = new QPushButton("Rescan Devices", this);
+    selectionLayout->addRow(rescanButton_);
+    connect(rescanButton_, &QPushButton::clicked, this, &DeviceInfoWidget::refreshDevices);
     
     connect(
         inputDeviceCombo_,
@@ -54,6 +70,7 @@ void DeviceInfoWidget::setupUI() {
     bufferSizeLabel_ = new QLabel("--", this);
     inputChannelsLabel_ = new QLabel("--", this);
     outputChannelsLabel_ = new QLabel("--", this);
+    latencyLabel_ = new QLabel("--", this);
     
     infoLayout->addRow("Device Name:", deviceNameLabel_);
     infoLayout->addRow("Device Type:", deviceTypeLabel_);
@@ -61,14 +78,32 @@ void DeviceInfoWidget::setupUI() {
     infoLayout->addRow("Buffer Size:", bufferSizeLabel_);
     infoLayout->addRow("Input Channels:", inputChannelsLabel_);
     infoLayout->addRow("Output Channels:", outputChannelsLabel_);
+    infoLayout->addRow("Latency:", latencyLabel_);
     
     layout->addWidget(infoGroup);
+    
+    // DSP load group
+    auto* loadGroup = new QGroupBox("DSP Load", this);
+    auto* loadLayout = new QFormLayout(loadGroup);
+    
+    dspLoadLabel_ = new QLabel("--", this);
+    overrunsLabel_ = new QLabel("--", this);
+    
+    loadLayout->addRow("Load (avg / max):", dspLoadLabel_);
+    loadLayout->addRow("Overruns:", overrunsLabel_);
+    
+    layout->addWidget(loadGroup);
     layout->addStretch();
 }
 
 void DeviceInfoWidget::setAudioEngine(finirig::audio::AudioEngine* engine) {
     audioEngine_ = engine;
-    refreshDevices();
+    if (audioEngine_) {
+        // The engine, and with it the catalogue thread, is destroyed before
+        // the window's child widgets, so this never outlives the widget
+        audioEngine_->getDeviceCatalogue().setChangeCallback([this] { emit deviceListChanged(); });
+    }
+    populateDeviceLists();
     updateDeviceInfo();
 }
 
@@ -76,36 +111,45 @@ void DeviceInfoWidget::refreshDevices() {
     if (!audioEngine_) {
         return;
     }
-    
-    // Store current selections
-    QString currentInput = inputDeviceCombo_->currentText();
-    QString currentOutput = outputDeviceCombo_->currentText();
-    
-    // Clear and populate input devices
-    inputDeviceCombo_->clear();
-    auto inputDevices = audioEngine_->getInputDeviceNames();
-    for (const auto& device : inputDevices) {
-        inputDeviceCombo_->addItem(QString::fromStdString(device.toStdString()));
-    }
-    
-    // Restore selection if still available
-    int inputIndex = inputDeviceCombo_->findText(currentInput);
-    if (inputIndex >= 0) {
-        inputDeviceCombo_->setCurrentIndex(inputIndex);
-    }
-    
-    // Clear and populate output devices
-    outputDeviceCombo_->clear();
-    auto outputDevices = audioEngine_->getOutputDeviceNames();
-    for (const auto& device : outputDevices) {
-        outputDeviceCombo_->addItem(QString::fromStdString(device.toStdString()));
+
+    audioEngine_->getDeviceCatalogue().requestRescan();
+}
+
+void DeviceInfoWidget::populateDeviceLists() {
+    if (!audioEngine_) {
+        return;
     }
-    
-    // Restore selection if still available
-    int outputIndex = outputDeviceCombo_->findText(currentOutput);
-    if (outputIndex >= 0) {
-        outputDeviceCombo_->setCurrentIndex(outputIndex);
+
+    const auto snapshot = audioEngine_->getDeviceCatalogue().getSnapshot();
+    if (!snapshot.scanned) {
+        // First scan still running; deviceListChanged() follows when it is done
+        inputDeviceCombo_->setPlaceholderText("Scanning...");
+        outputDeviceCombo_->setPlaceholderText("Scanning...");
+        return;
     }
+
+    auto fill = [](QComboBox* combo, const juce::StringArray& devices, const juce::String& openName) {
+        const QString current = combo->currentText();
+        const QString openDevice = QString::fromStdString(openName.toStdString());
+
+        // Repopulating must not switch devices, so keep the combo quiet
+        const QSignalBlocker blocker(combo);
+        combo->clear();
+        combo->setPlaceholderText({});
+        for (const auto& device : devices) {
+            combo->addItem(QString::fromStdString(device.toStdString()));
+        }
+
+        // Restore selection if still available, else show the open device
+        int index = combo->findText(current);
+        if (index < 0 && !openDevice.isEmpty()) {
+            index = combo->findText(": " + openDevice, Qt::MatchEndsWith);
+        }
+        combo->setCurrentIndex(index);
+    };
+
+    fill(inputDeviceCombo_, snapshot.getInputDeviceNames(), audioEngine_->getCurrentInputDeviceName());
+    fill(outputDeviceCombo_, snapshot.getOutputDeviceNames(), audioEngine_->getCurrentOutputDeviceName());
 }
 
 void DeviceInfoWidget::updateDeviceInfo() {
@@ -131,10 +175,34 @@ void DeviceInfoWidget::updateDeviceInfo() {
             inputChannelsLabel_->setText(line.mid(16).trimmed());
         } else if (line.startsWith("Output Channels:")) {
             outputChannelsLabel_->setText(line.mid(17).trimmed());
+        } else if (line.startsWith("Total Latency:")) {
+            latencyLabel_->setText(line.mid(15).trimmed());
         }
     }
 }
 
+void DeviceInfoWidget::updateLoadInfo() {
+    if (!audioEngine_) {
+        return;
+    }
+    
+    auto stats = audioEngine_->getLoadStatistics();
+    if (stats.numCallbacks == 0) {
+        dspLoadLabel_->setText("--");
+        overrunsLabel_->setText("--");
+        return;
+    }
+    
+    dspLoadLabel_->setText(
+        QString("%1% / %2%")
+            .arg(static_cast<double>(stats.averageLoad) * 100.0, 0, 'f', 1)
+            .arg(static_cast<double>(stats.maxLoad) * 100.0, 0, 'f', 1)
+    );
+    overrunsLabel_->setText(
+        QString("%1 of %2 callbacks").arg(stats.numOverruns).arg(stats.numCallbacks)
+    );
+}
+
 void DeviceInfoWidget::onInputDeviceChanged(int index) {
     if (!audioEngine_ || index < 0) {
         return;
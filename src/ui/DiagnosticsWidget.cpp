@@ -0,0 +1,103 @@
+#include "finirig/ui/DiagnosticsWidget.h"
+#include <QVBoxLayout>
+#include <QGroupBox>
+#include <QHeaderView>
+#include <QPushButton>
+#include <QTableWidget>
+#include <QString>
+
+namespace finirig::ui {
+
+namespace {
+enum Column {
+    NameColumn = 0,
+    LoadColumn,
+    CostColumn,
+    PeakColumn,
+    BlocksColumn,
+    NumColumns
+};
+}
+
+DiagnosticsWidget::DiagnosticsWidget(QWidget* parent)
+    : QWidget(parent)
+{
+    setupUI();
+}
+
+void DiagnosticsWidget::setupUI() {
+    auto* layout = new QVBoxLayout(this);
+    
+    auto* group = new QGroupBox("Stage Profiling", this);
+    auto* groupLayout = new QVBoxLayout(group);
+    
+    stageTable_ = new QTableWidget(0, NumColumns, this);
+    stageTable_->setHorizontalHeaderLabels({"Stage", "Load", "ns/sample", "Peak block", "Blocks"});
+    stageTable_->horizontalHeader()->setSectionResizeMode(NameColumn, QHeaderView::Stretch);
+    stageTable_->verticalHeader()->setVisible(false);
+    stageTable_->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    stageTable_->setSelectionMode(QAbstractItemView::NoSelection);
+    groupLayout->addWidget(stageTable_);
+    
+    resetButton_ = new QPushButton("Reset", this);
+    connect(resetButton_, &QPushButton::clicked, this, &DiagnosticsWidget::onResetClicked);
+    groupLayout->addWidget(resetButton_);
+    
+    layout->addWidget(group);
+}
+
+void DiagnosticsWidget::setSignalChain(finirig::audio::SignalChain* chain) {
+    signalChain_ = chain;
+    stageTable_->setRowCount(0);
+}
+
+void DiagnosticsWidget::updateStatistics(double sampleRate) {
+    if (!signalChain_) {
+        return;
+    }
+    
+    const auto stages = signalChain_->getStageStatistics();
+    const auto numRows = static_cast<int>(stages.size());
+    
+    // Only rebuild the items when the chain changes shape
+    if (stageTable_->rowCount() != numRows) {
+        stageTable_->setRowCount(numRows);
+        for (int row = 0; row < numRows; ++row) {
+            for (int column = 0; column < NumColumns; ++column) {
+                auto* item = new QTableWidgetItem();
+                if (column != NameColumn) {
+                    item->setTextAlignment(Qt::AlignRight | Qt::AlignVCenter);
+                }
+                stageTable_->setItem(row, column, item);
+            }
+        }
+    }
+    
+    for (int row = 0; row < numRows; ++row) {
+        const auto& stage = stages[static_cast<size_t>(row)];
+        QString name = QString::fromStdString(stage.name.toStdString());
+        if (stage.bypassed) {
+            name += " (bypassed)";
+        }
+        
+        stageTable_->item(row, NameColumn)->setText(name);
+        stageTable_->item(row, LoadColumn)->setText(
+            QString("%1%").arg(stage.stats.getLoad(sampleRate) * 100.0, 0, 'f', 2)
+        );
+        stageTable_->item(row, CostColumn)->setText(
+            QString::number(stage.stats.getNanosecondsPerSample(), 'f', 1)
+        );
+        stageTable_->item(row, PeakColumn)->setText(
+            QString("%1 us").arg(static_cast<double>(stage.stats.peakBlockNanoseconds) / 1000.0, 0, 'f', 1)
+        );
+        stageTable_->item(row, BlocksColumn)->setText(QString::number(stage.stats.numBlocks));
+    }
+}
+
+void DiagnosticsWidget::onResetClicked() {
+    if (signalChain_) {
+        signalChain_->resetStageStatistics();
+    }
+}
+
+} // namespace finirig::ui
@@ -1,118 +1,282 @@
 #include "finirig/ui/LevelMeterWidget.h"
+#include <QLinearGradient>
+#include <QMouseEvent>
 #include <QPainter>
 #include <QPaintEvent>
+#include <QRegion>
 #include <QTimer>
 #include <algorithm>
 #include <cmath>
 
 namespace finirig::ui {
 
-LevelMeterWidget::LevelMeterWidget(const QString& label, QWidget* parent)
+namespace {
+constexpr int MARGIN = 5;
+constexpr int LABEL_HEIGHT = 20;
+constexpr int LEVEL_TEXT_HEIGHT = 15;
+constexpr int PEAK_LINE_HEIGHT = 2;
+constexpr int CLIP_HEIGHT = 6;
+constexpr int CLIP_GAP = 2;
+constexpr int CHANNEL_GAP = 2;
+
+const QColor METER_BACKGROUND(30, 30, 30);
+const QColor SCALE_COLOR(100, 100, 100);
+const QColor TEXT_COLOR(200, 200, 200);
+const QColor PEAK_COLOR(255, 255, 255);
+const QColor CLIP_COLOR(255, 0, 0);
+const QColor CLIP_OFF_COLOR(60, 20, 20);
+}
+
+LevelMeterWidget::LevelMeterWidget(const QString& label, int numChannels, QWidget* parent)
     : QWidget(parent)
     , label_(label)
+    , numChannels_(std::clamp(numChannels, 1, MAX_CHANNELS))
 {
     setMinimumSize(30, 200);
     setMaximumWidth(50);
-    
-    // Peak hold timer
-    peakHoldTimer_ = new QTimer(this);
-    peakHoldTimer_->setSingleShot(true);
-    peakHoldTimer_->setInterval(1000); // 1 second peak hold
-}
+    setToolTip("Click to clear the clip indicators");
+
+    // Every pixel is painted from the cache, so Qt need not clear first
+    setAttribute(Qt::WA_OpaquePaintEvent);
 
-void LevelMeterWidget::setLevel(float level) {
-    level_ = std::clamp(level, 0.0f, 1.0f);
-    update(); // Trigger repaint
+    // Connected once; it only runs while a held peak is above its level
+    peakDecayTimer_ = new QTimer(this);
+    peakDecayTimer_->setInterval(PEAK_DECAY_INTERVAL_MS);
+    connect(peakDecayTimer_, &QTimer::timeout, this, &LevelMeterWidget::decayPeak);
+    clock_.start();
 }
 
-void LevelMeterWidget::setPeak(float peak) {
-    peak_ = std::clamp(peak, 0.0f, 1.0f);
+void LevelMeterWidget::setNumChannels(int numChannels) {
+    numChannels = std::clamp(numChannels, 1, MAX_CHANNELS);
+    if (numChannels == numChannels_) {
+        return;
+    }
+
+    numChannels_ = numChannels;
+    for (auto channel = static_cast<std::size_t>(numChannels); channel < channels_.size(); ++channel) {
+        channels_[channel] = Channel{};
+    }
+
+    // Bar widths change, so everything is laid out and painted again
+    rebuildCache();
     update();
-    
-    // Reset peak after hold time
-    if (peakHoldTimer_) {
-        peakHoldTimer_->stop();
-        peakHoldTimer_->start();
-        connect(peakHoldTimer_, &QTimer::timeout, this, [this]() {
-            peak_ = 0.0f;
-            update();
-        });
+}
+
+void LevelMeterWidget::setLevels(int channel, float rms, float peak, bool clipped) {
+    if (channel < 0 || channel >= numChannels_) {
+        return;
     }
+
+    auto& state = channels_[static_cast<std::size_t>(channel)];
+    state.level = std::clamp(rms, 0.0f, 1.0f);
+    peak = std::clamp(std::max(peak, state.level), 0.0f, 1.0f);
+    state.clipped = state.clipped || clipped;
+
+    if (peak >= state.peak) {
+        state.peak = peak;
+        state.holdUntilMs = clock_.elapsed() + PEAK_HOLD_MS;
+    }
+
+    // The timer stops once every line has met its level; a quieter block
+    // afterwards must start it again or the line would freeze
+    if (state.peak > state.level && !peakDecayTimer_->isActive()) {
+        peakDecayTimer_->start();
+    }
+    refresh();
 }
 
-void LevelMeterWidget::paintEvent(QPaintEvent* event) {
-    Q_UNUSED(event)
-    
-    QPainter painter(this);
-    painter.setRenderHint(QPainter::Antialiasing);
-    
+void LevelMeterWidget::reset() {
+    for (auto& channel : channels_) {
+        channel.level = 0.0f;
+        channel.peak = 0.0f;
+        channel.clipped = false;
+    }
+    peakDecayTimer_->stop();
+    refresh();
+}
+
+void LevelMeterWidget::mousePressEvent(QMouseEvent* event) {
+    for (auto& channel : channels_) {
+        channel.clipped = false;
+    }
+    refresh();
+    event->accept();
+}
+
+void LevelMeterWidget::decayPeak() {
+    const float step = PEAK_DECAY_PER_SECOND * PEAK_DECAY_INTERVAL_MS / 1000.0f;
+    const qint64 now = clock_.elapsed();
+
+    bool holding = false;
+    for (auto& channel : channels_) {
+        if (now >= channel.holdUntilMs) {
+            channel.peak = std::max(channel.level, channel.peak - step);
+        }
+        holding = holding || channel.peak > channel.level;
+    }
+
+    if (!holding) {
+        peakDecayTimer_->stop();
+    }
+    refresh();
+}
+
+float LevelMeterWidget::maxLevel() const {
+    float level = 0.0f;
+    for (int channel = 0; channel < numChannels_; ++channel) {
+        level = std::max(level, channels_[static_cast<std::size_t>(channel)].level);
+    }
+    return level;
+}
+
+int LevelMeterWidget::toPixels(float value) const {
+    // Every bar has the same height
+    return static_cast<int>(std::lround(value * static_cast<float>(channels_[0].meterRect.height())));
+}
+
+QRect LevelMeterWidget::barRect(int channel, int pixels) const {
+    const QRect& meter = channels_[static_cast<std::size_t>(channel)].meterRect;
+    return QRect(meter.x(), meter.bottom() + 1 - pixels, meter.width(), pixels);
+}
+
+QRect LevelMeterWidget::peakRect(int channel, int pixels) const {
+    const QRect& meter = channels_[static_cast<std::size_t>(channel)].meterRect;
+    return QRect(meter.x(), meter.bottom() + 1 - pixels, meter.width(), PEAK_LINE_HEIGHT);
+}
+
+void LevelMeterWidget::refresh() {
+    QRegion dirty;
+    for (int index = 0; index < numChannels_; ++index) {
+        auto& channel = channels_[static_cast<std::size_t>(index)];
+        const int levelPixels = toPixels(channel.level);
+        const int peakPixels = toPixels(channel.peak);
+
+        if (levelPixels != channel.levelPixels) {
+            // Only the strip between the old and new bar tops changes
+            dirty += barRect(index, std::max(levelPixels, channel.levelPixels)).adjusted(
+                0, 0, 0, -std::min(levelPixels, channel.levelPixels)
+            );
+        }
+        if (peakPixels != channel.peakPixels) {
+            dirty += peakRect(index, channel.peakPixels);
+            dirty += peakRect(index, peakPixels);
+        }
+        if (channel.clipped != channel.clipShown) {
+            dirty += channel.clipRect;
+        }
+
+        channel.levelPixels = levelPixels;
+        channel.peakPixels = peakPixels;
+        channel.clipShown = channel.clipped;
+    }
+
+    const int levelPercent = static_cast<int>(maxLevel() * 100.0f);
+    if (levelPercent != levelPercent_) {
+        dirty += levelTextRect_;
+    }
+    levelPercent_ = levelPercent;
+
+    if (!dirty.isEmpty()) {
+        update(dirty);
+    }
+}
+
+void LevelMeterWidget::resizeEvent(QResizeEvent* event) {
+    QWidget::resizeEvent(event);
+    rebuildCache();
+}
+
+void LevelMeterWidget::rebuildCache() {
     const int width = this->width();
     const int height = this->height();
-    const int margin = 5;
-    const int meterWidth = width - 2 * margin;
-    const int meterHeight = height - 40; // Leave space for label
-    const int meterX = margin;
-    const int meterY = margin;
-    
-    // Background
-    painter.fillRect(meterX, meterY, meterWidth, meterHeight, QColor(30, 30, 30));
-    
-    // Calculate level bar height
-    int levelHeight = static_cast<int>(meterHeight * level_);
-    int peakY = meterY + meterHeight - static_cast<int>(meterHeight * peak_);
-    
-    // Color gradient: green -> yellow -> red
-    QColor color;
-    if (level_ < 0.7f) {
-        // Green to yellow
-        float t = level_ / 0.7f;
-        color = QColor(
-            static_cast<int>(0 + t * 255),
-            static_cast<int>(255 - t * 100),
-            0
-        );
-    } else {
-        // Yellow to red
-        float t = (level_ - 0.7f) / 0.3f;
-        color = QColor(
-            255,
-            static_cast<int>(155 - t * 155),
-            0
-        );
-    }
-    
-    // Draw level bar
-    if (levelHeight > 0) {
-        painter.fillRect(
-            meterX,
-            meterY + meterHeight - levelHeight,
-            meterWidth,
-            levelHeight,
-            color
-        );
-    }
-    
-    // Draw peak indicator
-    if (peak_ > 0.0f) {
-        painter.setPen(QPen(QColor(255, 255, 255), 2));
-        painter.drawLine(meterX, peakY, meterX + meterWidth, peakY);
-    }
-    
-    // Draw scale marks
-    painter.setPen(QPen(QColor(100, 100, 100), 1));
-    for (int i = 0; i <= 10; ++i) {
-        int y = meterY + (meterHeight * i / 10);
-        painter.drawLine(meterX, y, meterX + 5, y);
-    }
-    
-    // Draw label
-    painter.setPen(QPen(QColor(200, 200, 200), 1));
-    painter.drawText(0, height - 20, width, 20, Qt::AlignCenter, label_);
-    
+
+    // Clip indicators on top, then the bars side by side, then the text and label
+    const int meterTop = MARGIN + CLIP_HEIGHT + CLIP_GAP;
+    const int meterHeight = height - meterTop - MARGIN - LABEL_HEIGHT - LEVEL_TEXT_HEIGHT;
+    const int barWidth = (width - 2 * MARGIN - (numChannels_ - 1) * CHANNEL_GAP) / numChannels_;
+    for (int index = 0; index < numChannels_; ++index) {
+        auto& channel = channels_[static_cast<std::size_t>(index)];
+        const int x = MARGIN + index * (barWidth + CHANNEL_GAP);
+        channel.clipRect = QRect(x, MARGIN, barWidth, CLIP_HEIGHT);
+        channel.meterRect = QRect(x, meterTop, barWidth, meterHeight);
+    }
+    const QRect& firstMeter = channels_[0].meterRect;
+    levelTextRect_ = QRect(0, firstMeter.bottom() + 1 + MARGIN, width, LEVEL_TEXT_HEIGHT);
+
+    const qreal pixelRatio = devicePixelRatioF();
+    auto makePixmap = [&](const QBrush& meterFill) {
+        QPixmap pixmap(size() * pixelRatio);
+        pixmap.setDevicePixelRatio(pixelRatio);
+        pixmap.fill(palette().color(backgroundRole()));
+
+        QPainter painter(&pixmap);
+        for (int index = 0; index < numChannels_; ++index) {
+            painter.fillRect(channels_[static_cast<std::size_t>(index)].meterRect, meterFill);
+        }
+
+        // Scale marks
+        painter.setPen(QPen(SCALE_COLOR, 1));
+        for (int i = 0; i <= 10; ++i) {
+            const int y = firstMeter.y() + (firstMeter.height() * i / 10);
+            painter.drawLine(firstMeter.x(), y, firstMeter.x() + 5, y);
+        }
+
+        // Label
+        painter.setPen(QPen(TEXT_COLOR, 1));
+        painter.drawText(0, height - LABEL_HEIGHT, width, LABEL_HEIGHT, Qt::AlignCenter, label_);
+        return pixmap;
+    };
+
+    // Color gradient: green -> yellow -> red, by height
+    QLinearGradient gradient(0, firstMeter.bottom(), 0, firstMeter.top());
+    gradient.setColorAt(0.0, QColor(0, 255, 0));
+    gradient.setColorAt(0.7, QColor(255, 155, 0));
+    gradient.setColorAt(1.0, QColor(255, 0, 0));
+
+    unlit_ = makePixmap(METER_BACKGROUND);
+    lit_ = makePixmap(gradient);
+
+    // Positions in the new geometry; Qt repaints the whole widget after a
+    // resize or screen change anyway
+    for (auto& channel : channels_) {
+        channel.levelPixels = toPixels(channel.level);
+        channel.peakPixels = toPixels(channel.peak);
+        channel.clipShown = channel.clipped;
+    }
+}
+
+void LevelMeterWidget::paintEvent(QPaintEvent* event) {
+    if (!qFuzzyCompare(unlit_.devicePixelRatio(), devicePixelRatioF())) {
+        // Moved to a screen with a different scale factor
+        rebuildCache();
+    }
+
+    // Qt clips to the dirty region, so each blit only touches what changed
+    QPainter painter(this);
+    painter.drawPixmap(0, 0, unlit_);
+
+    for (int index = 0; index < numChannels_; ++index) {
+        const auto& channel = channels_[static_cast<std::size_t>(index)];
+
+        painter.save();
+        painter.setClipRect(barRect(index, channel.levelPixels));
+        painter.drawPixmap(0, 0, lit_);
+        painter.restore();
+
+        // Draw peak indicator
+        if (channel.peakPixels > 0) {
+            painter.fillRect(peakRect(index, channel.peakPixels), PEAK_COLOR);
+        }
+
+        // Draw clip indicator
+        painter.fillRect(channel.clipRect, channel.clipShown ? CLIP_COLOR : CLIP_OFF_COLOR);
+    }
+
     // Draw level text
-    QString levelText = QString::number(static_cast<int>(level_ * 100)) + "%";
-    painter.drawText(0, height - 5, width, 15, Qt::AlignCenter, levelText);
+    if (event->rect().intersects(levelTextRect_)) {
+        painter.setPen(QPen(TEXT_COLOR, 1));
+        painter.drawText(levelTextRect_, Qt::AlignCenter, QString::number(levelPercent_) + "%");
+    }
 }
 
 } // namespace finirig::ui
-
@@ -2,8 +2,14 @@
 #include "finirig/ui/AudioControlsWidget.h"
 #include "finirig/ui/LevelMeterWidget.h"
 #include "finirig/ui/DeviceInfoWidget.h"
+#include "finirig/ui/DiagnosticsWidget.h"
+#include "finirig/ui/SpectrumWidget.h"
+#include "finirig/ui/StartupTimeline.h"
+#include "finirig/ui/TunerWidget.h"
 #include "finirig/audio/AudioEngine.h"
+#include "finirig/audio/SignalChain.h"
 #include "finirig/pedals/OverdrivePedal.h"
+#include "finirig/pedals/OversampledPedal.h"
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QWidget>
@@ -12,53 +18,61 @@
 #include <QPixmap>
 #include <QTimer>
 #include <QGroupBox>
-#include <QApplication>
-#include <QDir>
+#include <QMetaObject>
+#include <QProgressBar>
+#include <QStatusBar>
+#include <QThreadPool>
+#include <QDebug>
+#include <algorithm>
 
 namespace finirig::ui {
 
-MainWindow::MainWindow(QWidget* parent)
+namespace {
+constexpr double DEFAULT_SAMPLE_RATE = 44100.0;
+constexpr int DEFAULT_BUFFER_SIZE = 512;
+
+// Startup milestones
+const QString WINDOW_BUILT = "Window built";
+const QString DEVICE_OPENED = "Audio device open";
+const QString DEVICE_FAILED = "Audio device failed";
+const QString CHAIN_LOADED = "Signal chain loaded";
+const QString AUDIO_READY = "Audio ready";
+const QString AUDIO_STARTED = "Audio start requested";
+const QString FIRST_AUDIO = "First audio block";
+
+std::unique_ptr<finirig::audio::SignalChain> createDefaultChain() {
+    // An overdrive pedal, oversampled 2x to keep clipping harmonics from
+    // aliasing. Presets, cabinet IRs and amp models belong here too: this
+    // runs on a startup worker, so loading them never delays the window.
+    auto chain = std::make_unique<finirig::audio::SignalChain>();
+    chain->addStage(std::make_unique<finirig::pedals::OversampledPedal>(
+        std::make_unique<finirig::pedals::OverdrivePedal>(), 2
+    ));
+    return chain;
+}
+}
+
+MainWindow::MainWindow(StartupTimeline& timeline, QWidget* parent)
     : QMainWindow(parent)
+    , timeline_(timeline)
     , audioEngine_(std::make_unique<finirig::audio::AudioEngine>())
 {
     setupUI();
+    timeline_.mark(WINDOW_BUILT);
     setupAudioEngine();
 }
 
-MainWindow::~MainWindow() = default;
+MainWindow::~MainWindow() {
+    // Startup jobs use the engine and the chain slot; let them finish first
+    startupPool_->waitForDone();
+}
 
 void MainWindow::setupUI() {
     setWindowTitle("Finirig - Guitar Processing");
     resize(1000, 700);
 
-    // Set window icon and load icon for display
-    QPixmap iconPixmap;
-    
-    // Try multiple paths to find the icon
-    // On macOS, app is in .app/Contents/MacOS/, so we need to go up to find resources
-    QString appDir = QApplication::applicationDirPath();
-    QStringList iconPaths = {
-        appDir + "/../Resources/icon.png",           // macOS bundle Resources folder (primary)
-        appDir + "/../../resources/icon.png",        // macOS bundle, go up to project root
-        appDir + "/../../../resources/icon.png",      // macOS bundle, alternative path
-        QDir::currentPath() + "/resources/icon.png", // Absolute from current working dir
-        "resources/icon.png",                        // Current directory
-        "../resources/icon.png",                     // One level up
-        "../../resources/icon.png",                 // Two levels up
-    };
-    
-    for (const QString& path : iconPaths) {
-        iconPixmap = QPixmap(path);
-        if (!iconPixmap.isNull()) {
-            qDebug() << "Loaded icon from:" << path;
-            break;
-        }
-    }
-    
-    if (iconPixmap.isNull()) {
-        qDebug() << "Warning: Could not load icon.png. Tried paths:" << iconPaths;
-    }
-    
+    // Compiled in from resources/finirig.qrc, so there is no path to search
+    const QPixmap iconPixmap(":/icon.png");
     if (!iconPixmap.isNull()) {
         setWindowIcon(QIcon(iconPixmap));
     }
@@ -137,6 +151,9 @@ void MainWindow::setupUI() {
     deviceInfoWidget_ = new DeviceInfoWidget(this);
     leftLayout->addWidget(deviceInfoWidget_);
     
+    diagnosticsWidget_ = new DiagnosticsWidget(this);
+    leftLayout->addWidget(diagnosticsWidget_);
+    
     leftLayout->addStretch();
     contentLayout->addLayout(leftLayout, 2);
 
@@ -145,13 +162,26 @@ void MainWindow::setupUI() {
     auto* metersLayout = new QHBoxLayout(metersGroup);
     metersLayout->setAlignment(Qt::AlignCenter);
     
-    inputLevelMeter_ = new LevelMeterWidget("Input", this);
-    outputLevelMeter_ = new LevelMeterWidget("Output", this);
+    inputLevelMeter_ = new LevelMeterWidget("Input", 1, this);
+    outputLevelMeter_ = new LevelMeterWidget("Output", LevelMeterWidget::MAX_CHANNELS, this);
     
     metersLayout->addWidget(inputLevelMeter_);
     metersLayout->addWidget(outputLevelMeter_);
-    
-    contentLayout->addWidget(metersGroup, 1);
+
+    // Right side, below the meters: tuner and spectrum from the audio tap
+    auto* analysisGroup = new QGroupBox("Tuner && Spectrum", this);
+    auto* analysisLayout = new QVBoxLayout(analysisGroup);
+
+    tunerWidget_ = new TunerWidget(this);
+    analysisLayout->addWidget(tunerWidget_);
+
+    spectrumWidget_ = new SpectrumWidget(this);
+    analysisLayout->addWidget(spectrumWidget_, 1);
+
+    auto* rightLayout = new QVBoxLayout();
+    rightLayout->addWidget(metersGroup, 1);
+    rightLayout->addWidget(analysisGroup, 1);
+    contentLayout->addLayout(rightLayout, 1);
     
     mainLayout->addLayout(contentLayout);
 
@@ -168,19 +198,89 @@ void MainWindow::setupUI() {
         this,
         &MainWindow::onStopAudio
     );
+    connect(
+        audioControlsWidget_,
+        &AudioControlsWidget::pipelinedProcessingToggled,
+        this,
+        &MainWindow::onPipelinedProcessingToggled
+    );
+    connect(
+        tunerWidget_,
+        &TunerWidget::analysisSourceChanged,
+        this,
+        &MainWindow::onAnalysisSourceChanged
+    );
 
-    // Level meter update timer (30 FPS)
+    // Level meter update timer (30 FPS); started once the engine is ready
     levelUpdateTimer_ = new QTimer(this);
+    levelUpdateTimer_->setInterval(33); // ~30 FPS
     connect(levelUpdateTimer_, &QTimer::timeout, this, &MainWindow::updateLevelMeters);
-    levelUpdateTimer_->start(33); // ~30 FPS
+    connect(levelUpdateTimer_, &QTimer::timeout, this, &MainWindow::updateAnalysis);
+    
+    // Stage profiling refresh (2 Hz is plenty for a table of numbers)
+    diagnosticsTimer_ = new QTimer(this);
+    diagnosticsTimer_->setInterval(500);
+    connect(diagnosticsTimer_, &QTimer::timeout, this, &MainWindow::updateDiagnostics);
+
+    // Startup progress, shown until the engine is ready
+    startupProgress_ = new QProgressBar(this);
+    startupProgress_->setMaximumWidth(200);
+    startupProgress_->setTextVisible(false);
+    statusBar()->addPermanentWidget(startupProgress_);
+
+    startupPool_ = new QThreadPool(this);
 }
 
 void MainWindow::setupAudioEngine() {
-    // Initialize with default settings
-    constexpr double sampleRate = 44100.0;
-    constexpr int bufferSize = 512;
+    // The window shows straight away; opening the device and building the
+    // chain are independent, so both run side by side on the startup pool.
+    // Nothing on this thread touches the engine until both have reported
+    // back, so the controls that reach it stay disabled until then.
+    audioControlsWidget_->setEnabled(false);
+    deviceInfoWidget_->setEnabled(false);
+    tunerWidget_->setEnabled(false);
+
+    pendingStartupJobs_ = 2;
+    startupProgress_->setRange(0, pendingStartupJobs_);
+    startupProgress_->setValue(0);
+    statusBar()->showMessage("Opening audio device and loading the signal chain...");
 
-    if (!audioEngine_->initialize(sampleRate, bufferSize)) {
+    startupPool_->start([this] {
+        const bool opened = audioEngine_->initialize(DEFAULT_SAMPLE_RATE, DEFAULT_BUFFER_SIZE);
+        const qint64 doneAt = timeline_.elapsedMs();
+        QMetaObject::invokeMethod(this, [this, opened, doneAt] {
+            deviceOpened_ = opened;
+            timeline_.mark(opened ? DEVICE_OPENED : DEVICE_FAILED, doneAt);
+            onStartupJobFinished();
+        }, Qt::QueuedConnection);
+    });
+
+    startupPool_->start([this] {
+        // Handed over through the member; the queued call orders the UI
+        // thread's read after this write
+        startupChain_ = createDefaultChain();
+        const qint64 doneAt = timeline_.elapsedMs();
+        QMetaObject::invokeMethod(this, [this, doneAt] {
+            timeline_.mark(CHAIN_LOADED, doneAt);
+            onStartupJobFinished();
+        }, Qt::QueuedConnection);
+    });
+}
+
+void MainWindow::onStartupJobFinished() {
+    --pendingStartupJobs_;
+    startupProgress_->setValue(startupProgress_->maximum() - pendingStartupJobs_);
+    if (pendingStartupJobs_ > 0) {
+        return;
+    }
+
+    startupProgress_->hide();
+    audioControlsWidget_->setEnabled(true);
+    levelUpdateTimer_->start();
+    diagnosticsTimer_->start();
+
+    if (!deviceOpened_) {
+        statusBar()->showMessage("No audio device");
         QMessageBox::warning(
             this,
             "Audio Initialization Error",
@@ -189,26 +289,38 @@ void MainWindow::setupAudioEngine() {
         return;
     }
 
-    // Create a simple processing chain with an overdrive pedal
-    auto pedal = std::make_unique<finirig::pedals::OverdrivePedal>();
-    pedal->prepare(sampleRate);
-    
-    // Set processor (in a real app, you'd have a chain manager)
-    audioEngine_->setProcessor(std::move(pedal));
+    // Hand the chain to the engine (prepares it at the device sample rate)
+    signalChain_ = startupChain_.get();
+    audioEngine_->setProcessor(std::move(startupChain_));
+    diagnosticsWidget_->setSignalChain(signalChain_);
 
     // Update UI with current settings
-    audioControlsWidget_->setSampleRate(sampleRate);
-    audioControlsWidget_->setBufferSize(bufferSize);
+    audioControlsWidget_->setSampleRate(DEFAULT_SAMPLE_RATE);
+    audioControlsWidget_->setBufferSize(DEFAULT_BUFFER_SIZE);
     
-    // Setup device info widget
+    // Setup device info widget; the device catalogue scan was queued when
+    // the device opened, so the lists fill in when it finishes
+    deviceInfoWidget_->setEnabled(true);
     deviceInfoWidget_->setAudioEngine(audioEngine_.get());
-    deviceInfoWidget_->refreshDevices();
-    deviceInfoWidget_->updateDeviceInfo();
+    tunerWidget_->setEnabled(true);
+
+    const qint64 readyMs = timeline_.elapsedMs();
+    timeline_.mark(AUDIO_READY, readyMs);
+    qInfo().noquote() << "Startup timeline:\n" + timeline_.report();
+    if (readyMs > StartupTimeline::AUDIO_READY_BUDGET_MS) {
+        qWarning() << "Audio ready after" << readyMs << "ms, over the"
+                   << StartupTimeline::AUDIO_READY_BUDGET_MS << "ms startup budget";
+    }
+    statusBar()->showMessage(QString("Audio ready in %1 ms").arg(readyMs), 5000);
 }
 
 void MainWindow::onStartAudio() {
     if (audioEngine_->start()) {
         audioControlsWidget_->setAudioRunning(true);
+        if (timeline_.timeOf(AUDIO_STARTED) < 0) {
+            timeline_.mark(AUDIO_STARTED);
+            awaitingFirstAudio_ = true;
+        }
     } else {
         QMessageBox::warning(
             this,
@@ -224,10 +336,29 @@ void MainWindow::onStopAudio() {
     
     // Reset level meters
     if (inputLevelMeter_) {
-        inputLevelMeter_->setLevel(0.0f);
+        inputLevelMeter_->reset();
     }
     if (outputLevelMeter_) {
-        outputLevelMeter_->setLevel(0.0f);
+        outputLevelMeter_->reset();
+    }
+    tunerWidget_->setPitch({});
+    spectrumWidget_->clear();
+}
+
+void MainWindow::onPipelinedProcessingToggled(bool enabled) {
+    // Restarts the device callback if audio is running
+    audioEngine_->setProcessingMode(
+        enabled ? finirig::audio::AudioEngine::ProcessingMode::Pipelined
+                : finirig::audio::AudioEngine::ProcessingMode::Direct
+    );
+    deviceInfoWidget_->updateDeviceInfo();
+}
+
+void MainWindow::onAnalysisSourceChanged(finirig::audio::AudioTap::Point point) {
+    // Starts or stops the analysis thread; the audio thread only copies
+    audioEngine_->setAnalysisSource(point);
+    if (point == finirig::audio::AudioTap::Point::Off) {
+        spectrumWidget_->clear();
     }
 }
 
@@ -236,19 +367,54 @@ void MainWindow::updateLevelMeters() {
         return;
     }
     
-    float inputLevel = audioEngine_->getInputLevel();
-    float outputLevel = audioEngine_->getOutputLevel();
-    
-    if (inputLevelMeter_) {
-        inputLevelMeter_->setLevel(inputLevel);
-        inputLevelMeter_->setPeak(inputLevel);
+    // Every block since the last tick, folded into one frame per meter, so
+    // short peaks between ticks still show
+    finirig::audio::LevelMeter::Frame input;
+    if (audioEngine_->getInputMeter().drain(input) > 0 && inputLevelMeter_) {
+        const auto& levels = input.channels[0];
+        inputLevelMeter_->setLevels(0, levels.rms, levels.truePeak, levels.clipped);
+    }
+
+    finirig::audio::LevelMeter::Frame output;
+    const int outputFrames = audioEngine_->getOutputMeter().drain(output);
+    if (outputFrames > 0 && awaitingFirstAudio_) {
+        // Measured to this meter tick, so up to one timer interval late
+        awaitingFirstAudio_ = false;
+        timeline_.mark(FIRST_AUDIO);
+        qInfo() << "Launch to first audio:" << timeline_.timeOf(FIRST_AUDIO) << "ms,"
+                << timeline_.timeOf(FIRST_AUDIO) - timeline_.timeOf(AUDIO_STARTED) << "ms after start";
+    }
+    if (outputFrames > 0 && outputLevelMeter_) {
+        // One bar per output channel
+        outputLevelMeter_->setNumChannels(output.numChannels);
+        for (int channel = 0; channel < output.numChannels; ++channel) {
+            const auto& levels = output.channels[static_cast<std::size_t>(channel)];
+            outputLevelMeter_->setLevels(channel, levels.rms, levels.truePeak, levels.clipped);
+        }
     }
     
-    if (outputLevelMeter_) {
-        outputLevelMeter_->setLevel(outputLevel);
-        outputLevelMeter_->setPeak(outputLevel);
+    if (deviceInfoWidget_) {
+        deviceInfoWidget_->updateLoadInfo();
     }
 }
 
-} // namespace finirig::ui
+void MainWindow::updateAnalysis() {
+    if (!audioEngine_ || !audioEngine_->isRunning()
+        || audioEngine_->getAnalysisSource() == finirig::audio::AudioTap::Point::Off) {
+        return;
+    }
 
+    const auto results = audioEngine_->getAnalysisResults();
+    tunerWidget_->setPitch(results.pitch);
+    spectrumWidget_->setSpectrum(results.spectrumDb, results.binWidthHz);
+}
+
+void MainWindow::updateDiagnostics() {
+    if (!audioEngine_ || !diagnosticsWidget_) {
+        return;
+    }
+    
+    diagnosticsWidget_->updateStatistics(audioEngine_->getSampleRate());
+}
+
+} // namespace finirig::ui
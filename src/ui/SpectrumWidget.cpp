@@ -0,0 +1,86 @@
+#include "finirig/ui/SpectrumWidget.h"
+#include <QPainter>
+#include <QPainterPath>
+#include <QPaintEvent>
+#include <algorithm>
+#include <cmath>
+
+namespace finirig::ui {
+
+SpectrumWidget::SpectrumWidget(QWidget* parent)
+    : QWidget(parent)
+{
+    setMinimumSize(200, 120);
+}
+
+void SpectrumWidget::setSpectrum(const std::vector<float>& magnitudesDb, double binWidthHz) {
+    magnitudesDb_ = magnitudesDb;
+    binWidthHz_ = binWidthHz;
+    update();
+}
+
+void SpectrumWidget::clear() {
+    magnitudesDb_.clear();
+    update();
+}
+
+void SpectrumWidget::paintEvent(QPaintEvent* event) {
+    Q_UNUSED(event)
+
+    QPainter painter(this);
+    const QRectF area = rect();
+    painter.fillRect(area, QColor(30, 30, 30));
+
+    const double logMin = std::log10(MIN_FREQUENCY);
+    const double logRange = std::log10(MAX_FREQUENCY) - logMin;
+    auto xForFrequency = [&](double frequency) {
+        return area.width() * (std::log10(frequency) - logMin) / logRange;
+    };
+    auto yForDb = [&](float db) {
+        const float clamped = std::clamp(db, MIN_DB, MAX_DB);
+        return area.height() * (MAX_DB - clamped) / (MAX_DB - MIN_DB);
+    };
+
+    // Decade lines and 20 dB steps
+    painter.setPen(QPen(QColor(70, 70, 70), 1));
+    for (double frequency : {100.0, 1000.0, 10000.0}) {
+        const double x = xForFrequency(frequency);
+        painter.drawLine(QPointF(x, 0.0), QPointF(x, area.height()));
+    }
+    for (float db = MAX_DB - 20.0f; db > MIN_DB; db -= 20.0f) {
+        const double y = yForDb(db);
+        painter.drawLine(QPointF(0.0, y), QPointF(area.width(), y));
+    }
+
+    if (magnitudesDb_.size() < 2 || binWidthHz_ <= 0.0) {
+        return;
+    }
+
+    // One point per pixel column: the loudest bin that falls in it
+    const int numBins = static_cast<int>(magnitudesDb_.size());
+    const int width = std::max(1, static_cast<int>(area.width()));
+    QPainterPath trace;
+    for (int column = 0; column < width; ++column) {
+        const double lowFrequency = std::pow(10.0, logMin + logRange * column / width);
+        const double highFrequency = std::pow(10.0, logMin + logRange * (column + 1) / width);
+        const int firstBin = std::clamp(static_cast<int>(std::round(lowFrequency / binWidthHz_)), 1, numBins - 1);
+        const int lastBin = std::clamp(static_cast<int>(std::round(highFrequency / binWidthHz_)), firstBin, numBins - 1);
+
+        const float db = *std::max_element(
+            magnitudesDb_.begin() + firstBin,
+            magnitudesDb_.begin() + lastBin + 1
+        );
+        const QPointF point(column, yForDb(db));
+        if (column == 0) {
+            trace.moveTo(point);
+        } else {
+            trace.lineTo(point);
+        }
+    }
+
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setPen(QPen(QColor(80, 200, 255), 1.5));
+    painter.drawPath(trace);
+}
+
+} // namespace finirig::ui
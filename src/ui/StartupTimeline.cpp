@@ -0,0 +1,44 @@
+#include "finirig/ui/StartupTimeline.h"
+#include <QStringList>
+#include <algorithm>
+
+namespace finirig::ui {
+
+StartupTimeline::StartupTimeline() {
+    clock_.start();
+}
+
+void StartupTimeline::mark(const QString& stage, qint64 atMs) {
+    // Background stages arrive late; keep the list in time order
+    const auto position = std::upper_bound(
+        milestones_.begin(),
+        milestones_.end(),
+        atMs,
+        [](qint64 time, const Milestone& milestone) { return time < milestone.atMs; }
+    );
+    milestones_.insert(position, Milestone{stage, atMs});
+}
+
+qint64 StartupTimeline::timeOf(const QString& stage) const {
+    for (const auto& milestone : milestones_) {
+        if (milestone.stage == stage) {
+            return milestone.atMs;
+        }
+    }
+    return -1;
+}
+
+QString StartupTimeline::report() const {
+    QStringList lines;
+    qint64 previous = 0;
+    for (const auto& milestone : milestones_) {
+        lines << QString("%1 ms (+%2 ms)  %3")
+            .arg(milestone.atMs, 6)
+            .arg(milestone.atMs - previous, 5)
+            .arg(milestone.stage);
+        previous = milestone.atMs;
+    }
+    return lines.join('\n');
+}
+
+} // namespace finirig::ui
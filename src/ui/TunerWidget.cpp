@@ -0,0 +1,85 @@
+#include "finirig/ui/TunerWidget.h"
+#include <QComboBox>
+#include <QFormLayout>
+#include <QLabel>
+#include <QSignalBlocker>
+#include <QString>
+#include <QVBoxLayout>
+#include <cmath>
+
+namespace finirig::ui {
+
+using finirig::audio::AudioTap;
+
+TunerWidget::TunerWidget(QWidget* parent)
+    : QWidget(parent)
+{
+    setupUI();
+}
+
+void TunerWidget::setupUI() {
+    auto* layout = new QVBoxLayout(this);
+
+    // Item data holds the AudioTap::Point
+    sourceComboBox_ = new QComboBox(this);
+    sourceComboBox_->addItem("Off", static_cast<int>(AudioTap::Point::Off));
+    sourceComboBox_->addItem("Input (dry)", static_cast<int>(AudioTap::Point::Input));
+    sourceComboBox_->addItem("Output", static_cast<int>(AudioTap::Point::Output));
+    connect(
+        sourceComboBox_,
+        &QComboBox::currentIndexChanged,
+        this,
+        &TunerWidget::onSourceIndexChanged
+    );
+    auto* sourceLayout = new QFormLayout();
+    sourceLayout->addRow("Listen to:", sourceComboBox_);
+    layout->addLayout(sourceLayout);
+
+    noteLabel_ = new QLabel("--", this);
+    noteLabel_->setAlignment(Qt::AlignCenter);
+    noteLabel_->setStyleSheet("QLabel { font-size: 40px; font-weight: bold; }");
+    layout->addWidget(noteLabel_);
+
+    centsLabel_ = new QLabel(this);
+    centsLabel_->setAlignment(Qt::AlignCenter);
+    layout->addWidget(centsLabel_);
+
+    frequencyLabel_ = new QLabel(this);
+    frequencyLabel_->setAlignment(Qt::AlignCenter);
+    layout->addWidget(frequencyLabel_);
+}
+
+void TunerWidget::setPitch(const finirig::dsp::PitchDetector::Result& pitch) {
+    if (!pitch.voiced) {
+        noteLabel_->setText("--");
+        centsLabel_->clear();
+        frequencyLabel_->clear();
+        return;
+    }
+
+    const auto note = finirig::dsp::PitchDetector::toNote(pitch.frequency);
+    const int octave = note.midiNote / 12 - 1;
+    noteLabel_->setText(
+        QString("%1%2").arg(finirig::dsp::PitchDetector::getNoteName(note.midiNote)).arg(octave)
+    );
+
+    const bool inTune = std::abs(note.cents) <= IN_TUNE_CENTS;
+    centsLabel_->setText(QString("%1%2 cents").arg(note.cents >= 0.0f ? "+" : "").arg(note.cents, 0, 'f', 1));
+    centsLabel_->setStyleSheet(inTune ? "QLabel { color: #40c040; }" : "QLabel { color: #e0a020; }");
+    frequencyLabel_->setText(QString("%1 Hz").arg(pitch.frequency, 0, 'f', 1));
+}
+
+void TunerWidget::setAnalysisSource(AudioTap::Point point) {
+    const QSignalBlocker blocker(sourceComboBox_);
+    sourceComboBox_->setCurrentIndex(sourceComboBox_->findData(static_cast<int>(point)));
+}
+
+void TunerWidget::onSourceIndexChanged(int index) {
+    const auto point = static_cast<AudioTap::Point>(sourceComboBox_->itemData(index).toInt());
+    if (point == AudioTap::Point::Off) {
+        setPitch({});
+    }
+    emit analysisSourceChanged(point);
+}
+
+} // namespace finirig::ui
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <catch2/catch_test_macros.hpp>
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numbers>
+#include <vector>
+
+namespace finirig::tests {
+
+/**
+ * @brief Sine of the given frequency (pass sampleRate 1 for cycles per sample)
+ */
+inline std::vector<float> makeSine(
+    double frequency,
+    double sampleRate,
+    int numSamples,
+    float amplitude = 1.0f,
+    double phase = 0.0
+) {
+    std::vector<float> signal(static_cast<size_t>(numSamples));
+    for (int n = 0; n < numSamples; ++n) {
+        signal[static_cast<size_t>(n)] = amplitude * static_cast<float>(
+            std::sin(2.0 * std::numbers::pi * frequency * n / sampleRate + phase)
+        );
+    }
+    return signal;
+}
+
+/**
+ * @brief Run a mono signal through processChannels() in fixed-size blocks
+ */
+template <typename Processor>
+std::vector<float> process(Processor& processor, std::vector<float> signal, int blockSize = 128) {
+    const auto block = static_cast<size_t>(blockSize);
+    for (size_t offset = 0; offset < signal.size(); offset += block) {
+        float* channels[] = {signal.data() + offset};
+        processor.processChannels(channels, 1, static_cast<int>(std::min(block, signal.size() - offset)));
+    }
+    return signal;
+}
+
+/**
+ * @brief RMS of the second half, after filters and smoothing have settled
+ */
+inline float settledRms(const std::vector<float>& signal) {
+    double sum = 0.0;
+    for (size_t n = signal.size() / 2; n < signal.size(); ++n) {
+        sum += static_cast<double>(signal[n]) * signal[n];
+    }
+    return static_cast<float>(std::sqrt(sum / static_cast<double>(signal.size() - signal.size() / 2)));
+}
+
+/**
+ * @brief Write a short decaying mono IR, well off unit energy, as a 32-bit float WAV
+ */
+inline void writeImpulseResponse(const juce::File& file, double sampleRate) {
+    juce::WavAudioFormat wav;
+    std::unique_ptr<juce::AudioFormatWriter> writer(
+        wav.createWriterFor(file.createOutputStream().release(), sampleRate, 1, 32, {}, 0)
+    );
+    REQUIRE(writer != nullptr);
+
+    juce::AudioBuffer<float> buffer(1, 32);
+    for (int sample = 0; sample < 32; ++sample) {
+        buffer.setSample(0, sample, 0.5f * std::pow(0.8f, static_cast<float>(sample)));
+    }
+    REQUIRE(writer->writeFromAudioSampleBuffer(buffer, 0, 32));
+}
+
+} // namespace finirig::tests
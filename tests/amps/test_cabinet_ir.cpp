@@ -0,0 +1,200 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/amps/CabinetIR.h"
+#include "TestUtils.h"
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace finirig::amps::tests {
+
+using finirig::tests::writeImpulseResponse;
+
+namespace {
+
+std::vector<float> impulseResponseOf(CabinetIR& cabinet, int numSamples) {
+    std::vector<float> block(static_cast<size_t>(numSamples), 0.0f);
+    block[0] = 1.0f;
+    float* channels[] = {block.data()};
+    cabinet.processChannels(channels, 1, numSamples);
+    return block;
+}
+
+} // namespace
+
+TEST_CASE("CabinetIR - impulse response management", "[amps]") {
+    CabinetIR cabinet;
+
+    SECTION("Starts without an IR") {
+        REQUIRE_FALSE(cabinet.hasImpulseResponse());
+        REQUIRE(cabinet.getName() == "Cabinet IR");
+    }
+
+    SECTION("Stores an IR set from memory") {
+        const std::vector<float> ir(300, 0.01f);
+        cabinet.setImpulseResponse(ir.data(), static_cast<int>(ir.size()), 48000.0);
+        REQUIRE(cabinet.hasImpulseResponse());
+        REQUIRE(cabinet.getImpulseResponseLength() == 300);
+        REQUIRE(cabinet.getImpulseResponseSampleRate() == 48000.0);
+    }
+
+    SECTION("Can clear the IR") {
+        const std::vector<float> ir(10, 0.1f);
+        cabinet.setImpulseResponse(ir.data(), static_cast<int>(ir.size()), 48000.0);
+        cabinet.clearImpulseResponse();
+        REQUIRE_FALSE(cabinet.hasImpulseResponse());
+    }
+
+    SECTION("Missing files throw") {
+        REQUIRE_THROWS(cabinet.loadImpulseResponse(juce::File("/nonexistent/cab.wav")));
+    }
+}
+
+TEST_CASE("CabinetIR - processing", "[amps]") {
+    CabinetIR cabinet;
+    cabinet.prepare(48000.0);
+
+    std::array<float, 4> left = {1.0f, 0.0f, 0.0f, 0.0f};
+    std::array<float, 4> right{};
+    float* channels[] = {left.data(), right.data()};
+
+    SECTION("Passes through without an IR") {
+        cabinet.processChannels(channels, 2, 4);
+        REQUIRE(left[0] == 1.0f);
+        REQUIRE(cabinet.processSample(0.5f) == 0.5f);
+    }
+
+    SECTION("Impulse in gives the IR out on every channel") {
+        const std::vector<float> ir = {0.5f, 0.25f, -0.125f};
+        cabinet.setImpulseResponse(ir.data(), static_cast<int>(ir.size()), 48000.0);
+        cabinet.processChannels(channels, 2, 4);
+
+        REQUIRE(left[0] == 0.5f);
+        REQUIRE(left[1] == 0.25f);
+        REQUIRE(left[2] == -0.125f);
+        REQUIRE(left[3] == 0.0f);
+        REQUIRE(right == left);
+    }
+}
+
+TEST_CASE("CabinetIR - swapping impulse responses", "[amps]") {
+    constexpr double sampleRate = 48000.0;
+    const int fadeLength = static_cast<int>(CabinetIR::FADE_SECONDS * sampleRate);
+
+    CabinetIR cabinet;
+    cabinet.prepare(sampleRate);
+
+    // Single-tap IRs turn a constant input into their gain
+    auto processConstant = [&cabinet](int numSamples) {
+        std::vector<float> block(static_cast<size_t>(numSamples), 1.0f);
+        float* channels[] = {block.data()};
+        cabinet.processChannels(channels, 1, numSamples);
+        return block;
+    };
+
+    const float louder = 1.0f;
+    const float quieter = 0.5f;
+    cabinet.setImpulseResponse(&louder, 1, sampleRate);
+    REQUIRE(processConstant(64).back() == 1.0f);
+
+    SECTION("A new IR is crossfaded in") {
+        cabinet.setImpulseResponse(&quieter, 1, sampleRate);
+        const auto output = processConstant(fadeLength + 64);
+
+        REQUIRE(output.front() == 1.0f);
+        for (size_t n = 1; n < output.size(); ++n) {
+            REQUIRE(output[n] <= output[n - 1]);
+        }
+        REQUIRE(output[static_cast<size_t>(fadeLength / 2)] > quieter);
+        REQUIRE(output[static_cast<size_t>(fadeLength / 2)] < louder);
+        REQUIRE(output.back() == quieter);
+    }
+
+    SECTION("Clearing fades back to the dry signal") {
+        cabinet.setImpulseResponse(&quieter, 1, sampleRate);
+        (void)processConstant(fadeLength);
+        cabinet.clearImpulseResponse();
+
+        const auto output = processConstant(fadeLength + 64);
+        REQUIRE(output.front() == quieter);
+        REQUIRE(output.back() == 1.0f);
+    }
+
+    SECTION("Only the latest of several quick swaps is used") {
+        const float quietest = 0.25f;
+        cabinet.setImpulseResponse(&quieter, 1, sampleRate);
+        cabinet.setImpulseResponse(&quietest, 1, sampleRate);
+        REQUIRE(processConstant(fadeLength + 64).back() == quietest);
+    }
+}
+
+TEST_CASE("CabinetIR - background preparation", "[amps]") {
+    auto loader = std::make_shared<ImpulseResponseLoader>();
+    CabinetIR cabinet(finirig::dsp::PartitionedConvolver::DEFAULT_PARTITION_SIZE, loader);
+    cabinet.prepare(48000.0);
+
+    SECTION("A sample rate change prepares the IR again") {
+        const std::vector<float> ir(480, 0.01f);
+        cabinet.setImpulseResponse(ir.data(), static_cast<int>(ir.size()), 48000.0);
+        REQUIRE(cabinet.getImpulseResponseLength() == 480);
+
+        cabinet.prepare(96000.0);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (cabinet.getImpulseResponseLength() != 960 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        REQUIRE(cabinet.getImpulseResponseLength() == 960);
+        REQUIRE(cabinet.getImpulseResponseSampleRate() == 48000.0);
+    }
+
+    SECTION("Failed asynchronous loads report and keep the current IR") {
+        const float tap = 0.5f;
+        cabinet.setImpulseResponse(&tap, 1, 48000.0);
+
+        std::promise<bool> done;
+        cabinet.loadImpulseResponseAsync(
+            juce::File("/nonexistent/cab.wav"),
+            [&done](bool success, const juce::String&) { done.set_value(success); }
+        );
+
+        auto result = done.get_future();
+        REQUIRE(result.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+        REQUIRE_FALSE(result.get());
+        REQUIRE(cabinet.getImpulseResponseLength() == 1);
+        REQUIRE(cabinet.processSample(1.0f) == 0.5f);
+    }
+}
+
+TEST_CASE("CabinetIR - file and reader loads match", "[amps]") {
+    constexpr double sampleRate = 48000.0;
+    juce::TemporaryFile temporary(".wav");
+    writeImpulseResponse(temporary.getFile(), sampleRate);
+
+    CabinetIR fromFile;
+    fromFile.prepare(sampleRate);
+    fromFile.loadImpulseResponse(temporary.getFile());
+
+    juce::AudioFormatManager formatManager;
+    formatManager.registerBasicFormats();
+    std::unique_ptr<juce::AudioFormatReader> reader(formatManager.createReaderFor(temporary.getFile()));
+    REQUIRE(reader != nullptr);
+
+    CabinetIR fromReader;
+    fromReader.prepare(sampleRate);
+    fromReader.loadImpulseResponse(*reader);
+
+    // Both normalised to unit energy, so the same IR plays at the same level
+    const auto fileOutput = impulseResponseOf(fromFile, 64);
+    const auto readerOutput = impulseResponseOf(fromReader, 64);
+    double energy = 0.0;
+    for (size_t sample = 0; sample < fileOutput.size(); ++sample) {
+        REQUIRE(std::abs(fileOutput[sample] - readerOutput[sample]) < 1e-6f);
+        energy += static_cast<double>(readerOutput[sample]) * readerOutput[sample];
+    }
+    REQUIRE(std::abs(energy - 1.0) < 1e-3);
+}
+
+} // namespace finirig::amps::tests
@@ -0,0 +1,41 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/amps/DualCabinet.h"
+#include <array>
+#include <vector>
+
+namespace finirig::amps::tests {
+
+TEST_CASE("DualCabinet - processing", "[amps]") {
+    DualCabinet cabinet;
+    cabinet.prepare(48000.0);
+
+    REQUIRE(cabinet.getChannelLayout() == audio::AudioProcessor::ChannelLayout::Stereo);
+    REQUIRE(cabinet.getName() == "Dual Cabinet");
+
+    // Single-tap IRs with different gains on each side
+    const std::vector<float> leftIr = {0.5f};
+    const std::vector<float> rightIr = {0.25f};
+    cabinet.getLeft().setImpulseResponse(leftIr.data(), 1, 48000.0);
+    cabinet.getRight().setImpulseResponse(rightIr.data(), 1, 48000.0);
+
+    SECTION("Each side goes through its own cabinet") {
+        std::array<float, 4> left = {1.0f, 1.0f, 1.0f, 1.0f};
+        std::array<float, 4> right = left;
+        float* channels[] = {left.data(), right.data()};
+        cabinet.processChannels(channels, 2, 4);
+
+        REQUIRE(left[3] == 0.5f);
+        REQUIRE(right[3] == 0.25f);
+    }
+
+    SECTION("A single channel gets the average of both") {
+        std::vector<float> mono(600, 1.0f);
+        float* channels[] = {mono.data()};
+        cabinet.processChannels(channels, 1, static_cast<int>(mono.size()));
+
+        REQUIRE(mono[0] == 0.375f);
+        REQUIRE(mono[599] == 0.375f);
+    }
+}
+
+} // namespace finirig::amps::tests
@@ -0,0 +1,120 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/amps/ImpulseResponseLoader.h"
+#include "TestUtils.h"
+#include <chrono>
+#include <cmath>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace finirig::amps::tests {
+
+using finirig::tests::writeImpulseResponse;
+
+namespace {
+
+constexpr int PARTITION_SIZE = finirig::dsp::PartitionedConvolver::DEFAULT_PARTITION_SIZE;
+
+double energyOf(const ImpulseResponseLoader::Prepared& prepared) {
+    // The head holds the first partition, reversed; enough for short IRs
+    double energy = 0.0;
+    for (float tap : prepared.kernel->head) {
+        energy += static_cast<double>(tap) * tap;
+    }
+    return energy;
+}
+
+} // namespace
+
+TEST_CASE("ImpulseResponseLoader - prepare", "[amps]") {
+    const std::vector<float> ir = {0.5f, 0.25f, 0.125f};
+
+    SECTION("Keeps the IR at its own rate") {
+        const auto prepared = ImpulseResponseLoader::prepare(ir.data(), 3, 48000.0, 48000.0, PARTITION_SIZE, false);
+        REQUIRE(prepared->kernel->length == 3);
+        REQUIRE(prepared->sampleRate == 48000.0);
+        REQUIRE(prepared->kernel->head[PARTITION_SIZE - 1] == 0.5f);
+    }
+
+    SECTION("An unknown target rate keeps the recorded rate") {
+        const auto prepared = ImpulseResponseLoader::prepare(ir.data(), 3, 44100.0, 0.0, PARTITION_SIZE, false);
+        REQUIRE(prepared->sampleRate == 44100.0);
+        REQUIRE(prepared->kernel->length == 3);
+    }
+
+    SECTION("Resamples to the target rate") {
+        const std::vector<float> longer(441, 0.01f);
+        const auto prepared = ImpulseResponseLoader::prepare(
+            longer.data(), 441, 44100.0, 48000.0, PARTITION_SIZE, false
+        );
+        REQUIRE(prepared->kernel->length == 480);
+        REQUIRE(prepared->sourceSampleRate == 44100.0);
+        REQUIRE(prepared->sampleRate == 48000.0);
+    }
+
+    SECTION("Normalises to unit energy") {
+        const auto prepared = ImpulseResponseLoader::prepare(ir.data(), 3, 48000.0, 48000.0, PARTITION_SIZE, true);
+        REQUIRE(std::abs(energyOf(*prepared) - 1.0) < 1e-6);
+    }
+}
+
+TEST_CASE("ImpulseResponseLoader - files", "[amps]") {
+    ImpulseResponseLoader loader;
+
+    SECTION("Missing files throw") {
+        REQUIRE_THROWS_AS(
+            loader.load(juce::File("/nonexistent/cab.wav"), 48000.0, PARTITION_SIZE),
+            std::runtime_error
+        );
+        REQUIRE(loader.getCacheSize() == 0);
+    }
+
+    SECTION("Asynchronous loads report errors") {
+        std::promise<juce::String> done;
+        loader.loadAsync(
+            juce::File("/nonexistent/cab.wav"),
+            48000.0,
+            PARTITION_SIZE,
+            [&done](std::shared_ptr<const ImpulseResponseLoader::Prepared> prepared, const juce::String& error) {
+                // Assertions stay on the test thread
+                done.set_value(prepared == nullptr ? error : juce::String());
+            }
+        );
+
+        auto error = done.get_future();
+        REQUIRE(error.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+        REQUIRE(error.get().isNotEmpty());
+    }
+
+    SECTION("Prepared files are cached per sample rate") {
+        juce::TemporaryFile temporary(".wav");
+        writeImpulseResponse(temporary.getFile(), 44100.0);
+
+        const auto first = loader.load(temporary.getFile(), 48000.0, PARTITION_SIZE);
+        REQUIRE(first->sourceSampleRate == 44100.0);
+        REQUIRE(std::abs(energyOf(*first) - 1.0) < 1e-3);
+        REQUIRE(loader.load(temporary.getFile(), 48000.0, PARTITION_SIZE) == first);
+        REQUIRE(loader.getCacheSize() == 1);
+
+        std::promise<std::shared_ptr<const ImpulseResponseLoader::Prepared>> done;
+        loader.loadAsync(
+            temporary.getFile(),
+            96000.0,
+            PARTITION_SIZE,
+            [&done](std::shared_ptr<const ImpulseResponseLoader::Prepared> prepared, const juce::String&) {
+                done.set_value(std::move(prepared));
+            }
+        );
+
+        auto result = done.get_future();
+        REQUIRE(result.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+        REQUIRE(result.get()->sampleRate == 96000.0);
+        REQUIRE(loader.getCacheSize() == 2);
+
+        loader.clearCache();
+        REQUIRE(loader.getCacheSize() == 0);
+    }
+}
+
+} // namespace finirig::amps::tests
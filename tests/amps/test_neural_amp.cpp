@@ -0,0 +1,180 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/amps/NeuralAmp.h"
+#include "TestUtils.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace finirig::amps::tests {
+
+using finirig::tests::makeSine;
+using finirig::tests::process;
+
+namespace {
+
+constexpr double SAMPLE_RATE = 48000.0;
+
+// Small GRU whose output follows its input closely
+NeuralNetwork::Weights makeWeights(int hiddenSize) {
+    const auto hidden = static_cast<size_t>(hiddenSize);
+    const auto rows = 3 * hidden;
+
+    NeuralNetwork::Weights weights;
+    weights.cellType = NeuralNetwork::CellType::Gru;
+    weights.hiddenSize = hiddenSize;
+    weights.inputWeights.assign(rows, 0.5f);
+    weights.recurrentWeights.assign(rows * hidden, 0.0f);
+    weights.inputBias.assign(rows, 0.0f);
+    weights.recurrentBias.assign(rows, 0.0f);
+    weights.outputWeights.assign(hidden, 1.0f / static_cast<float>(hiddenSize));
+    weights.skip = true;
+    weights.sampleRate = SAMPLE_RATE;
+
+    // Update gate fully closed: h = tanh(0.5 x), so y = x + tanh(0.5 x)
+    for (size_t i = hidden; i < 2 * hidden; ++i) {
+        weights.inputWeights[i] = 0.0f;
+        weights.inputBias[i] = -20.0f;
+    }
+    return weights;
+}
+
+} // namespace
+
+TEST_CASE("NeuralAmp - models", "[amps]") {
+    NeuralAmp amp;
+    amp.prepare(SAMPLE_RATE);
+
+    SECTION("Passes audio through without a model") {
+        REQUIRE_FALSE(amp.hasModel());
+        REQUIRE(amp.getHiddenSize() == 0);
+        REQUIRE(amp.getName() == "Neural Amp");
+
+        const auto input = makeSine(220.0, SAMPLE_RATE, 512, 0.5f);
+        REQUIRE(process(amp, input) == input);
+    }
+
+    SECTION("Runs an installed model") {
+        amp.setModel(makeWeights(8));
+        REQUIRE(amp.hasModel());
+        REQUIRE(amp.getHiddenSize() == 8);
+        REQUIRE(amp.getModelSampleRate() == SAMPLE_RATE);
+
+        const auto input = makeSine(220.0, SAMPLE_RATE, 512, 0.5f);
+        const auto output = process(amp, input);
+        for (size_t n = 0; n < input.size(); ++n) {
+            REQUIRE(std::abs(output[n] - (input[n] + std::tanh(0.5f * input[n]))) < 1e-4f);
+        }
+    }
+
+    SECTION("Clearing the model restores pass-through") {
+        amp.setModel(makeWeights(8));
+        amp.clearModel();
+        REQUIRE_FALSE(amp.hasModel());
+
+        const auto input = makeSine(220.0, SAMPLE_RATE, 256, 0.5f);
+        REQUIRE(process(amp, input) == input);
+    }
+
+    SECTION("Rejects bad models and keeps the current one") {
+        amp.setModel(makeWeights(16));
+        REQUIRE_THROWS_AS(amp.loadModelFromJson("{}"), std::runtime_error);
+        REQUIRE_THROWS_AS(amp.loadModel(juce::File("/nonexistent/model.json")), std::runtime_error);
+        REQUIRE_THROWS_AS(amp.setModel(makeWeights(10)), std::invalid_argument);
+        REQUIRE(amp.getHiddenSize() == 16);
+    }
+
+    SECTION("Reset clears the hidden state") {
+        // Half-open update gate, so the state carries over between samples
+        auto weights = makeWeights(8);
+        std::fill(weights.inputBias.begin() + 8, weights.inputBias.begin() + 16, 0.0f);
+        amp.setModel(weights);
+
+        const std::vector<float> silence(256, 0.0f);
+        process(amp, makeSine(220.0, SAMPLE_RATE, 100, 0.5f));
+        REQUIRE(process(amp, silence)[0] != 0.0f);
+
+        process(amp, makeSine(220.0, SAMPLE_RATE, 100, 0.5f));
+        amp.reset();
+        REQUIRE(process(amp, silence) == silence);
+    }
+
+    SECTION("Can be reset while audio runs") {
+        amp.setModel(makeWeights(8));
+
+        std::atomic<bool> running{true};
+        std::thread audio([&] {
+            std::vector<float> block(64, 0.25f);
+            float* channels[] = {block.data()};
+            while (running.load()) {
+                amp.processChannels(channels, 1, 64);
+            }
+        });
+
+        for (int i = 0; i < 1000; ++i) {
+            amp.reset();
+        }
+
+        running = false;
+        audio.join();
+        REQUIRE(amp.hasModel());
+    }
+
+    SECTION("Models can be swapped while audio runs") {
+        std::atomic<bool> running{true};
+        std::thread audio([&] {
+            std::vector<float> block(64, 0.25f);
+            float* channels[] = {block.data()};
+            while (running.load()) {
+                amp.processChannels(channels, 1, 64);
+            }
+        });
+
+        for (int i = 0; i < 50; ++i) {
+            amp.setModel(makeWeights(i % 2 == 0 ? 8 : 24));
+        }
+        amp.clearModel();
+
+        running = false;
+        audio.join();
+        REQUIRE_FALSE(amp.hasModel());
+    }
+}
+
+TEST_CASE("NeuralAmp - gain staging", "[amps]") {
+    NeuralAmp amp;
+    amp.prepare(SAMPLE_RATE);
+    amp.setModel(makeWeights(8));
+    const auto input = makeSine(220.0, SAMPLE_RATE, 4800, 0.1f);
+
+    SECTION("Master scales the output") {
+        const auto unity = process(amp, input);
+
+        amp.setMasterVolume(0.25f);
+        amp.reset();
+        const auto half = process(amp, input);
+        for (size_t n = 0; n < input.size(); ++n) {
+            REQUIRE(std::abs(half[n] - 0.5f * unity[n]) < 1e-5f);
+        }
+    }
+
+    SECTION("Zero master volume mutes the amp") {
+        amp.setMasterVolume(0.0f);
+        amp.reset();
+        for (float sample : process(amp, input)) {
+            REQUIRE(sample == 0.0f);
+        }
+    }
+
+    SECTION("Copies the processed signal to every channel") {
+        auto left = input;
+        std::vector<float> right(input.size(), 0.0f);
+        float* channels[] = {left.data(), right.data()};
+        amp.processChannels(channels, 2, static_cast<int>(input.size()));
+        REQUIRE(left == right);
+    }
+}
+
+} // namespace finirig::amps::tests
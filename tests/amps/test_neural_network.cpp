@@ -0,0 +1,237 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/amps/NeuralNetwork.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace finirig::amps::tests {
+
+namespace {
+
+using CellType = NeuralNetwork::CellType;
+
+std::vector<float> randomValues(std::mt19937& rng, size_t count, float scale) {
+    std::uniform_real_distribution<float> distribution(-scale, scale);
+    std::vector<float> values(count);
+    for (auto& value : values) {
+        value = distribution(rng);
+    }
+    return values;
+}
+
+NeuralNetwork::Weights makeWeights(CellType cellType, int hiddenSize, bool skip) {
+    std::mt19937 rng(1234);
+    const auto hidden = static_cast<size_t>(hiddenSize);
+    const auto rows = static_cast<size_t>(NeuralNetwork::getNumGates(cellType)) * hidden;
+    const float scale = 1.0f / std::sqrt(static_cast<float>(hiddenSize));
+
+    NeuralNetwork::Weights weights;
+    weights.cellType = cellType;
+    weights.hiddenSize = hiddenSize;
+    weights.inputWeights = randomValues(rng, rows, 1.0f);
+    weights.recurrentWeights = randomValues(rng, rows * hidden, scale);
+    weights.inputBias = randomValues(rng, rows, scale);
+    weights.recurrentBias = randomValues(rng, rows, scale);
+    weights.outputWeights = randomValues(rng, hidden, scale);
+    weights.outputBias = 0.01f;
+    weights.skip = skip;
+    return weights;
+}
+
+double sigmoid(double x) {
+    return 1.0 / (1.0 + std::exp(-x));
+}
+
+// Straightforward double precision version of torch.nn.LSTM / GRU + Linear
+std::vector<float> referenceProcess(const NeuralNetwork::Weights& weights, const std::vector<float>& input) {
+    const auto hidden = static_cast<size_t>(weights.hiddenSize);
+    const auto gates = static_cast<size_t>(NeuralNetwork::getNumGates(weights.cellType));
+    std::vector<double> h(hidden, 0.0), c(hidden, 0.0);
+    std::vector<double> ih(gates * hidden), hh(gates * hidden);
+    std::vector<float> output;
+
+    for (float x : input) {
+        for (size_t row = 0; row < gates * hidden; ++row) {
+            ih[row] = weights.inputWeights[row] * static_cast<double>(x) + weights.inputBias[row];
+            hh[row] = weights.recurrentBias[row];
+            for (size_t col = 0; col < hidden; ++col) {
+                hh[row] += weights.recurrentWeights[row * hidden + col] * h[col];
+            }
+        }
+
+        for (size_t i = 0; i < hidden; ++i) {
+            if (weights.cellType == CellType::Lstm) {
+                const double inputGate = sigmoid(ih[i] + hh[i]);
+                const double forgetGate = sigmoid(ih[hidden + i] + hh[hidden + i]);
+                const double candidate = std::tanh(ih[2 * hidden + i] + hh[2 * hidden + i]);
+                const double outputGate = sigmoid(ih[3 * hidden + i] + hh[3 * hidden + i]);
+                c[i] = forgetGate * c[i] + inputGate * candidate;
+                h[i] = outputGate * std::tanh(c[i]);
+            } else {
+                const double resetGate = sigmoid(ih[i] + hh[i]);
+                const double updateGate = sigmoid(ih[hidden + i] + hh[hidden + i]);
+                const double candidate = std::tanh(ih[2 * hidden + i] + resetGate * hh[2 * hidden + i]);
+                h[i] = (1.0 - updateGate) * candidate + updateGate * h[i];
+            }
+        }
+
+        double y = weights.outputBias;
+        for (size_t i = 0; i < hidden; ++i) {
+            y += weights.outputWeights[i] * h[i];
+        }
+        output.push_back(static_cast<float>(weights.skip ? y + x : y));
+    }
+    return output;
+}
+
+std::vector<float> makeInput(int numSamples) {
+    std::vector<float> input(static_cast<size_t>(numSamples));
+    for (int n = 0; n < numSamples; ++n) {
+        input[static_cast<size_t>(n)] = 0.8f * static_cast<float>(std::sin(0.05 * n) + 0.3 * std::sin(0.31 * n));
+    }
+    return input;
+}
+
+float maxDifference(const std::vector<float>& a, const std::vector<float>& b) {
+    float difference = 0.0f;
+    for (size_t n = 0; n < a.size(); ++n) {
+        difference = std::max(difference, std::abs(a[n] - b[n]));
+    }
+    return difference;
+}
+
+std::string toJsonArray(const std::vector<float>& values, size_t rowLength) {
+    std::string json = "[";
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (rowLength > 0 && i % rowLength == 0) {
+            json += (i == 0 ? "[" : "],[");
+        } else if (i > 0) {
+            json += ",";
+        }
+        json += std::to_string(values[i]);
+    }
+    json += rowLength > 0 ? "]]" : "]";
+    return json;
+}
+
+// Same layout as the PyTorch capture trainers export
+std::string toJson(const NeuralNetwork::Weights& weights) {
+    const auto hidden = static_cast<size_t>(weights.hiddenSize);
+    return std::string("{\"model_data\":{")
+        + "\"unit_type\":\"" + (weights.cellType == CellType::Lstm ? "LSTM" : "GRU") + "\","
+        + "\"input_size\":1,\"output_size\":1,\"num_layers\":1,"
+        + "\"hidden_size\":" + std::to_string(weights.hiddenSize) + ","
+        + "\"skip\":" + (weights.skip ? "1" : "0") + ","
+        + "\"sample_rate\":44100},"
+        + "\"state_dict\":{"
+        + "\"rec.weight_ih_l0\":" + toJsonArray(weights.inputWeights, 1) + ","
+        + "\"rec.weight_hh_l0\":" + toJsonArray(weights.recurrentWeights, hidden) + ","
+        + "\"rec.bias_ih_l0\":" + toJsonArray(weights.inputBias, 0) + ","
+        + "\"rec.bias_hh_l0\":" + toJsonArray(weights.recurrentBias, 0) + ","
+        + "\"lin.weight\":" + toJsonArray(weights.outputWeights, hidden) + ","
+        + "\"lin.bias\":[" + std::to_string(weights.outputBias) + "]}}";
+}
+
+} // namespace
+
+TEST_CASE("NeuralNetwork - inference", "[amps]") {
+    const auto input = makeInput(2048);
+
+    SECTION("LSTM matches the reference") {
+        for (int hiddenSize : {8, 20, 40}) {
+            const auto weights = makeWeights(CellType::Lstm, hiddenSize, false);
+            auto network = NeuralNetwork::create(weights);
+            REQUIRE(network->getCellType() == CellType::Lstm);
+            REQUIRE(network->getHiddenSize() == hiddenSize);
+
+            auto output = input;
+            network->process(output.data(), static_cast<int>(output.size()));
+            REQUIRE(maxDifference(output, referenceProcess(weights, input)) < 1e-4f);
+        }
+    }
+
+    SECTION("GRU matches the reference") {
+        for (int hiddenSize : {8, 12, 32}) {
+            const auto weights = makeWeights(CellType::Gru, hiddenSize, true);
+            auto network = NeuralNetwork::create(weights);
+            REQUIRE(network->getCellType() == CellType::Gru);
+
+            auto output = input;
+            network->process(output.data(), static_cast<int>(output.size()));
+            REQUIRE(maxDifference(output, referenceProcess(weights, input)) < 1e-4f);
+        }
+    }
+
+    SECTION("Block size does not change the output") {
+        auto network = NeuralNetwork::create(makeWeights(CellType::Lstm, 16, true));
+        auto whole = input;
+        network->process(whole.data(), static_cast<int>(whole.size()));
+
+        network->reset();
+        auto pieces = input;
+        for (size_t offset = 0; offset < pieces.size(); offset += 7) {
+            const auto count = std::min<size_t>(7, pieces.size() - offset);
+            network->process(pieces.data() + offset, static_cast<int>(count));
+        }
+        REQUIRE(pieces == whole);
+    }
+
+    SECTION("Reset clears the state") {
+        auto network = NeuralNetwork::create(makeWeights(CellType::Gru, 16, false));
+        auto first = input;
+        network->process(first.data(), static_cast<int>(first.size()));
+
+        network->reset();
+        auto second = input;
+        network->process(second.data(), static_cast<int>(second.size()));
+        REQUIRE(first == second);
+    }
+}
+
+TEST_CASE("NeuralNetwork - construction", "[amps]") {
+    SECTION("Rejects unsupported hidden sizes") {
+        REQUIRE_THROWS_AS(NeuralNetwork::create(makeWeights(CellType::Lstm, 10, false)), std::invalid_argument);
+        REQUIRE_THROWS_AS(NeuralNetwork::create(makeWeights(CellType::Gru, 128, false)), std::invalid_argument);
+    }
+
+    SECTION("Rejects mismatched weights") {
+        auto weights = makeWeights(CellType::Lstm, 16, false);
+        weights.recurrentWeights.pop_back();
+        REQUIRE_THROWS_AS(NeuralNetwork::create(weights), std::invalid_argument);
+    }
+
+    SECTION("Parses the exported JSON layout") {
+        for (auto cellType : {CellType::Lstm, CellType::Gru}) {
+            const auto weights = makeWeights(cellType, 12, true);
+            const auto parsed = NeuralNetwork::parseJson(toJson(weights));
+
+            REQUIRE(parsed.cellType == cellType);
+            REQUIRE(parsed.hiddenSize == 12);
+            REQUIRE(parsed.skip);
+            REQUIRE(parsed.sampleRate == 44100.0);
+            REQUIRE(parsed.recurrentWeights.size() == weights.recurrentWeights.size());
+            REQUIRE(maxDifference(parsed.recurrentWeights, weights.recurrentWeights) < 1e-5f);
+            REQUIRE(maxDifference(parsed.outputWeights, weights.outputWeights) < 1e-5f);
+        }
+    }
+
+    SECTION("Rejects malformed or unsupported JSON") {
+        REQUIRE_THROWS_AS(NeuralNetwork::parseJson("not json"), std::runtime_error);
+        REQUIRE_THROWS_AS(NeuralNetwork::parseJson("{\"model_data\":{}}"), std::runtime_error);
+
+        auto json = toJson(makeWeights(CellType::Lstm, 8, false));
+        const auto wavenet = juce::String(json).replace("\"LSTM\"", "\"WaveNet\"");
+        REQUIRE_THROWS_AS(NeuralNetwork::parseJson(wavenet), std::runtime_error);
+
+        const auto stacked = juce::String(json).replace("\"num_layers\":1", "\"num_layers\":2");
+        REQUIRE_THROWS_AS(NeuralNetwork::parseJson(stacked), std::runtime_error);
+
+        const auto wrongSize = juce::String(json).replace("\"hidden_size\":8", "\"hidden_size\":12");
+        REQUIRE_THROWS_AS(NeuralNetwork::parseJson(wrongSize), std::runtime_error);
+    }
+}
+
+} // namespace finirig::amps::tests
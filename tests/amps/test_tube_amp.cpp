@@ -0,0 +1,118 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/amps/TubeAmp.h"
+#include "TestUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace finirig::amps::tests {
+
+using finirig::tests::makeSine;
+using finirig::tests::process;
+using finirig::tests::settledRms;
+
+namespace {
+
+constexpr double SAMPLE_RATE = 48000.0;
+
+} // namespace
+
+TEST_CASE("TubeAmp - controls", "[amps]") {
+    TubeAmp amp;
+
+    SECTION("Implements the AmpModel interface") {
+        amp.setGain(0.8f);
+        amp.setMasterVolume(0.3f);
+        REQUIRE(amp.getGain() == 0.8f);
+        REQUIRE(amp.getMasterVolume() == 0.3f);
+        REQUIRE(amp.getName() == "Tube Amp");
+    }
+
+    SECTION("Clamps the tone stack and sag") {
+        amp.setBass(2.0f);
+        amp.setMiddle(-1.0f);
+        amp.setTreble(0.25f);
+        amp.setSag(1.5f);
+        REQUIRE(amp.getBass() == 1.0f);
+        REQUIRE(amp.getMiddle() == 0.0f);
+        REQUIRE(amp.getTreble() == 0.25f);
+        REQUIRE(amp.getSag() == 1.0f);
+    }
+
+    SECTION("Reports the oversampler latency") {
+        amp.prepare(SAMPLE_RATE);
+        REQUIRE(amp.getLatencySamples() > 0);
+    }
+}
+
+TEST_CASE("TubeAmp - processing", "[amps]") {
+    TubeAmp amp;
+    amp.prepare(SAMPLE_RATE);
+
+    SECTION("Silence stays silent") {
+        const auto output = process(amp, std::vector<float>(1024, 0.0f));
+        for (float sample : output) {
+            REQUIRE(sample == 0.0f);
+        }
+    }
+
+    SECTION("Output stays bounded for very hot input") {
+        amp.setGain(1.0f);
+        amp.setMasterVolume(1.0f);
+        const auto output = process(amp, makeSine(110.0, SAMPLE_RATE, 9600, 10.0f));
+        for (float sample : output) {
+            REQUIRE(std::isfinite(sample));
+            REQUIRE(std::abs(sample) < 1.2f);
+        }
+    }
+
+    SECTION("More gain gives a louder signal") {
+        const auto input = makeSine(220.0, SAMPLE_RATE, 9600, 0.05f);
+
+        amp.setGain(0.1f);
+        amp.reset();
+        const float low = settledRms(process(amp, input));
+
+        amp.setGain(0.9f);
+        amp.reset();
+        const float high = settledRms(process(amp, input));
+
+        REQUIRE(high > low);
+    }
+
+    SECTION("Zero master volume mutes the amp") {
+        amp.setMasterVolume(0.0f);
+        amp.reset();
+        const auto output = process(amp, makeSine(220.0, SAMPLE_RATE, 4800, 0.5f));
+        REQUIRE(settledRms(output) < 1e-6f);
+    }
+
+    SECTION("Treble control shapes the top end") {
+        // Low gain keeps the preamp nearly linear
+        amp.setGain(0.0f);
+        const auto input = makeSine(6000.0, SAMPLE_RATE, 9600, 0.01f);
+
+        amp.setTreble(0.0f);
+        amp.reset();
+        const float dark = settledRms(process(amp, input));
+
+        amp.setTreble(1.0f);
+        amp.reset();
+        const float bright = settledRms(process(amp, input));
+
+        REQUIRE(bright > 2.0f * dark);
+    }
+
+    SECTION("Single samples match block processing") {
+        const auto input = makeSine(440.0, SAMPLE_RATE, 256, 0.3f);
+        const auto blockOutput = process(amp, input);
+
+        TubeAmp other;
+        other.prepare(SAMPLE_RATE);
+        for (size_t n = 0; n < input.size(); ++n) {
+            REQUIRE(other.processSample(input[n]) == blockOutput[n]);
+        }
+    }
+}
+
+} // namespace finirig::amps::tests
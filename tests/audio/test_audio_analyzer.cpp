@@ -0,0 +1,82 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "finirig/audio/AudioAnalyzer.h"
+#include <chrono>
+#include <cmath>
+#include <numbers>
+#include <thread>
+#include <vector>
+
+namespace finirig::audio::tests {
+
+using Catch::Matchers::WithinAbs;
+
+TEST_CASE("AudioAnalyzer - background analysis of the tap", "[audio]") {
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 256;
+    AudioTap tap;
+    AudioAnalyzer analyzer(tap);
+
+    SECTION("Publishes pitch and spectrum from a separate thread") {
+        analyzer.start(sampleRate);
+        REQUIRE(analyzer.isRunning());
+
+        // Stand in for the callback: half a second of A2, block by block
+        std::vector<float> block(blockSize);
+        int position = 0;
+        for (int blockIndex = 0; blockIndex < static_cast<int>(sampleRate) / 2 / blockSize; ++blockIndex) {
+            for (auto& sample : block) {
+                sample = 0.5f * static_cast<float>(std::sin(2.0 * std::numbers::pi * 110.0 * position++ / sampleRate));
+            }
+            tap.push(block.data(), blockSize);
+        }
+
+        auto results = analyzer.getResults();
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!results.pitch.voiced && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            results = analyzer.getResults();
+        }
+
+        REQUIRE(results.pitch.voiced);
+        REQUIRE_THAT(results.pitch.frequency, WithinAbs(110.0, 0.5));
+        REQUIRE(results.binWidthHz > 0.0);
+        REQUIRE_FALSE(results.spectrumDb.empty());
+        REQUIRE(results.droppedSamples == 0);
+
+        analyzer.stop();
+        REQUIRE_FALSE(analyzer.isRunning());
+    }
+
+    SECTION("Restarting discards stale samples and results") {
+        std::vector<float> block(blockSize, 0.25f);
+        tap.push(block.data(), blockSize);
+        analyzer.start(sampleRate);
+        analyzer.start(sampleRate);
+
+        const auto results = analyzer.getResults();
+        REQUIRE_FALSE(results.pitch.voiced);
+        std::vector<float> out(blockSize);
+        analyzer.stop();
+        REQUIRE(tap.pull(out.data(), out.size()) == 0);
+    }
+
+    SECTION("Start and stop may come from two threads at once") {
+        // As the UI and the device thread do when the device restarts
+        std::thread device([&] {
+            for (int i = 0; i < 50; ++i) {
+                analyzer.start(sampleRate);
+                analyzer.stop();
+            }
+        });
+        for (int i = 0; i < 50; ++i) {
+            analyzer.start(sampleRate);
+        }
+        device.join();
+
+        analyzer.stop();
+        REQUIRE_FALSE(analyzer.isRunning());
+    }
+}
+
+} // namespace finirig::audio::tests
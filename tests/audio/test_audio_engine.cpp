@@ -0,0 +1,146 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/audio/AudioEngine.h"
+#include "finirig/audio/BlockProcessor.h"
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace finirig::audio::tests {
+
+namespace {
+
+constexpr int NUM_SAMPLES = 64;
+constexpr int NUM_OUTPUTS = 4;
+
+// Mono gain; stereo mode also negates the right channel
+class TestProcessor : public BlockProcessor<> {
+public:
+    TestProcessor(float gain, ChannelLayout layout) : gain_(gain), layout_(layout) {}
+
+    void processChannels(float* const* channelData, int numChannels, int numSamples) noexcept override {
+        lastNumChannels = numChannels;
+        for (int channel = 0; channel < numChannels; ++channel) {
+            const float gain = channel == 1 ? -gain_ : gain_;
+            for (int sample = 0; sample < numSamples; ++sample) {
+                channelData[channel][sample] *= gain;
+            }
+        }
+        if (layout_ == ChannelLayout::Mono) {
+            for (int channel = 1; channel < numChannels; ++channel) {
+                std::copy(channelData[0], channelData[0] + numSamples, channelData[channel]);
+            }
+        }
+    }
+
+    [[nodiscard]] ChannelLayout getChannelLayout() const noexcept override { return layout_; }
+
+    int lastNumChannels = 0;
+
+private:
+    float gain_;
+    ChannelLayout layout_;
+};
+
+// Device buffers: NUM_OUTPUTS output channels full of stale data, and an
+// input that is either its own buffer or the first output (as many
+// drivers hand it over)
+struct DeviceBuffers {
+    std::array<std::vector<float>, NUM_OUTPUTS> outputs;
+    std::vector<float> separateInput;
+    std::array<float*, NUM_OUTPUTS> outputPointers{};
+    const float* inputPointer = nullptr;
+
+    explicit DeviceBuffers(bool aliased) : separateInput(NUM_SAMPLES) {
+        for (size_t channel = 0; channel < outputs.size(); ++channel) {
+            outputs[channel].assign(NUM_SAMPLES, 9.0f);
+            outputPointers[channel] = outputs[channel].data();
+        }
+
+        float* input = aliased ? outputs[0].data() : separateInput.data();
+        for (int sample = 0; sample < NUM_SAMPLES; ++sample) {
+            input[sample] = inputAt(sample);
+        }
+        inputPointer = input;
+    }
+
+    static float inputAt(int sample) { return 0.01f * static_cast<float>(sample); }
+
+    void runCallback(AudioEngine& engine) {
+        engine.audioDeviceIOCallbackWithContext(
+            &inputPointer, 1, outputPointers.data(), NUM_OUTPUTS, NUM_SAMPLES, {}
+        );
+    }
+
+    // The pair carries the scaled input, the input is intact and every
+    // channel past the pair is silent
+    void requireOutputs(float leftGain, float rightGain) const {
+        for (int sample = 0; sample < NUM_SAMPLES; ++sample) {
+            const auto index = static_cast<size_t>(sample);
+            REQUIRE(outputs[0][index] == leftGain * inputAt(sample));
+            REQUIRE(outputs[1][index] == rightGain * inputAt(sample));
+            if (inputPointer == separateInput.data()) {
+                REQUIRE(separateInput[index] == inputAt(sample));
+            }
+        }
+        for (size_t channel = 2; channel < NUM_OUTPUTS; ++channel) {
+            for (float sample : outputs[channel]) {
+                REQUIRE(sample == 0.0f);
+            }
+        }
+    }
+};
+
+} // namespace
+
+TEST_CASE("AudioEngine - device callback", "[audio]") {
+    AudioEngine engine;
+
+    SECTION("Without a processor the input passes through") {
+        for (const bool aliased : {false, true}) {
+            DeviceBuffers buffers(aliased);
+            buffers.runCallback(engine);
+            buffers.requireOutputs(1.0f, 1.0f);
+        }
+    }
+
+    SECTION("Mono processors run once and are copied to the pair") {
+        auto processor = std::make_unique<TestProcessor>(2.0f, AudioProcessor::ChannelLayout::Mono);
+        auto* mono = processor.get();
+        engine.setProcessor(std::move(processor));
+
+        for (const bool aliased : {false, true}) {
+            DeviceBuffers buffers(aliased);
+            buffers.runCallback(engine);
+            REQUIRE(mono->lastNumChannels == 1);
+            buffers.requireOutputs(2.0f, 2.0f);
+        }
+    }
+
+    SECTION("Stereo processors get the input on both sides") {
+        auto processor = std::make_unique<TestProcessor>(2.0f, AudioProcessor::ChannelLayout::Stereo);
+        auto* stereo = processor.get();
+        engine.setProcessor(std::move(processor));
+
+        for (const bool aliased : {false, true}) {
+            DeviceBuffers buffers(aliased);
+            buffers.runCallback(engine);
+            REQUIRE(stereo->lastNumChannels == 2);
+            buffers.requireOutputs(2.0f, -2.0f);
+        }
+    }
+
+    SECTION("No input silences every output") {
+        DeviceBuffers buffers(false);
+        engine.audioDeviceIOCallbackWithContext(
+            nullptr, 0, buffers.outputPointers.data(), NUM_OUTPUTS, NUM_SAMPLES, {}
+        );
+        for (const auto& output : buffers.outputs) {
+            for (float sample : output) {
+                REQUIRE(sample == 0.0f);
+            }
+        }
+    }
+}
+
+} // namespace finirig::audio::tests
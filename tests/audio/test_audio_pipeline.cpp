@@ -0,0 +1,190 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/audio/AudioPipeline.h"
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace finirig::audio::tests {
+
+namespace {
+
+// Doubles the signal (negated on the right); can be held to simulate a
+// block that overruns
+class DoublingStage : public AudioPipeline::Stage {
+public:
+    void processPipelineBlock(float* const* channelData, int numChannels, int numSamples) noexcept override {
+        while (held.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+        for (int i = 0; i < numSamples; ++i) {
+            channelData[0][i] *= 2.0f;
+            if (numChannels > 1) {
+                channelData[1][i] = -channelData[0][i];
+            }
+        }
+        processedSamples.fetch_add(numSamples, std::memory_order_release);
+    }
+
+    void waitForSamples(int count) const {
+        while (processedSamples.load(std::memory_order_acquire) < count) {
+            std::this_thread::yield();
+        }
+    }
+
+    std::atomic<bool> held{false};
+    std::atomic<int> processedSamples{0};
+};
+
+std::vector<float> makeBlock(int blockSize, float value) {
+    return std::vector<float>(static_cast<size_t>(blockSize), value);
+}
+
+// One mono callback, processed in place
+void processMono(AudioPipeline& pipeline, std::vector<float>& block) {
+    float* outputs[] = {block.data()};
+    pipeline.process(block.data(), outputs, 1, static_cast<int>(block.size()));
+}
+
+} // namespace
+
+TEST_CASE("AudioPipeline - one block of latency", "[audio]") {
+    constexpr int blockSize = 64;
+    DoublingStage stage;
+    AudioPipeline pipeline(stage);
+
+    REQUIRE_FALSE(pipeline.isRunning());
+    REQUIRE(pipeline.getLatencySamples() == 0);
+    REQUIRE_THROWS_AS(pipeline.start(0), std::invalid_argument);
+
+    pipeline.start(blockSize);
+    REQUIRE(pipeline.isRunning());
+    REQUIRE(pipeline.getLatencySamples() == blockSize);
+
+    SECTION("Plays silence first, then each block one period late") {
+        auto block = makeBlock(blockSize, 0.25f);
+        processMono(pipeline, block);
+        REQUIRE(block.front() == 0.0f);
+        REQUIRE(block.back() == 0.0f);
+
+        for (int period = 1; period <= 4; ++period) {
+            stage.waitForSamples(period * blockSize);
+            block = makeBlock(blockSize, 0.25f * static_cast<float>(period + 1));
+            processMono(pipeline, block);
+
+            // Doubled input of the previous period
+            REQUIRE(block.front() == 0.5f * static_cast<float>(period));
+            REQUIRE(block.back() == 0.5f * static_cast<float>(period));
+        }
+        REQUIRE(pipeline.getUnderrunCount() == 0);
+    }
+
+    SECTION("A late block plays silence and the latency stays fixed") {
+        stage.held.store(true);
+
+        auto block = makeBlock(blockSize, 1.0f);
+        processMono(pipeline, block);
+        REQUIRE(block.front() == 0.0f); // primed silence
+
+        block = makeBlock(blockSize, 2.0f);
+        processMono(pipeline, block);
+        REQUIRE(block.front() == 0.0f); // the first input is late
+        REQUIRE(pipeline.getUnderrunCount() == 1);
+
+        stage.held.store(false);
+        stage.waitForSamples(2 * blockSize);
+
+        // The late block is dropped; this period plays the previous input as usual
+        block = makeBlock(blockSize, 3.0f);
+        processMono(pipeline, block);
+        REQUIRE(block.front() == 4.0f);
+
+        stage.waitForSamples(3 * blockSize);
+        block = makeBlock(blockSize, 4.0f);
+        processMono(pipeline, block);
+        REQUIRE(block.front() == 6.0f);
+        REQUIRE(pipeline.getUnderrunCount() == 1);
+    }
+
+    SECTION("A full output ring delays the pipeline instead of losing a block") {
+        // Each sample carries its own index, so any lost or skipped block shows
+        float nextIndex = 0.0f;
+        const auto ramp = [&nextIndex](int numSamples) {
+            std::vector<float> block(static_cast<size_t>(numSamples));
+            for (float& sample : block) {
+                sample = nextIndex++;
+            }
+            return block;
+        };
+
+        // The held stage keeps one block and the input ring takes eight more,
+        // all of them late: one block more than the output ring holds
+        stage.held.store(true);
+        for (int period = 0; period < 9; ++period) {
+            auto block = ramp(blockSize);
+            processMono(pipeline, block);
+        }
+        REQUIRE(pipeline.getUnderrunCount() == 8);
+
+        stage.held.store(false);
+        stage.waitForSamples(9 * blockSize);
+
+        // The late blocks are skipped as they turn up
+        for (int period = 0; period < 4; ++period) {
+            auto block = ramp(blockSize);
+            processMono(pipeline, block);
+            stage.waitForSamples(static_cast<int>(nextIndex));
+        }
+
+        // Back to exactly one block of latency, whatever the callback size
+        for (int period = 0; period < 8; ++period) {
+            auto block = ramp(blockSize / 2);
+            const float first = block.front();
+            processMono(pipeline, block);
+            for (size_t i = 0; i < block.size(); ++i) {
+                REQUIRE(block[i] == 2.0f * (first + static_cast<float>(i) - blockSize));
+            }
+            stage.waitForSamples(static_cast<int>(nextIndex));
+        }
+        REQUIRE(pipeline.getUnderrunCount() == 8);
+    }
+
+    SECTION("Carries stereo output") {
+        pipeline.start(blockSize, 2);
+
+        auto left = makeBlock(blockSize, 0.25f);
+        auto right = makeBlock(blockSize, 1.0f);
+        float* outputs[] = {left.data(), right.data()};
+        pipeline.process(left.data(), outputs, 2, blockSize);
+        REQUIRE(left.front() == 0.0f);
+        REQUIRE(right.front() == 0.0f);
+
+        stage.waitForSamples(blockSize);
+        pipeline.process(left.data(), outputs, 2, blockSize);
+        REQUIRE(left.front() == 0.5f);
+        REQUIRE(right.front() == -0.5f);
+    }
+
+    SECTION("Copies mono output to extra channels") {
+        auto left = makeBlock(blockSize, 0.25f);
+        auto right = makeBlock(blockSize, 1.0f);
+        float* outputs[] = {left.data(), right.data()};
+        pipeline.process(left.data(), outputs, 2, blockSize);
+
+        stage.waitForSamples(blockSize);
+        pipeline.process(left.data(), outputs, 2, blockSize);
+        REQUIRE(left.front() == 0.5f);
+        REQUIRE(right.front() == 0.5f);
+    }
+
+    SECTION("Stops and restarts") {
+        pipeline.stop();
+        REQUIRE_FALSE(pipeline.isRunning());
+        REQUIRE(pipeline.getLatencySamples() == 0);
+
+        pipeline.start(blockSize * 2);
+        REQUIRE(pipeline.getLatencySamples() == blockSize * 2);
+    }
+}
+
+} // namespace finirig::audio::tests
@@ -1,6 +1,8 @@
 #include <catch2/catch_test_macros.hpp>
 #include "finirig/audio/AudioProcessor.h"
+#include "finirig/audio/BlockProcessor.h"
 #include <array>
+#include <type_traits>
 
 namespace finirig::audio::tests {
 
@@ -18,6 +20,24 @@ private:
     float multiplier_;
 };
 
+// Block-path processor: adds one to every sample of every channel
+class OffsetBlock : public BlockProcessor<> {
+public:
+    void processChannels(float* const* channelData, int numChannels, int numSamples) noexcept override {
+        for (int channel = 0; channel < numChannels; ++channel) {
+            for (int sample = 0; sample < numSamples; ++sample) {
+                channelData[channel][sample] += 1.0f;
+            }
+        }
+    }
+};
+
+// Overriding neither path must not compile, rather than recurse
+class NoProcessing : public AudioProcessor {};
+class NoBlockProcessing : public BlockProcessor<> {};
+static_assert(std::is_abstract_v<NoProcessing>);
+static_assert(std::is_abstract_v<NoBlockProcessing>);
+
 TEST_CASE("AudioProcessor - processSample", "[audio]") {
     TestProcessor processor(2.0f);
 
@@ -54,6 +74,38 @@ TEST_CASE("AudioProcessor - processBlock", "[audio]") {
     }
 }
 
+TEST_CASE("AudioProcessor - processChannels", "[audio]") {
+    TestProcessor processor(2.0f);
+
+    SECTION("Processes first channel and copies to the others") {
+        constexpr int numSamples = 4;
+        std::array<float, numSamples> left = {0.1f, 0.2f, 0.3f, 0.4f};
+        std::array<float, numSamples> right = {0.0f, 0.0f, 0.0f, 0.0f};
+        std::array<float*, 2> channels = {left.data(), right.data()};
+
+        processor.processChannels(channels.data(), 2, numSamples);
+
+        REQUIRE(left[0] == 0.2f);
+        REQUIRE(left[1] == 0.4f);
+        REQUIRE(left[2] == 0.6f);
+        REQUIRE(left[3] == 0.8f);
+        REQUIRE(right == left);
+    }
+
+    SECTION("Ignores empty channel list") {
+        REQUIRE_NOTHROW(processor.processChannels(nullptr, 0, 16));
+    }
+}
+
+TEST_CASE("BlockProcessor - processSample", "[audio]") {
+    OffsetBlock processor;
+
+    SECTION("Runs the block path on a single sample") {
+        REQUIRE(processor.processSample(0.5f) == 1.5f);
+        REQUIRE(processor.processSample(-1.0f) == 0.0f);
+    }
+}
+
 TEST_CASE("AudioProcessor - prepare and reset", "[audio]") {
     TestProcessor processor;
 
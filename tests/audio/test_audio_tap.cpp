@@ -0,0 +1,46 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/audio/AudioTap.h"
+#include <array>
+#include <stdexcept>
+
+namespace finirig::audio::tests {
+
+TEST_CASE("AudioTap - sample FIFO", "[audio]") {
+    AudioTap tap(8);
+    std::array<float, 8> block = {1, 2, 3, 4, 5, 6, 7, 8};
+    std::array<float, 8> out{};
+
+    SECTION("Starts switched off") {
+        REQUIRE(tap.getPoint() == AudioTap::Point::Off);
+        tap.setPoint(AudioTap::Point::Input);
+        REQUIRE(tap.getPoint() == AudioTap::Point::Input);
+        REQUIRE_THROWS_AS(AudioTap(0), std::invalid_argument);
+    }
+
+    SECTION("Pulls what was pushed, in order, up to the requested count") {
+        tap.push(block.data(), 5);
+        REQUIRE(tap.pull(out.data(), 3) == 3);
+        REQUIRE(out[0] == 1.0f);
+        REQUIRE(out[2] == 3.0f);
+        REQUIRE(tap.pull(out.data(), 8) == 2);
+        REQUIRE(out[1] == 5.0f);
+        REQUIRE(tap.pull(out.data(), 8) == 0);
+    }
+
+    SECTION("Drops whole blocks that do not fit and counts them") {
+        tap.push(block.data(), 6);
+        tap.push(block.data(), 4);
+        REQUIRE(tap.getDroppedSampleCount() == 4);
+        REQUIRE(tap.pull(out.data(), 8) == 6);
+    }
+
+    SECTION("Discards pending samples") {
+        tap.push(block.data(), 6);
+        tap.discardPending();
+        REQUIRE(tap.pull(out.data(), 8) == 0);
+        tap.push(block.data(), 8);
+        REQUIRE(tap.getDroppedSampleCount() == 0);
+    }
+}
+
+} // namespace finirig::audio::tests
@@ -0,0 +1,59 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/audio/CallbackLoadMonitor.h"
+#include <cmath>
+#include <numeric>
+
+namespace finirig::audio::tests {
+
+TEST_CASE("CallbackLoadMonitor - load statistics", "[audio]") {
+    CallbackLoadMonitor monitor;
+    constexpr double period = 64.0 / 48000.0;
+
+    SECTION("Starts empty") {
+        auto snapshot = monitor.getSnapshot();
+        REQUIRE(snapshot.numCallbacks == 0);
+        REQUIRE(snapshot.numOverruns == 0);
+        REQUIRE(snapshot.maxLoad == 0.0f);
+    }
+
+    SECTION("Computes load as a fraction of the buffer period") {
+        monitor.recordCallback(period * 0.25, period);
+        auto snapshot = monitor.getSnapshot();
+        REQUIRE(snapshot.numCallbacks == 1);
+        REQUIRE(std::abs(snapshot.currentLoad - 0.25f) < 1.0e-5f);
+        REQUIRE(snapshot.histogram[5] == 1); // 25% falls in the 25-30% bin
+    }
+
+    SECTION("Tracks maximum and overruns") {
+        monitor.recordCallback(period * 0.1, period);
+        monitor.recordCallback(period * 1.5, period);
+        monitor.recordCallback(period * 0.2, period);
+
+        auto snapshot = monitor.getSnapshot();
+        REQUIRE(snapshot.numCallbacks == 3);
+        REQUIRE(snapshot.numOverruns == 1);
+        REQUIRE(std::abs(snapshot.maxLoad - 1.5f) < 1.0e-5f);
+        REQUIRE(snapshot.histogram[CallbackLoadMonitor::NUM_BINS - 1] == 1);
+
+        auto total = std::accumulate(snapshot.histogram.begin(), snapshot.histogram.end(), std::uint64_t{0});
+        REQUIRE(total == 3);
+    }
+
+    SECTION("Reset is applied on the next callback") {
+        monitor.recordCallback(period * 2.0, period);
+        monitor.requestReset();
+        monitor.recordCallback(period * 0.1, period);
+
+        auto snapshot = monitor.getSnapshot();
+        REQUIRE(snapshot.numCallbacks == 1);
+        REQUIRE(snapshot.numOverruns == 0);
+        REQUIRE(snapshot.maxLoad < 0.2f);
+    }
+
+    SECTION("Ignores invalid periods") {
+        monitor.recordCallback(0.001, 0.0);
+        REQUIRE(monitor.getSnapshot().numCallbacks == 0);
+    }
+}
+
+} // namespace finirig::audio::tests
@@ -0,0 +1,90 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/audio/AudioEngine.h"
+#include "finirig/audio/SignalChain.h"
+#include "finirig/amps/TubeAmp.h"
+#include "finirig/pedals/OverdrivePedal.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <numbers>
+#include <vector>
+
+namespace finirig::audio::tests {
+
+namespace {
+
+constexpr int BLOCK_SIZE = 256;
+
+// Overdrive into an amp, as on the pedalboard: both keep recursive filter
+// state that decays towards zero once the input stops
+std::unique_ptr<SignalChain> buildRig() {
+    auto chain = std::make_unique<SignalChain>();
+    chain->addStage(std::make_unique<pedals::OverdrivePedal>());
+    chain->addStage(std::make_unique<amps::TubeAmp>());
+    return chain;
+}
+
+void fillSine(std::vector<float>& block, int blockIndex, double sampleRate) {
+    for (int sample = 0; sample < BLOCK_SIZE; ++sample) {
+        const double n = static_cast<double>(blockIndex * BLOCK_SIZE + sample);
+        block[static_cast<std::size_t>(sample)] =
+            0.5f * static_cast<float>(std::sin(2.0 * std::numbers::pi * 110.0 * n / sampleRate));
+    }
+}
+
+// Run one device callback, processing in place, and return its duration
+std::chrono::steady_clock::duration timeCallback(AudioEngine& engine, std::vector<float>& block) {
+    const float* inputs[] = {block.data()};
+    float* outputs[] = {block.data()};
+    const auto start = std::chrono::steady_clock::now();
+    engine.audioDeviceIOCallbackWithContext(inputs, 1, outputs, 1, BLOCK_SIZE, {});
+    return std::chrono::steady_clock::now() - start;
+}
+
+} // namespace
+
+TEST_CASE("Denormals - decaying tail through the device callback", "[audio]") {
+    // No guard here: the callback sets up its own, as it does on the device thread
+    AudioEngine engine;
+    engine.setProcessor(buildRig());
+    const double sampleRate = engine.getSampleRate();
+    std::vector<float> block(BLOCK_SIZE);
+
+    // One second of playing, then ten seconds of the guitar ringing out
+    const int signalBlocks = static_cast<int>(sampleRate) / BLOCK_SIZE;
+    const int tailBlocks = 10 * signalBlocks;
+
+    auto fastestSignalBlock = std::chrono::steady_clock::duration::max();
+    for (int blockIndex = 0; blockIndex < signalBlocks; ++blockIndex) {
+        fillSine(block, blockIndex, sampleRate);
+        fastestSignalBlock = std::min(fastestSignalBlock, timeCallback(engine, block));
+    }
+
+    auto fastestTailBlock = std::chrono::steady_clock::duration::max();
+    bool sawSubnormal = false;
+    for (int blockIndex = 0; blockIndex < tailBlocks; ++blockIndex) {
+        std::fill(block.begin(), block.end(), 0.0f);
+        const auto elapsed = timeCallback(engine, block);
+
+        // Skip the first second: the filters are still audibly ringing
+        if (blockIndex >= signalBlocks) {
+            fastestTailBlock = std::min(fastestTailBlock, elapsed);
+        }
+        sawSubnormal = sawSubnormal || std::any_of(block.begin(), block.end(), [](float sample) {
+            return std::fpclassify(sample) == FP_SUBNORMAL;
+        });
+    }
+
+    // Both checks share the one render above; sections would re-run it
+    REQUIRE_FALSE(sawSubnormal);
+
+    // The same arithmetic runs either way; subnormal operands would take the
+    // FPU's microcoded slow path and cost many times more. The fastest block
+    // of each is compared so scheduler noise cannot fail the test.
+    INFO("signal " << std::chrono::duration<double, std::micro>(fastestSignalBlock).count()
+         << " us, tail " << std::chrono::duration<double, std::micro>(fastestTailBlock).count() << " us");
+    REQUIRE(fastestTailBlock <= fastestSignalBlock * 2);
+}
+
+} // namespace finirig::audio::tests
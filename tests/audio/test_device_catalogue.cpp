@@ -0,0 +1,175 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/audio/DeviceCatalogue.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace finirig::audio::tests {
+
+namespace {
+
+/**
+ * Device types the test can edit, with scans that block until released.
+ */
+struct FakeDevices {
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::vector<DeviceCatalogue::DeviceType> types;
+    std::vector<int> scanCounts;
+    bool scansReleased = true;
+    int scansStarted = 0;
+    std::function<void(const juce::String&)> listChanged;
+
+    void setScansReleased(bool released) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            scansReleased = released;
+        }
+        condition.notify_all();
+    }
+
+    void plugIn(int typeIndex, const juce::String& device) {
+        juce::String typeName;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            types[static_cast<std::size_t>(typeIndex)].inputDevices.add(device);
+            typeName = types[static_cast<std::size_t>(typeIndex)].typeName;
+        }
+        listChanged(typeName);
+    }
+
+    int getScanCount(int typeIndex) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return scanCounts[static_cast<std::size_t>(typeIndex)];
+    }
+};
+
+class FakeScanner final : public DeviceCatalogue::Scanner {
+public:
+    explicit FakeScanner(std::shared_ptr<FakeDevices> devices)
+        : devices_(std::move(devices))
+    {
+    }
+
+    int getNumTypes() override {
+        std::lock_guard<std::mutex> lock(devices_->mutex);
+        return static_cast<int>(devices_->types.size());
+    }
+
+    juce::String getTypeName(int typeIndex) override {
+        std::lock_guard<std::mutex> lock(devices_->mutex);
+        return devices_->types[static_cast<std::size_t>(typeIndex)].typeName;
+    }
+
+    DeviceCatalogue::DeviceType scan(int typeIndex) override {
+        std::unique_lock<std::mutex> lock(devices_->mutex);
+        ++devices_->scansStarted;
+        devices_->condition.wait(lock, [this] { return devices_->scansReleased; });
+        ++devices_->scanCounts[static_cast<std::size_t>(typeIndex)];
+        return devices_->types[static_cast<std::size_t>(typeIndex)];
+    }
+
+    void setListChangedCallback(std::function<void(const juce::String&)> callback) override {
+        devices_->listChanged = std::move(callback);
+    }
+
+private:
+    std::shared_ptr<FakeDevices> devices_;
+};
+
+std::shared_ptr<FakeDevices> makeDevices() {
+    auto devices = std::make_shared<FakeDevices>();
+    devices->types = {
+        {"ALSA", {}, {}},
+        {"JACK", {}, {}},
+    };
+    devices->types[0].inputDevices.add("USB Interface");
+    devices->types[0].outputDevices.add("USB Interface");
+    devices->types[1].outputDevices.add("system");
+    devices->scanCounts.assign(devices->types.size(), 0);
+    return devices;
+}
+
+template <typename Condition>
+bool waitFor(Condition condition) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("DeviceCatalogue - background scanning", "[audio]") {
+    auto devices = makeDevices();
+    DeviceCatalogue catalogue(std::make_unique<FakeScanner>(devices));
+
+    std::atomic<int> notifications{0};
+    catalogue.setChangeCallback([&notifications] { ++notifications; });
+
+    SECTION("Requests and reads never wait for a scan") {
+        devices->setScansReleased(false);
+        catalogue.requestRescan();
+
+        REQUIRE(waitFor([&] {
+            std::lock_guard<std::mutex> lock(devices->mutex);
+            return devices->scansStarted > 0;
+        }));
+
+        // The scan is stuck in the driver, yet the catalogue still answers
+        const auto pending = catalogue.getSnapshot();
+        REQUIRE_FALSE(pending.scanned);
+        REQUIRE(pending.getInputDeviceNames().size() == 0);
+        catalogue.requestRescan("JACK");
+
+        devices->setScansReleased(true);
+        REQUIRE(waitFor([&] { return notifications.load() == 1; }));
+
+        const auto snapshot = catalogue.getSnapshot();
+        REQUIRE(snapshot.scanned);
+        REQUIRE(snapshot.generation == 1);
+        REQUIRE(snapshot.getInputDeviceNames().size() == 1);
+        REQUIRE(snapshot.getInputDeviceNames()[0] == "ALSA: USB Interface");
+        REQUIRE(snapshot.getOutputDeviceNames().size() == 2);
+        REQUIRE(snapshot.getOutputDeviceNames()[1] == "JACK: system");
+
+        // The request made during the scan ran afterwards, for JACK only
+        REQUIRE(waitFor([&] { return devices->getScanCount(1) == 2; }));
+        REQUIRE(devices->getScanCount(0) == 1);
+    }
+
+    SECTION("Rescans that find nothing new stay silent") {
+        catalogue.requestRescan();
+        REQUIRE(waitFor([&] { return notifications.load() == 1; }));
+
+        catalogue.requestRescan();
+        REQUIRE(waitFor([&] { return catalogue.getTypeScanCount() == 4; }));
+        REQUIRE(notifications.load() == 1);
+        REQUIRE(catalogue.getSnapshot().generation == 1);
+    }
+
+    SECTION("A hot-plug rescans only the type that changed") {
+        catalogue.requestRescan();
+        REQUIRE(waitFor([&] { return notifications.load() == 1; }));
+
+        devices->plugIn(1, "Bass DI");
+        REQUIRE(waitFor([&] { return notifications.load() == 2; }));
+
+        const auto snapshot = catalogue.getSnapshot();
+        REQUIRE(snapshot.generation == 2);
+        REQUIRE(snapshot.getInputDeviceNames().contains("JACK: Bass DI"));
+        REQUIRE(devices->getScanCount(0) == 1);
+        REQUIRE(devices->getScanCount(1) == 2);
+    }
+}
+
+} // namespace finirig::audio::tests
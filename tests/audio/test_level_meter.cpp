@@ -0,0 +1,136 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "finirig/audio/LevelMeter.h"
+#include "TestUtils.h"
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+namespace finirig::audio::tests {
+
+using Catch::Matchers::WithinAbs;
+using finirig::tests::makeSine;
+
+namespace {
+
+void measureMono(LevelMeter& meter, const std::vector<float>& samples) {
+    const float* channels[] = {samples.data()};
+    meter.measure(channels, 1, static_cast<int>(samples.size()));
+}
+
+} // namespace
+
+TEST_CASE("LevelMeter - block measurements", "[audio]") {
+    LevelMeter meter;
+    LevelMeter::Frame frame;
+
+    SECTION("Peak and RMS of a sine") {
+        measureMono(meter, makeSine(1000.0 / 48000.0, 1.0, 480, 0.5f));
+        REQUIRE(meter.pop(frame));
+
+        REQUIRE(frame.numChannels == 1);
+        REQUIRE(frame.numSamples == 480);
+        REQUIRE_THAT(frame.channels[0].peak, WithinAbs(0.5, 1e-4));
+        REQUIRE_THAT(frame.channels[0].rms, WithinAbs(0.5 / std::sqrt(2.0), 1e-3));
+        REQUIRE(frame.channels[0].truePeak >= frame.channels[0].peak);
+        REQUIRE_FALSE(frame.channels[0].clipped);
+    }
+
+    SECTION("True peak finds the crest between samples") {
+        // A quarter-rate sine sampled 45 degrees off its crest never has a
+        // sample above 0.707, but the waveform reaches full scale
+        const auto samples = makeSine(0.25, 1.0, 512, 1.0f, std::numbers::pi / 4.0);
+        measureMono(meter, samples);
+        measureMono(meter, samples);
+        meter.pop(frame);
+        REQUIRE(meter.pop(frame));
+
+        REQUIRE(frame.channels[0].peak < 0.71f);
+        REQUIRE(frame.channels[0].truePeak > 0.95f);
+        REQUIRE_FALSE(frame.channels[0].clipped);
+    }
+
+    SECTION("Full scale samples set the clip flag") {
+        std::vector<float> samples(64, 0.0f);
+        samples[10] = -1.0f;
+        measureMono(meter, samples);
+        REQUIRE(meter.pop(frame));
+        REQUIRE(frame.channels[0].clipped);
+    }
+
+    SECTION("Each channel is measured separately") {
+        const std::vector<float> left(64, 0.25f);
+        const std::vector<float> right(64, -0.75f);
+        const float* channels[] = {left.data(), right.data()};
+        meter.measure(channels, 2, 64);
+        REQUIRE(meter.pop(frame));
+
+        REQUIRE(frame.numChannels == 2);
+        REQUIRE_THAT(frame.channels[0].peak, WithinAbs(0.25, 1e-6));
+        REQUIRE_THAT(frame.channels[1].peak, WithinAbs(0.75, 1e-6));
+        REQUIRE_THAT(frame.channels[1].rms, WithinAbs(0.75, 1e-5));
+    }
+
+    SECTION("Blocks longer than one interpolator chunk") {
+        measureMono(meter, makeSine(0.01, 1.0, 2000, 0.8f));
+        REQUIRE(meter.pop(frame));
+        REQUIRE(frame.numSamples == 2000);
+        REQUIRE_THAT(frame.channels[0].truePeak, WithinAbs(0.8, 0.01));
+    }
+}
+
+TEST_CASE("LevelMeter - frame ring", "[audio]") {
+    LevelMeter::Frame frame;
+
+    SECTION("Every block reaches the reader, in order") {
+        LevelMeter meter;
+        for (int block = 1; block <= 10; ++block) {
+            measureMono(meter, std::vector<float>(32, 0.05f * static_cast<float>(block)));
+        }
+        for (int block = 1; block <= 10; ++block) {
+            REQUIRE(meter.pop(frame));
+            REQUIRE_THAT(frame.channels[0].peak, WithinAbs(0.05 * block, 1e-6));
+        }
+        REQUIRE_FALSE(meter.pop(frame));
+    }
+
+    SECTION("A full ring drops new frames and counts them") {
+        LevelMeter meter(4);
+        for (int block = 0; block < 6; ++block) {
+            measureMono(meter, std::vector<float>(32, 0.1f));
+        }
+        REQUIRE(meter.getDroppedFrameCount() == 2);
+
+        int count = 0;
+        while (meter.pop(frame)) {
+            ++count;
+        }
+        REQUIRE(count == 4);
+        REQUIRE_THROWS_AS(LevelMeter(0), std::invalid_argument);
+    }
+
+    SECTION("Draining folds the waiting frames into one") {
+        LevelMeter meter;
+        std::vector<float> loud(64, 0.0f);
+        loud[3] = 1.0f;
+        measureMono(meter, std::vector<float>(64, 0.5f));
+        measureMono(meter, loud);
+        measureMono(meter, std::vector<float>(128, 0.0f));
+
+        REQUIRE(meter.drain(frame) == 3);
+        REQUIRE(frame.numSamples == 256);
+        REQUIRE_THAT(frame.channels[0].peak, WithinAbs(1.0, 1e-6));
+        REQUIRE(frame.channels[0].clipped);
+
+        // Energy: 64 * 0.25 + 1 over 256 samples
+        REQUIRE_THAT(frame.channels[0].rms, WithinAbs(std::sqrt(17.0 / 256.0), 1e-5));
+
+        LevelMeter::Frame untouched;
+        untouched.numSamples = 7;
+        REQUIRE(meter.drain(untouched) == 0);
+        REQUIRE(untouched.numSamples == 7);
+    }
+}
+
+} // namespace finirig::audio::tests
@@ -0,0 +1,103 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/audio/Parameter.h"
+#include <cmath>
+
+namespace finirig::audio::tests {
+
+TEST_CASE("Parameter - target value", "[audio]") {
+    Parameter parameter(0.5f, 0.0f, 1.0f);
+
+    SECTION("Starts at the default") {
+        REQUIRE(parameter.getValue() == 0.5f);
+        REQUIRE(parameter.getCurrentValue() == 0.5f);
+        REQUIRE_FALSE(parameter.isSmoothing());
+    }
+
+    SECTION("Clamps to the range") {
+        parameter.setValue(2.0f);
+        REQUIRE(parameter.getValue() == 1.0f);
+        parameter.setValue(-1.0f);
+        REQUIRE(parameter.getValue() == 0.0f);
+    }
+
+    SECTION("Current value only moves on advance") {
+        parameter.setValue(1.0f);
+        REQUIRE(parameter.getCurrentValue() == 0.5f);
+    }
+
+    SECTION("Advance reports no change when idle") {
+        REQUIRE_FALSE(parameter.advance(32));
+    }
+}
+
+TEST_CASE("Parameter - linear smoothing", "[audio]") {
+    // 100 samples of ramp at 1 kHz
+    Parameter parameter(0.0f, 0.0f, 1.0f, Parameter::Smoothing::Linear, 0.1);
+    parameter.prepare(1000.0);
+    parameter.setValue(1.0f);
+
+    SECTION("Ramps at a constant rate") {
+        REQUIRE(parameter.advance(25));
+        REQUIRE(std::abs(parameter.getCurrentValue() - 0.25f) < 1.0e-6f);
+        REQUIRE(parameter.advance(25));
+        REQUIRE(std::abs(parameter.getCurrentValue() - 0.5f) < 1.0e-6f);
+        REQUIRE(parameter.isSmoothing());
+    }
+
+    SECTION("Lands exactly on the target") {
+        REQUIRE(parameter.advance(60));
+        REQUIRE(parameter.advance(60));
+        REQUIRE(parameter.getCurrentValue() == 1.0f);
+        REQUIRE_FALSE(parameter.isSmoothing());
+        REQUIRE_FALSE(parameter.advance(60));
+    }
+
+    SECTION("Retargets mid-ramp from the current value") {
+        REQUIRE(parameter.advance(50));
+        parameter.setValue(0.0f);
+        REQUIRE(parameter.advance(50));
+        REQUIRE(std::abs(parameter.getCurrentValue() - 0.25f) < 1.0e-6f);
+    }
+
+    SECTION("Reset jumps to the target") {
+        parameter.reset();
+        REQUIRE(parameter.getCurrentValue() == 1.0f);
+        REQUIRE_FALSE(parameter.isSmoothing());
+    }
+}
+
+TEST_CASE("Parameter - exponential smoothing", "[audio]") {
+    Parameter parameter(0.0f, 0.0f, 1.0f, Parameter::Smoothing::Exponential, 0.1);
+    parameter.prepare(1000.0);
+    parameter.setValue(1.0f);
+
+    SECTION("Moves fastest at the start") {
+        REQUIRE(parameter.advance(10));
+        const float first = parameter.getCurrentValue();
+        REQUIRE(parameter.advance(10));
+        const float second = parameter.getCurrentValue() - first;
+        REQUIRE(first > 0.0f);
+        REQUIRE(second < first);
+    }
+
+    SECTION("Is 60 dB closer at the end of the ramp") {
+        REQUIRE(parameter.advance(99));
+        REQUIRE(std::abs(1.0f - parameter.getCurrentValue()) < 2.0e-3f);
+        REQUIRE(parameter.advance(1));
+        REQUIRE(parameter.getCurrentValue() == 1.0f);
+    }
+
+    SECTION("Block size does not change the curve") {
+        Parameter other(0.0f, 0.0f, 1.0f, Parameter::Smoothing::Exponential, 0.1);
+        other.prepare(1000.0);
+        other.setValue(1.0f);
+
+        REQUIRE(parameter.advance(40));
+        for (int i = 0; i < 4; ++i) {
+            REQUIRE(other.advance(10));
+        }
+        REQUIRE(std::abs(parameter.getCurrentValue() - other.getCurrentValue()) < 1.0e-5f);
+    }
+}
+
+} // namespace finirig::audio::tests
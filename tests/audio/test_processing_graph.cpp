@@ -0,0 +1,304 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "finirig/audio/ProcessingGraph.h"
+#include "finirig/audio/SignalChain.h"
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace finirig::audio::tests {
+
+namespace {
+
+// Multiplies by a constant and records prepare() calls
+class GainStage : public AudioProcessor {
+public:
+    explicit GainStage(float gain) : gain_(gain) {}
+
+    [[nodiscard]] float processSample(float input) noexcept override {
+        return input * gain_;
+    }
+
+    void prepare(double sampleRate) override { preparedRate = sampleRate; }
+
+    double preparedRate = 0.0;
+
+private:
+    float gain_;
+};
+
+// Adds a constant, so processing order changes the result
+class OffsetStage : public AudioProcessor {
+public:
+    explicit OffsetStage(float offset) : offset_(offset) {}
+
+    [[nodiscard]] float processSample(float input) noexcept override {
+        return input + offset_;
+    }
+
+private:
+    float offset_;
+};
+
+// Reports a fixed latency without delaying anything
+class LatentStage : public GainStage {
+public:
+    explicit LatentStage(int latency) : GainStage(1.0f), latency_(latency) {}
+
+    [[nodiscard]] int getLatencySamples() const noexcept override { return latency_; }
+
+private:
+    int latency_;
+};
+
+// Stateful stage, so a wrong task order or a skipped slice shows up
+class OnePole : public AudioProcessor {
+public:
+    explicit OnePole(float coefficient) : coefficient_(coefficient) {}
+
+    [[nodiscard]] float processSample(float input) noexcept override {
+        state_ += coefficient_ * (input - state_);
+        return state_;
+    }
+
+    void reset() override { state_ = 0.0f; }
+
+private:
+    float coefficient_;
+    float state_ = 0.0f;
+};
+
+// Two amp-like branches from the input, one of them into a second stage
+void buildDualBranch(ProcessingGraph& graph) {
+    const int left = graph.addNode(std::make_unique<OnePole>(0.3f));
+    const int right = graph.addNode(std::make_unique<OnePole>(0.05f));
+    const int post = graph.addNode(std::make_unique<OnePole>(0.5f));
+
+    graph.connect(ProcessingGraph::INPUT, left);
+    graph.connect(ProcessingGraph::INPUT, right, 0.5f);
+    graph.connect(right, post);
+    graph.connect(left, ProcessingGraph::OUTPUT, 0.7f);
+    graph.connect(post, ProcessingGraph::OUTPUT, 0.3f);
+}
+
+std::vector<float> renderGraph(ProcessingGraph& graph, int numSamples) {
+    std::vector<float> data(static_cast<size_t>(numSamples));
+    for (int i = 0; i < numSamples; ++i) {
+        data[static_cast<size_t>(i)] = std::sin(0.01f * static_cast<float>(i));
+    }
+    float* channels[] = {data.data()};
+    graph.processChannels(channels, 1, numSamples);
+    return data;
+}
+
+} // namespace
+
+TEST_CASE("ProcessingGraph - topology", "[audio]") {
+    ProcessingGraph graph(0);
+
+    SECTION("An empty graph is silent") {
+        REQUIRE(graph.getNumNodes() == 0);
+        REQUIRE(graph.processSample(0.5f) == 0.0f);
+    }
+
+    SECTION("Passes the input straight to the output with gain") {
+        graph.connect(ProcessingGraph::INPUT, ProcessingGraph::OUTPUT, 0.5f);
+        REQUIRE(graph.isConnected(ProcessingGraph::INPUT, ProcessingGraph::OUTPUT));
+        REQUIRE(graph.processSample(0.5f) == 0.25f);
+
+        // Reconnecting changes the gain
+        graph.connect(ProcessingGraph::INPUT, ProcessingGraph::OUTPUT, 2.0f);
+        REQUIRE(graph.processSample(0.5f) == 1.0f);
+    }
+
+    SECTION("Sums parallel branches") {
+        const int a = graph.addNode(std::make_unique<GainStage>(2.0f));
+        const int b = graph.addNode(std::make_unique<GainStage>(3.0f));
+        graph.connect(ProcessingGraph::INPUT, a);
+        graph.connect(ProcessingGraph::INPUT, b);
+        graph.connect(a, ProcessingGraph::OUTPUT);
+        graph.connect(b, ProcessingGraph::OUTPUT, 0.5f);
+
+        // 0.5 * 2 + 0.5 * 3 * 0.5
+        REQUIRE(graph.processSample(0.5f) == 1.75f);
+    }
+
+    SECTION("Runs a chain in connection order") {
+        const int offset = graph.addNode(std::make_unique<OffsetStage>(1.0f));
+        const int gain = graph.addNode(std::make_unique<GainStage>(2.0f));
+        graph.connect(ProcessingGraph::INPUT, gain);
+        graph.connect(gain, offset);
+        graph.connect(offset, ProcessingGraph::OUTPUT);
+
+        // 0.5 * 2 + 1
+        REQUIRE(graph.processSample(0.5f) == 2.0f);
+
+        graph.disconnect(gain, offset);
+        REQUIRE_FALSE(graph.isConnected(gain, offset));
+        // The offset stage now has no input
+        REQUIRE(graph.processSample(0.5f) == 1.0f);
+    }
+
+    SECTION("Removes nodes with their connections") {
+        const int node = graph.addNode(std::make_unique<GainStage>(2.0f));
+        graph.connect(ProcessingGraph::INPUT, node);
+        graph.connect(node, ProcessingGraph::OUTPUT);
+
+        auto removed = graph.removeNode(node);
+        REQUIRE(removed != nullptr);
+        REQUIRE(graph.getNumNodes() == 0);
+        REQUIRE_FALSE(graph.isConnected(node, ProcessingGraph::OUTPUT));
+        REQUIRE(graph.processSample(0.5f) == 0.0f);
+
+        // The freed id is reused
+        REQUIRE(graph.addNode(std::make_unique<GainStage>(1.0f)) == node);
+    }
+
+    SECTION("Rejects cycles, unknown ids and misplaced endpoints") {
+        const int a = graph.addNode(std::make_unique<GainStage>(1.0f));
+        const int b = graph.addNode(std::make_unique<GainStage>(1.0f));
+        graph.connect(a, b);
+
+        REQUIRE_THROWS_AS(graph.connect(b, a), std::invalid_argument);
+        REQUIRE_THROWS_AS(graph.connect(a, a), std::invalid_argument);
+        REQUIRE_FALSE(graph.isConnected(b, a));
+
+        REQUIRE_THROWS_AS(graph.connect(a, 17), std::out_of_range);
+        REQUIRE_THROWS_AS(graph.connect(ProcessingGraph::OUTPUT, a), std::invalid_argument);
+        REQUIRE_THROWS_AS(graph.connect(a, ProcessingGraph::INPUT), std::invalid_argument);
+        REQUIRE_THROWS_AS(graph.removeNode(17), std::out_of_range);
+    }
+
+    SECTION("Rejects nodes beyond capacity") {
+        for (int i = 0; i < ProcessingGraph::MAX_NODES; ++i) {
+            graph.addNode(std::make_unique<GainStage>(1.0f));
+        }
+        REQUIRE_THROWS_AS(graph.addNode(std::make_unique<GainStage>(1.0f)), std::length_error);
+    }
+
+    SECTION("Prepares nodes with the graph sample rate") {
+        graph.prepare(48000.0);
+        const int node = graph.addNode(std::make_unique<GainStage>(1.0f));
+        auto* stage = dynamic_cast<GainStage*>(graph.getNode(node));
+        REQUIRE(stage != nullptr);
+        REQUIRE(stage->preparedRate == 48000.0);
+
+        graph.prepare(96000.0);
+        REQUIRE(stage->preparedRate == 96000.0);
+    }
+}
+
+TEST_CASE("ProcessingGraph - latency", "[audio]") {
+    ProcessingGraph graph(0);
+    const int a = graph.addNode(std::make_unique<LatentStage>(12));
+    const int b = graph.addNode(std::make_unique<LatentStage>(30));
+    const int c = graph.addNode(std::make_unique<LatentStage>(25));
+    graph.connect(ProcessingGraph::INPUT, a);
+    graph.connect(a, b);
+    graph.connect(ProcessingGraph::INPUT, c);
+    graph.connect(b, ProcessingGraph::OUTPUT);
+    graph.connect(c, ProcessingGraph::OUTPUT);
+
+    // Slowest path: a then b
+    REQUIRE(graph.getLatencySamples() == 42);
+
+    graph.disconnect(b, ProcessingGraph::OUTPUT);
+    REQUIRE(graph.getLatencySamples() == 25);
+
+    graph.removeNode(c);
+    REQUIRE(graph.getLatencySamples() == 0);
+
+    graph.connect(b, ProcessingGraph::OUTPUT);
+    REQUIRE(graph.getLatencySamples() == 42);
+
+    // A nested chain edited after it was added still counts
+    auto nested = std::make_unique<SignalChain>();
+    auto* chain = nested.get();
+    const int d = graph.addNode(std::move(nested));
+    graph.connect(ProcessingGraph::INPUT, d);
+    graph.connect(d, ProcessingGraph::OUTPUT);
+    REQUIRE(graph.getLatencySamples() == 42);
+
+    chain->addStage(std::make_unique<LatentStage>(60));
+    REQUIRE(graph.getLatencySamples() == 60);
+
+    // And so does a graph nested in a chain
+    SignalChain outer;
+    auto owned = std::make_unique<ProcessingGraph>(0);
+    auto* inner = owned.get();
+    outer.addStage(std::move(owned));
+    const int e = inner->addNode(std::make_unique<LatentStage>(7));
+    inner->connect(ProcessingGraph::INPUT, e);
+    REQUIRE(outer.getLatencySamples() == 0);
+
+    inner->connect(e, ProcessingGraph::OUTPUT);
+    REQUIRE(outer.getLatencySamples() == 7);
+}
+
+TEST_CASE("ProcessingGraph - parallel processing", "[audio]") {
+    constexpr int numSamples = ProcessingGraph::SUB_BLOCK_SIZE * 4 + 33;
+
+    ProcessingGraph inlineGraph(0);
+    buildDualBranch(inlineGraph);
+    const auto expected = renderGraph(inlineGraph, numSamples);
+
+    SECTION("Worker threads give the same result as running inline") {
+        ProcessingGraph parallelGraph(3);
+        REQUIRE(parallelGraph.getNumWorkers() == 3);
+        buildDualBranch(parallelGraph);
+
+        const auto result = renderGraph(parallelGraph, numSamples);
+        for (int i = 0; i < numSamples; ++i) {
+            REQUIRE(result[static_cast<size_t>(i)] == expected[static_cast<size_t>(i)]);
+        }
+    }
+
+    SECTION("Interleaved blocks are written to every channel") {
+        ProcessingGraph parallelGraph(2);
+        buildDualBranch(parallelGraph);
+
+        std::vector<float> buffer(numSamples * 2);
+        for (int i = 0; i < numSamples; ++i) {
+            buffer[static_cast<size_t>(i) * 2] = std::sin(0.01f * static_cast<float>(i));
+        }
+        parallelGraph.processBlock(buffer.data(), 2, numSamples);
+
+        for (int i = 0; i < numSamples; ++i) {
+            REQUIRE(buffer[static_cast<size_t>(i) * 2] == expected[static_cast<size_t>(i)]);
+            REQUIRE(buffer[static_cast<size_t>(i) * 2 + 1] == expected[static_cast<size_t>(i)]);
+        }
+    }
+
+    SECTION("Topology edits are safe while audio runs") {
+        ProcessingGraph graph(2);
+        std::atomic<bool> running{true};
+
+        std::thread audio([&] {
+            std::array<float, 128> data{};
+            float* channels[] = {data.data()};
+            while (running.load(std::memory_order_relaxed)) {
+                data.fill(0.5f);
+                graph.processChannels(channels, 1, static_cast<int>(data.size()));
+            }
+        });
+
+        for (int i = 0; i < 200; ++i) {
+            const int node = graph.addNode(std::make_unique<OnePole>(0.5f));
+            graph.connect(ProcessingGraph::INPUT, node);
+            graph.connect(node, ProcessingGraph::OUTPUT);
+            graph.connect(ProcessingGraph::INPUT, ProcessingGraph::OUTPUT, static_cast<float>(i % 2));
+            auto removed = graph.removeNode(node);
+            REQUIRE(removed != nullptr);
+        }
+
+        running.store(false, std::memory_order_relaxed);
+        audio.join();
+        REQUIRE(graph.getNumNodes() == 0);
+    }
+}
+
+} // namespace finirig::audio::tests
@@ -0,0 +1,46 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/audio/ProcessorStats.h"
+#include <cmath>
+
+namespace finirig::audio::tests {
+
+TEST_CASE("ProcessorStats - timing counters", "[audio]") {
+    ProcessorStats stats;
+
+    SECTION("Starts empty") {
+        auto snapshot = stats.getSnapshot();
+        REQUIRE(snapshot.numBlocks == 0);
+        REQUIRE(snapshot.getNanosecondsPerSample() == 0.0);
+    }
+
+    SECTION("Accumulates time, samples and peak block") {
+        stats.record(1000, 64);
+        stats.record(3000, 64);
+
+        auto snapshot = stats.getSnapshot();
+        REQUIRE(snapshot.numBlocks == 2);
+        REQUIRE(snapshot.numSamples == 128);
+        REQUIRE(snapshot.totalNanoseconds == 4000);
+        REQUIRE(snapshot.peakBlockNanoseconds == 3000);
+        REQUIRE(std::abs(snapshot.getNanosecondsPerSample() - 31.25) < 1.0e-9);
+    }
+
+    SECTION("Converts cost to realtime load") {
+        // 1000 ns per sample at 48 kHz is 4.8% of one core
+        stats.record(64000, 64);
+        REQUIRE(std::abs(stats.getSnapshot().getLoad(48000.0) - 0.048) < 1.0e-9);
+    }
+
+    SECTION("Reset is applied on the next record") {
+        stats.record(5000, 32);
+        stats.requestReset();
+        stats.record(100, 16);
+
+        auto snapshot = stats.getSnapshot();
+        REQUIRE(snapshot.numBlocks == 1);
+        REQUIRE(snapshot.numSamples == 16);
+        REQUIRE(snapshot.peakBlockNanoseconds == 100);
+    }
+}
+
+} // namespace finirig::audio::tests
@@ -0,0 +1,38 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/audio/RealtimeEpoch.h"
+
+namespace finirig::audio::tests {
+
+TEST_CASE("RealtimeEpoch - quiescence tracking", "[audio]") {
+    RealtimeEpoch epoch;
+
+    SECTION("Idle reader has always passed") {
+        auto snapshot = epoch.snapshot();
+        REQUIRE(epoch.hasPassed(snapshot));
+    }
+
+    SECTION("Reader inside a section has not passed until it exits") {
+        epoch.enter();
+        auto snapshot = epoch.snapshot();
+        REQUIRE_FALSE(epoch.hasPassed(snapshot));
+
+        epoch.exit();
+        REQUIRE(epoch.hasPassed(snapshot));
+    }
+
+    SECTION("Scoped reader brackets a section") {
+        std::uint64_t snapshot = 0;
+        {
+            RealtimeEpoch::ScopedReader reader(epoch);
+            snapshot = epoch.snapshot();
+            REQUIRE_FALSE(epoch.hasPassed(snapshot));
+        }
+        REQUIRE(epoch.hasPassed(snapshot));
+    }
+
+    SECTION("Synchronize returns immediately for an idle reader") {
+        REQUIRE_NOTHROW(epoch.synchronize());
+    }
+}
+
+} // namespace finirig::audio::tests
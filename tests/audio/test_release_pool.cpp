@@ -0,0 +1,72 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/audio/ReleasePool.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+namespace finirig::audio::tests {
+
+namespace {
+
+// Records its own destruction
+struct Tracked {
+    explicit Tracked(std::atomic<int>& counter) : destroyed(counter) {}
+    ~Tracked() { destroyed.fetch_add(1); }
+    std::atomic<int>& destroyed;
+};
+
+bool waitFor(const std::atomic<int>& counter, int expected) {
+    for (int attempt = 0; attempt < 200; ++attempt) {
+        if (counter.load() == expected) {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return counter.load() == expected;
+}
+
+} // namespace
+
+TEST_CASE("ReleasePool - deferred destruction", "[audio]") {
+    RealtimeEpoch epoch;
+    std::atomic<int> destroyed{0};
+
+    SECTION("Frees objects when the reader is idle") {
+        ReleasePool pool(epoch);
+        pool.retire(std::make_unique<Tracked>(destroyed));
+        REQUIRE(waitFor(destroyed, 1));
+        REQUIRE(pool.getPendingCount() == 0);
+    }
+
+    SECTION("Keeps objects alive while the reader is inside a section") {
+        ReleasePool pool(epoch);
+        epoch.enter();
+        pool.retire(std::make_unique<Tracked>(destroyed));
+
+        REQUIRE(pool.collect() == 0);
+        REQUIRE(destroyed.load() == 0);
+        REQUIRE(pool.getPendingCount() == 1);
+
+        epoch.exit();
+        REQUIRE(waitFor(destroyed, 1));
+    }
+
+    SECTION("Frees pending objects on destruction") {
+        epoch.enter();
+        {
+            ReleasePool pool(epoch);
+            pool.retire(std::make_unique<Tracked>(destroyed));
+        }
+        epoch.exit();
+        REQUIRE(destroyed.load() == 1);
+    }
+
+    SECTION("Ignores null objects") {
+        ReleasePool pool(epoch);
+        pool.retire(std::unique_ptr<Tracked>());
+        REQUIRE(pool.getPendingCount() == 0);
+    }
+}
+
+} // namespace finirig::audio::tests
@@ -0,0 +1,432 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/audio/SignalChain.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace finirig::audio::tests {
+
+namespace {
+
+// Multiplies by a constant and counts prepare() calls
+class GainStage : public AudioProcessor {
+public:
+    explicit GainStage(float gain) : gain_(gain) {}
+
+    [[nodiscard]] float processSample(float input) noexcept override {
+        return input * gain_;
+    }
+
+    void processChannels(float* const* channelData, int numChannels, int numSamples) noexcept override {
+        for (int channel = 0; channel < numChannels; ++channel) {
+            for (int sample = 0; sample < numSamples; ++sample) {
+                channelData[channel][sample] *= gain_;
+            }
+        }
+    }
+
+    void prepare(double sampleRate) override { preparedRate = sampleRate; }
+
+    double preparedRate = 0.0;
+
+private:
+    float gain_;
+};
+
+// Adds a constant, so stage order changes the result
+class OffsetStage : public AudioProcessor {
+public:
+    explicit OffsetStage(float offset) : offset_(offset) {}
+
+    [[nodiscard]] float processSample(float input) noexcept override {
+        return input + offset_;
+    }
+
+private:
+    float offset_;
+};
+
+// Reports a fixed latency without delaying anything
+class LatentStage : public GainStage {
+public:
+    explicit LatentStage(int latency) : GainStage(1.0f), latency_(latency) {}
+
+    [[nodiscard]] int getLatencySamples() const noexcept override { return latency_; }
+
+private:
+    int latency_;
+};
+
+// Stereo stage: scales the right channel (negates it by default), records
+// the widths it was given
+class StereoStage : public GainStage {
+public:
+    explicit StereoStage(float rightGain = -1.0f) : GainStage(1.0f), rightGain_(rightGain) {}
+
+    void processChannels(float* const* channelData, int numChannels, int numSamples) noexcept override {
+        lastNumChannels = numChannels;
+        if (numChannels > 1) {
+            for (int sample = 0; sample < numSamples; ++sample) {
+                channelData[1][sample] *= rightGain_;
+            }
+        }
+    }
+
+    [[nodiscard]] ChannelLayout getChannelLayout() const noexcept override { return ChannelLayout::Stereo; }
+
+    int lastNumChannels = 0;
+
+private:
+    float rightGain_;
+};
+
+// Mono stage that records how many channels it was given
+class CountingStage : public GainStage {
+public:
+    explicit CountingStage(float gain) : GainStage(gain) {}
+
+    void processChannels(float* const* channelData, int numChannels, int numSamples) noexcept override {
+        lastNumChannels = numChannels;
+        GainStage::processChannels(channelData, numChannels, numSamples);
+    }
+
+    int lastNumChannels = 0;
+};
+
+// Holds the audio thread inside processChannels() until released
+class BlockingStage : public GainStage {
+public:
+    BlockingStage() : GainStage(1.0f) {}
+
+    void processChannels(float* const*, int, int) noexcept override {
+        entered.store(true);
+        while (!released.load()) {
+            std::this_thread::yield();
+        }
+    }
+
+    std::atomic<bool> entered{false};
+    std::atomic<bool> released{false};
+};
+
+} // namespace
+
+TEST_CASE("SignalChain - stage management", "[audio]") {
+    SignalChain chain;
+
+    SECTION("Starts empty and passes audio through") {
+        REQUIRE(chain.getNumStages() == 0);
+        REQUIRE(chain.processSample(0.25f) == 0.25f);
+    }
+
+    SECTION("Adds, inserts and removes stages") {
+        REQUIRE(chain.addStage(std::make_unique<GainStage>(2.0f)) == 0);
+        chain.insertStage(0, std::make_unique<OffsetStage>(1.0f));
+        REQUIRE(chain.getNumStages() == 2);
+
+        // (0.5 + 1) * 2
+        REQUIRE(chain.processSample(0.5f) == 3.0f);
+
+        auto removed = chain.removeStage(0);
+        REQUIRE(removed != nullptr);
+        REQUIRE(chain.getNumStages() == 1);
+        REQUIRE(chain.processSample(0.5f) == 1.0f);
+    }
+
+    SECTION("Reorders stages") {
+        chain.addStage(std::make_unique<OffsetStage>(1.0f));
+        chain.addStage(std::make_unique<GainStage>(2.0f));
+        REQUIRE(chain.processSample(0.5f) == 3.0f);
+
+        chain.moveStage(1, 0);
+        // 0.5 * 2 + 1
+        REQUIRE(chain.processSample(0.5f) == 2.0f);
+    }
+
+    SECTION("Bypasses stages") {
+        chain.addStage(std::make_unique<GainStage>(2.0f));
+        chain.setStageBypassed(0, true);
+        REQUIRE(chain.isStageBypassed(0));
+        REQUIRE(chain.processSample(0.5f) == 0.5f);
+
+        chain.setStageBypassed(0, false);
+        REQUIRE(chain.processSample(0.5f) == 1.0f);
+    }
+
+    SECTION("Rejects invalid indices and overflow") {
+        REQUIRE_THROWS(chain.removeStage(0));
+        REQUIRE_THROWS(chain.insertStage(2, std::make_unique<GainStage>(1.0f)));
+
+        for (int i = 0; i < SignalChain::MAX_STAGES; ++i) {
+            chain.addStage(std::make_unique<GainStage>(1.0f));
+        }
+        REQUIRE_THROWS(chain.addStage(std::make_unique<GainStage>(1.0f)));
+    }
+
+    SECTION("Prepares stages with the chain sample rate") {
+        chain.prepare(48000.0);
+        chain.addStage(std::make_unique<GainStage>(1.0f));
+        auto* stage = dynamic_cast<GainStage*>(chain.getStage(0));
+        REQUIRE(stage != nullptr);
+        REQUIRE(stage->preparedRate == 48000.0);
+
+        chain.prepare(96000.0);
+        REQUIRE(stage->preparedRate == 96000.0);
+    }
+}
+
+TEST_CASE("SignalChain - block processing", "[audio]") {
+    SignalChain chain;
+    chain.addStage(std::make_unique<GainStage>(2.0f));
+    chain.addStage(std::make_unique<OffsetStage>(0.5f));
+
+    SECTION("Processes non-interleaved blocks larger than a sub-block") {
+        constexpr int numSamples = SignalChain::SUB_BLOCK_SIZE * 2 + 17;
+        std::vector<float> data(numSamples, 0.25f);
+        float* channels[] = {data.data()};
+
+        chain.processChannels(channels, 1, numSamples);
+
+        for (float sample : data) {
+            REQUIRE(sample == 1.0f);
+        }
+    }
+
+    SECTION("Every channel holds the output at any block size") {
+        chain.addStage(std::make_unique<StereoStage>());
+
+        constexpr int numChannels = 10;
+        for (const int numSamples : {64, SignalChain::SUB_BLOCK_SIZE * 2 + 17}) {
+            std::vector<std::vector<float>> data(numChannels, std::vector<float>(numSamples, 0.25f));
+            std::vector<float*> channels;
+            for (auto& channel : data) {
+                channels.push_back(channel.data());
+            }
+
+            chain.processChannels(channels.data(), numChannels, numSamples);
+
+            for (int channel = 0; channel < numChannels; ++channel) {
+                const float expected = channel % 2 == 0 ? 1.0f : -1.0f;
+                for (float sample : data[static_cast<size_t>(channel)]) {
+                    REQUIRE(sample == expected);
+                }
+            }
+        }
+    }
+
+    SECTION("Processes interleaved blocks through scratch") {
+        std::array<float, 6> buffer = {0.25f, 0.0f, 0.5f, 0.0f, 1.0f, 0.0f};
+        chain.processBlock(buffer.data(), 2, 3);
+
+        REQUIRE(buffer[0] == 1.0f);
+        REQUIRE(buffer[1] == 1.0f);
+        REQUIRE(buffer[2] == 1.5f);
+        REQUIRE(buffer[3] == 1.5f);
+        REQUIRE(buffer[4] == 2.5f);
+        REQUIRE(buffer[5] == 2.5f);
+    }
+}
+
+TEST_CASE("SignalChain - channel layouts", "[audio]") {
+    SignalChain chain;
+    std::array<float, 4> left = {0.5f, 0.5f, 0.5f, 0.5f};
+    std::array<float, 4> right{};
+    float* channels[] = {left.data(), right.data()};
+
+    SECTION("Mono stages run on one channel, copied out once at the end") {
+        auto stage = std::make_unique<CountingStage>(2.0f);
+        auto* counting = stage.get();
+        chain.addStage(std::move(stage));
+        REQUIRE(chain.getChannelLayout() == AudioProcessor::ChannelLayout::Mono);
+
+        chain.processChannels(channels, 2, 4);
+        REQUIRE(counting->lastNumChannels == 1);
+        REQUIRE(left[0] == 1.0f);
+        REQUIRE(right[3] == 1.0f);
+    }
+
+    SECTION("Fans out at the first stereo stage") {
+        auto first = std::make_unique<CountingStage>(2.0f);
+        auto stereo = std::make_unique<StereoStage>();
+        auto* counting = first.get();
+        auto* stereoStage = stereo.get();
+        chain.addStage(std::move(first));
+        chain.addStage(std::move(stereo));
+        REQUIRE(chain.getChannelLayout() == AudioProcessor::ChannelLayout::Stereo);
+
+        chain.processChannels(channels, 2, 4);
+        REQUIRE(counting->lastNumChannels == 1);
+        REQUIRE(stereoStage->lastNumChannels == 2);
+        REQUIRE(left[0] == 1.0f);
+        REQUIRE(right[0] == -1.0f);
+    }
+
+    SECTION("Mono stages after a stereo one get the downmix") {
+        // Intended: a mono stage has one channel of state, so the stereo
+        // image collapses to (L+R)/2 instead of running it on each side
+        chain.addStage(std::make_unique<StereoStage>(0.5f));
+        auto last = std::make_unique<CountingStage>(2.0f);
+        auto* counting = last.get();
+        chain.addStage(std::move(last));
+        REQUIRE(chain.getChannelLayout() == AudioProcessor::ChannelLayout::Stereo);
+
+        chain.processChannels(channels, 2, 4);
+        REQUIRE(counting->lastNumChannels == 1);
+        // (0.5 + 0.25) / 2, doubled, on both sides
+        REQUIRE(left[0] == 0.75f);
+        REQUIRE(right[0] == 0.75f);
+        REQUIRE(right[3] == 0.75f);
+
+        // Without the mono stage the image survives
+        chain.setStageBypassed(1, true);
+        std::fill(left.begin(), left.end(), 0.5f);
+        std::fill(right.begin(), right.end(), 0.5f);
+        chain.processChannels(channels, 2, 4);
+        REQUIRE(left[0] == 0.5f);
+        REQUIRE(right[0] == 0.25f);
+    }
+
+    SECTION("Stereo stages get one channel for a mono destination") {
+        auto stereo = std::make_unique<StereoStage>();
+        auto* stereoStage = stereo.get();
+        chain.addStage(std::move(stereo));
+
+        chain.processChannels(channels, 1, 4);
+        REQUIRE(stereoStage->lastNumChannels == 1);
+        REQUIRE(left[0] == 0.5f);
+    }
+}
+
+TEST_CASE("SignalChain - control thread", "[audio]") {
+    SignalChain chain;
+    auto blocking = std::make_unique<BlockingStage>();
+    auto* stage = blocking.get();
+    chain.addStage(std::move(blocking));
+
+    SECTION("Getters do not wait for the audio thread during an edit") {
+        std::vector<float> data(64, 0.0f);
+        std::thread audio([&] {
+            float* channels[] = {data.data()};
+            chain.processChannels(channels, 1, 64);
+        });
+        while (!stage->entered.load()) {
+            std::this_thread::yield();
+        }
+
+        // Blocks in the edit until the audio thread leaves its block
+        std::thread editor([&] { chain.addStage(std::make_unique<GainStage>(1.0f)); });
+
+        // Releases the audio thread eventually, so a regression fails instead of hanging
+        std::thread watchdog([&] {
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+            while (!stage->released.load() && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            stage->released.store(true);
+        });
+
+        while (chain.getNumStages() != 2 && !stage->released.load()) {
+            std::this_thread::yield();
+        }
+        const bool answeredDuringBlock = chain.getNumStages() == 2 && !stage->released.load();
+
+        stage->released.store(true);
+        audio.join();
+        editor.join();
+        watchdog.join();
+        REQUIRE(answeredDuringBlock);
+    }
+}
+
+TEST_CASE("SignalChain - latency", "[audio]") {
+    SignalChain chain;
+    REQUIRE(chain.getLatencySamples() == 0);
+
+    chain.addStage(std::make_unique<LatentStage>(12));
+    chain.addStage(std::make_unique<GainStage>(1.0f));
+    chain.addStage(std::make_unique<LatentStage>(30));
+
+    SECTION("Sums stage latencies") {
+        REQUIRE(chain.getLatencySamples() == 42);
+    }
+
+    SECTION("Ignores bypassed stages") {
+        chain.setStageBypassed(2, true);
+        REQUIRE(chain.getLatencySamples() == 12);
+
+        chain.setStageBypassed(2, false);
+        REQUIRE(chain.getLatencySamples() == 42);
+    }
+
+    SECTION("Follows stage edits") {
+        chain.removeStage(0);
+        REQUIRE(chain.getLatencySamples() == 30);
+
+        chain.insertStage(0, std::make_unique<LatentStage>(5));
+        REQUIRE(chain.getLatencySamples() == 35);
+    }
+
+    SECTION("Follows nested chains edited in place") {
+        // Two levels deep, so the change has to travel through the middle
+        auto middle = std::make_unique<SignalChain>();
+        auto inner = std::make_unique<SignalChain>();
+        auto* middleChain = middle.get();
+        auto* innerChain = inner.get();
+        middleChain->addStage(std::move(inner));
+        chain.addStage(std::move(middle));
+        REQUIRE(chain.getLatencySamples() == 42);
+
+        innerChain->addStage(std::make_unique<LatentStage>(8));
+        REQUIRE(middleChain->getLatencySamples() == 8);
+        REQUIRE(chain.getLatencySamples() == 50);
+
+        innerChain->setStageBypassed(0, true);
+        REQUIRE(chain.getLatencySamples() == 42);
+    }
+}
+
+TEST_CASE("SignalChain - stage profiling", "[audio]") {
+    SignalChain chain;
+    chain.addStage(std::make_unique<GainStage>(1.0f));
+    chain.addStage(std::make_unique<GainStage>(1.0f));
+    chain.setStageBypassed(1, true);
+
+    std::vector<float> data(64, 0.5f);
+    float* channels[] = {data.data()};
+
+    SECTION("Records time and samples for active stages") {
+        chain.processChannels(channels, 1, 64);
+        chain.processChannels(channels, 1, 64);
+
+        auto statistics = chain.getStageStatistics();
+        REQUIRE(statistics.size() == 2);
+        REQUIRE(statistics[0].name == "Processor");
+        REQUIRE(statistics[0].stats.numBlocks == 2);
+        REQUIRE(statistics[0].stats.numSamples == 128);
+        REQUIRE_FALSE(statistics[0].bypassed);
+
+        // Bypassed stages are not timed
+        REQUIRE(statistics[1].bypassed);
+        REQUIRE(statistics[1].stats.numBlocks == 0);
+    }
+
+    SECTION("Can be disabled") {
+        chain.setProfilingEnabled(false);
+        chain.processChannels(channels, 1, 64);
+        REQUIRE(chain.getStageStatistics()[0].stats.numBlocks == 0);
+    }
+
+    SECTION("Can be reset") {
+        chain.processChannels(channels, 1, 64);
+        chain.resetStageStatistics();
+        chain.processChannels(channels, 1, 32);
+        REQUIRE(chain.getStageStatistics()[0].stats.numSamples == 32);
+    }
+}
+
+} // namespace finirig::audio::tests
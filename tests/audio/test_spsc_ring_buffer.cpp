@@ -0,0 +1,112 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/audio/SpscRingBuffer.h"
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace finirig::audio::tests {
+
+TEST_CASE("SpscRingBuffer - single thread", "[audio]") {
+    SpscRingBuffer<float> ring(6);
+    std::array<float, 8> items = {1, 2, 3, 4, 5, 6, 7, 8};
+    std::array<float, 8> out{};
+
+    SECTION("Rounds the capacity up to a power of two") {
+        REQUIRE(ring.getCapacity() == 8);
+        REQUIRE(ring.getFreeSpace() == 8);
+        REQUIRE(ring.getNumReady() == 0);
+        REQUIRE_THROWS_AS(SpscRingBuffer<float>(0), std::invalid_argument);
+    }
+
+    SECTION("Reads back what was written, in order") {
+        REQUIRE(ring.write(items.data(), 3));
+        REQUIRE(ring.getNumReady() == 3);
+        REQUIRE(ring.read(out.data(), 2));
+        REQUIRE(out[0] == 1.0f);
+        REQUIRE(out[1] == 2.0f);
+        REQUIRE(ring.getNumReady() == 1);
+    }
+
+    SECTION("Writes and reads are all-or-nothing") {
+        REQUIRE(ring.write(items.data(), 8));
+        REQUIRE_FALSE(ring.write(items.data(), 1));
+
+        REQUIRE(ring.read(out.data(), 6));
+        REQUIRE_FALSE(ring.read(out.data(), 3));
+        REQUIRE(ring.getNumReady() == 2);
+    }
+
+    SECTION("Wraps around the end of the buffer") {
+        REQUIRE(ring.write(items.data(), 6));
+        REQUIRE(ring.read(out.data(), 6));
+
+        // Starts at slot 6, wraps after two items
+        REQUIRE(ring.write(items.data(), 5));
+        REQUIRE(ring.read(out.data(), 5));
+        for (int i = 0; i < 5; ++i) {
+            REQUIRE(out[static_cast<size_t>(i)] == items[static_cast<size_t>(i)]);
+        }
+    }
+
+    SECTION("Discards the oldest items") {
+        REQUIRE(ring.write(items.data(), 4));
+        REQUIRE(ring.discard(3) == 3);
+        REQUIRE(ring.read(out.data(), 1));
+        REQUIRE(out[0] == 4.0f);
+        REQUIRE(ring.discard(5) == 0);
+    }
+
+    SECTION("Holds structs as single items") {
+        struct Frame {
+            float peak;
+            std::int64_t position;
+        };
+        SpscRingBuffer<Frame> frames(4);
+        const Frame frame{0.5f, 42};
+        REQUIRE(frames.write(&frame, 1));
+
+        Frame result{};
+        REQUIRE(frames.read(&result, 1));
+        REQUIRE(result.peak == 0.5f);
+        REQUIRE(result.position == 42);
+    }
+}
+
+TEST_CASE("SpscRingBuffer - producer and consumer threads", "[audio]") {
+    constexpr int numItems = 200000;
+    SpscRingBuffer<int> ring(64);
+
+    std::thread producer([&] {
+        std::array<int, 7> block{};
+        for (int next = 0; next < numItems;) {
+            const int count = std::min(static_cast<int>(block.size()), numItems - next);
+            for (int i = 0; i < count; ++i) {
+                block[static_cast<size_t>(i)] = next + i;
+            }
+            if (ring.write(block.data(), static_cast<size_t>(count))) {
+                next += count;
+            }
+        }
+    });
+
+    // Every item arrives once, in order
+    std::array<int, 5> block{};
+    bool inOrder = true;
+    for (int expected = 0; expected < numItems;) {
+        const int count = std::min(static_cast<int>(block.size()), numItems - expected);
+        if (ring.read(block.data(), static_cast<size_t>(count))) {
+            for (int i = 0; i < count; ++i) {
+                inOrder = inOrder && block[static_cast<size_t>(i)] == expected + i;
+            }
+            expected += count;
+        }
+    }
+    producer.join();
+
+    REQUIRE(inOrder);
+    REQUIRE(ring.getNumReady() == 0);
+}
+
+} // namespace finirig::audio::tests
@@ -0,0 +1,89 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/audio/WorkStealingQueue.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace finirig::audio::tests {
+
+TEST_CASE("WorkStealingQueue - single thread", "[audio]") {
+    WorkStealingQueue<int, 8> queue;
+    int value = 0;
+
+    SECTION("Starts empty") {
+        REQUIRE(queue.empty());
+        REQUIRE_FALSE(queue.pop(value));
+        REQUIRE_FALSE(queue.steal(value));
+    }
+
+    SECTION("Owner pops newest first, thieves take oldest first") {
+        for (int i = 1; i <= 3; ++i) {
+            REQUIRE(queue.push(i));
+        }
+        REQUIRE(queue.size() == 3);
+
+        REQUIRE(queue.pop(value));
+        REQUIRE(value == 3);
+        REQUIRE(queue.steal(value));
+        REQUIRE(value == 1);
+        REQUIRE(queue.pop(value));
+        REQUIRE(value == 2);
+        REQUIRE(queue.empty());
+    }
+
+    SECTION("Refuses pushes beyond capacity") {
+        for (int i = 0; i < 8; ++i) {
+            REQUIRE(queue.push(i));
+        }
+        REQUIRE_FALSE(queue.push(8));
+
+        REQUIRE(queue.steal(value));
+        REQUIRE(queue.push(8));
+    }
+}
+
+TEST_CASE("WorkStealingQueue - concurrent stealing", "[audio]") {
+    constexpr int numItems = 20000;
+    constexpr int numThieves = 3;
+    WorkStealingQueue<int, 64> queue;
+
+    std::vector<std::atomic<int>> taken(numItems);
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> thieves;
+    for (int i = 0; i < numThieves; ++i) {
+        thieves.emplace_back([&] {
+            int value = 0;
+            while (!done.load(std::memory_order_acquire) || !queue.empty()) {
+                if (queue.steal(value)) {
+                    taken[static_cast<size_t>(value)].fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    // The owner pushes everything and pops some back, racing the thieves
+    int value = 0;
+    for (int item = 0; item < numItems;) {
+        if (queue.push(item)) {
+            ++item;
+        }
+        if (item % 3 == 0 && queue.pop(value)) {
+            taken[static_cast<size_t>(value)].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    while (queue.pop(value)) {
+        taken[static_cast<size_t>(value)].fetch_add(1, std::memory_order_relaxed);
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& thief : thieves) {
+        thief.join();
+    }
+
+    // Every item taken exactly once
+    for (const auto& count : taken) {
+        REQUIRE(count.load() == 1);
+    }
+}
+
+} // namespace finirig::audio::tests
@@ -0,0 +1,61 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/dsp/LookupTable.h"
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace finirig::dsp::tests {
+
+namespace {
+
+float tanhCurve(float x) {
+    return std::tanh(x);
+}
+
+} // namespace
+
+TEST_CASE("LookupTable - construction", "[dsp]") {
+    SECTION("Rejects degenerate tables") {
+        REQUIRE_THROWS_AS(LookupTable(tanhCurve, -1.0f, 1.0f, 1), std::invalid_argument);
+        REQUIRE_THROWS_AS(LookupTable(tanhCurve, 1.0f, 1.0f), std::invalid_argument);
+    }
+
+    SECTION("Reports its range and size") {
+        const LookupTable table(tanhCurve, -4.0f, 4.0f, 513);
+        REQUIRE(table.getMinInput() == -4.0f);
+        REQUIRE(table.getMaxInput() == 4.0f);
+        REQUIRE(table.getSize() == 513);
+    }
+}
+
+TEST_CASE("LookupTable - interpolation", "[dsp]") {
+    const LookupTable table(tanhCurve, -8.0f, 8.0f);
+
+    SECTION("Matches the curve between points") {
+        float maxError = 0.0f;
+        for (float x = -7.9f; x < 7.9f; x += 0.0137f) {
+            maxError = std::max(maxError, std::abs(table(x) - std::tanh(x)));
+        }
+        REQUIRE(maxError < 1e-5f);
+    }
+
+    SECTION("Zero lands on a table point") {
+        REQUIRE(table(0.0f) == 0.0f);
+    }
+
+    SECTION("Clamps outside the range") {
+        REQUIRE(table(100.0f) == table(8.0f));
+        REQUIRE(table(-100.0f) == table(-8.0f));
+    }
+
+    SECTION("Block processing matches single lookups") {
+        std::vector<float> block = {-9.0f, -1.5f, -0.25f, 0.0f, 0.3f, 2.0f, 9.0f};
+        const auto input = block;
+        table.process(block.data(), static_cast<int>(block.size()));
+        for (size_t i = 0; i < block.size(); ++i) {
+            REQUIRE(block[i] == table(input[i]));
+        }
+    }
+}
+
+} // namespace finirig::dsp::tests
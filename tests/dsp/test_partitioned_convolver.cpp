@@ -0,0 +1,124 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/dsp/PartitionedConvolver.h"
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace finirig::dsp::tests {
+
+namespace {
+
+std::vector<float> makeImpulseResponse(int length) {
+    // Decaying pseudo-random IR, deterministic
+    std::vector<float> ir(static_cast<size_t>(length));
+    unsigned int seed = 12345u;
+    for (int i = 0; i < length; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        const float noise = static_cast<float>(seed >> 8) / static_cast<float>(1u << 24) - 0.5f;
+        ir[static_cast<size_t>(i)] = noise * std::exp(-4.0f * static_cast<float>(i) / static_cast<float>(length));
+    }
+    return ir;
+}
+
+std::vector<float> makeInput(int length) {
+    std::vector<float> input(static_cast<size_t>(length));
+    for (int i = 0; i < length; ++i) {
+        input[static_cast<size_t>(i)] = std::sin(0.07f * static_cast<float>(i)) + 0.3f * std::sin(0.9f * static_cast<float>(i));
+    }
+    return input;
+}
+
+std::vector<float> directConvolution(const std::vector<float>& input, const std::vector<float>& ir) {
+    std::vector<float> output(input.size(), 0.0f);
+    for (size_t n = 0; n < input.size(); ++n) {
+        double sum = 0.0;
+        for (size_t k = 0; k < ir.size() && k <= n; ++k) {
+            sum += static_cast<double>(ir[k]) * input[n - k];
+        }
+        output[n] = static_cast<float>(sum);
+    }
+    return output;
+}
+
+void processInBlocks(PartitionedConvolver& convolver, std::vector<float>& data, int blockSize) {
+    for (size_t offset = 0; offset < data.size(); offset += static_cast<size_t>(blockSize)) {
+        const int count = std::min(blockSize, static_cast<int>(data.size() - offset));
+        convolver.process(data.data() + offset, count);
+    }
+}
+
+} // namespace
+
+TEST_CASE("PartitionedConvolver - construction", "[dsp]") {
+    SECTION("Rejects partition sizes that are not powers of two") {
+        REQUIRE_THROWS_AS(PartitionedConvolver(48), std::invalid_argument);
+        REQUIRE_THROWS_AS(PartitionedConvolver(4), std::invalid_argument);
+    }
+
+    SECTION("Splits the IR into head and tail partitions") {
+        PartitionedConvolver convolver(64);
+        const auto ir = makeImpulseResponse(1000);
+        convolver.setImpulseResponse(ir.data(), static_cast<int>(ir.size()));
+        REQUIRE(convolver.getImpulseResponseLength() == 1000);
+        REQUIRE(convolver.getNumTailPartitions() == 15); // (1000 - 64) / 64 rounded up
+    }
+
+    SECTION("Short IRs need no tail") {
+        PartitionedConvolver convolver(64);
+        const auto ir = makeImpulseResponse(40);
+        convolver.setImpulseResponse(ir.data(), static_cast<int>(ir.size()));
+        REQUIRE(convolver.getNumTailPartitions() == 0);
+    }
+}
+
+TEST_CASE("PartitionedConvolver - matches direct convolution", "[dsp]") {
+    const auto input = makeInput(3000);
+
+    for (int irLength : {1, 64, 65, 500, 2048}) {
+        const auto ir = makeImpulseResponse(irLength);
+        const auto reference = directConvolution(input, ir);
+
+        // Block sizes smaller, equal and unrelated to the partition size
+        for (int blockSize : {1, 32, 64, 100, 512}) {
+            PartitionedConvolver convolver(64);
+            convolver.setImpulseResponse(ir.data(), irLength);
+
+            auto output = input;
+            processInBlocks(convolver, output, blockSize);
+
+            for (size_t n = 0; n < output.size(); ++n) {
+                REQUIRE(std::abs(output[n] - reference[n]) < 1.0e-4f);
+            }
+        }
+    }
+}
+
+TEST_CASE("PartitionedConvolver - zero latency", "[dsp]") {
+    PartitionedConvolver convolver(64);
+    const std::vector<float> ir = {1.0f};
+    convolver.setImpulseResponse(ir.data(), 1);
+
+    std::vector<float> data = {0.25f, -0.5f, 0.75f};
+    convolver.process(data.data(), static_cast<int>(data.size()));
+    REQUIRE(data[0] == 0.25f);
+    REQUIRE(data[1] == -0.5f);
+    REQUIRE(data[2] == 0.75f);
+}
+
+TEST_CASE("PartitionedConvolver - reset clears the tail", "[dsp]") {
+    PartitionedConvolver convolver(32);
+    const auto ir = makeImpulseResponse(400);
+    convolver.setImpulseResponse(ir.data(), static_cast<int>(ir.size()));
+
+    auto data = makeInput(256);
+    convolver.process(data.data(), static_cast<int>(data.size()));
+    convolver.reset();
+
+    std::vector<float> silence(512, 0.0f);
+    convolver.process(silence.data(), static_cast<int>(silence.size()));
+    for (float sample : silence) {
+        REQUIRE(sample == 0.0f);
+    }
+}
+
+} // namespace finirig::dsp::tests
@@ -0,0 +1,106 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "finirig/dsp/PitchDetector.h"
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace finirig::dsp::tests {
+
+using Catch::Matchers::WithinAbs;
+
+namespace {
+
+constexpr double SAMPLE_RATE = 48000.0;
+
+// Plucked-string-like tone: fundamental plus decaying harmonics
+std::vector<float> makeString(double frequency, int numSamples) {
+    std::vector<float> samples(static_cast<size_t>(numSamples));
+    for (int i = 0; i < numSamples; ++i) {
+        const double phase = 2.0 * std::numbers::pi * frequency * i / SAMPLE_RATE;
+        samples[static_cast<size_t>(i)] = static_cast<float>(
+            0.4 * std::sin(phase) + 0.3 * std::sin(2.0 * phase) + 0.15 * std::sin(3.0 * phase)
+        );
+    }
+    return samples;
+}
+
+PitchDetector::Result detect(PitchDetector& detector, const std::vector<float>& samples) {
+    detector.process(samples.data(), static_cast<int>(samples.size()));
+    return detector.getResult();
+}
+
+} // namespace
+
+TEST_CASE("PitchDetector - guitar range", "[dsp]") {
+    PitchDetector detector;
+    detector.prepare(SAMPLE_RATE);
+    const int length = 4 * detector.getWindowSize();
+
+    SECTION("Rejects an empty range") {
+        REQUIRE_THROWS_AS(PitchDetector(100.0f, 100.0f), std::invalid_argument);
+        REQUIRE_THROWS_AS(PitchDetector(0.0f, 100.0f), std::invalid_argument);
+    }
+
+    SECTION("Tracks open strings to within a cent") {
+        for (const double frequency : {82.41, 110.0, 146.83, 196.0, 246.94, 329.63}) {
+            detector.prepare(SAMPLE_RATE);
+            const auto result = detect(detector, makeString(frequency, length));
+            REQUIRE(result.voiced);
+            REQUIRE(result.confidence > 0.8f);
+            const double cents = 1200.0 * std::log2(result.frequency / frequency);
+            REQUIRE_THAT(cents, WithinAbs(0.0, 1.0));
+        }
+    }
+
+    SECTION("A strong second harmonic does not cause an octave error") {
+        std::vector<float> samples(static_cast<size_t>(length));
+        for (int i = 0; i < length; ++i) {
+            const double phase = 2.0 * std::numbers::pi * 98.0 * i / SAMPLE_RATE;
+            samples[static_cast<size_t>(i)] = static_cast<float>(0.2 * std::sin(phase) + 0.5 * std::sin(2.0 * phase));
+        }
+        const auto result = detect(detector, samples);
+        REQUIRE(result.voiced);
+        REQUIRE_THAT(result.frequency, WithinAbs(98.0, 0.5));
+    }
+
+    SECTION("Silence and noise are unvoiced") {
+        REQUIRE_FALSE(detect(detector, std::vector<float>(static_cast<size_t>(length), 0.0f)).voiced);
+
+        std::vector<float> noise(static_cast<size_t>(length));
+        std::uint32_t state = 12345u;
+        for (auto& sample : noise) {
+            state = state * 1664525u + 1013904223u;
+            sample = static_cast<float>(state >> 8) / 16777216.0f - 0.5f;
+        }
+        REQUIRE_FALSE(detect(detector, noise).voiced);
+    }
+}
+
+TEST_CASE("PitchDetector - note mapping", "[dsp]") {
+    SECTION("Concert A and its neighbours") {
+        const auto a4 = PitchDetector::toNote(440.0f);
+        REQUIRE(a4.midiNote == 69);
+        REQUIRE_THAT(a4.cents, WithinAbs(0.0, 1e-3));
+        REQUIRE(std::string(PitchDetector::getNoteName(a4.midiNote)) == "A");
+
+        const auto lowE = PitchDetector::toNote(82.41f);
+        REQUIRE(lowE.midiNote == 40);
+        REQUIRE(std::string(PitchDetector::getNoteName(lowE.midiNote)) == "E");
+    }
+
+    SECTION("Cents offset and reference pitch") {
+        const auto sharp = PitchDetector::toNote(440.0f * std::pow(2.0f, 10.0f / 1200.0f));
+        REQUIRE(sharp.midiNote == 69);
+        REQUIRE_THAT(sharp.cents, WithinAbs(10.0, 0.01));
+
+        const auto flat = PitchDetector::toNote(440.0f, 442.0f);
+        REQUIRE(flat.midiNote == 69);
+        REQUIRE(flat.cents < -7.0f);
+        REQUIRE(std::string(PitchDetector::getNoteName(61)) == "C#");
+    }
+}
+
+} // namespace finirig::dsp::tests
@@ -0,0 +1,57 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/dsp/Resampling.h"
+#include "TestUtils.h"
+#include <cmath>
+#include <vector>
+
+namespace finirig::dsp::tests {
+
+using finirig::tests::makeSine;
+
+TEST_CASE("Resampling - resample", "[dsp]") {
+    SECTION("Matching rates copy the input") {
+        const std::vector<float> input = {0.1f, -0.2f, 0.3f};
+        REQUIRE(resample(input.data(), 3, 48000.0, 48000.0) == input);
+    }
+
+    SECTION("Invalid input gives an empty result") {
+        const std::vector<float> input = {1.0f};
+        REQUIRE(resample(input.data(), 0, 44100.0, 48000.0).empty());
+        REQUIRE(resample(input.data(), 1, 0.0, 48000.0).empty());
+        REQUIRE(resample(input.data(), 1, 44100.0, -1.0).empty());
+    }
+
+    SECTION("Length scales with the rate ratio") {
+        const std::vector<float> input(441, 0.0f);
+        REQUIRE(resample(input.data(), 441, 44100.0, 48000.0).size() == 480);
+        REQUIRE(resample(input.data(), 441, 44100.0, 22050.0).size() == 221);
+    }
+
+    SECTION("A sine keeps its frequency and level") {
+        // 1 kHz at 44.1 kHz, compared away from the edges against the ideal
+        // 1 kHz at 48 kHz
+        const auto input = makeSine(1000.0, 44100.0, 4410);
+        const auto output = resample(input.data(), 4410, 44100.0, 48000.0);
+        const auto expected = makeSine(1000.0, 48000.0, static_cast<int>(output.size()));
+
+        float maxError = 0.0f;
+        for (size_t n = 200; n + 200 < output.size(); ++n) {
+            maxError = std::max(maxError, std::abs(output[n] - expected[n]));
+        }
+        REQUIRE(maxError < 1e-3f);
+    }
+
+    SECTION("Downsampling removes content above the new Nyquist") {
+        // 15 kHz cannot exist at 22.05 kHz
+        const auto input = makeSine(15000.0, 44100.0, 4410);
+        const auto output = resample(input.data(), 4410, 44100.0, 22050.0);
+
+        float peak = 0.0f;
+        for (size_t n = 200; n + 200 < output.size(); ++n) {
+            peak = std::max(peak, std::abs(output[n]));
+        }
+        REQUIRE(peak < 0.01f);
+    }
+}
+
+} // namespace finirig::dsp::tests
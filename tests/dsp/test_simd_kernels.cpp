@@ -0,0 +1,110 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/dsp/SimdKernels.h"
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace finirig::dsp::tests {
+
+namespace {
+
+// Original branchy clipper the kernels must reproduce
+float referenceSoftClip(float x) {
+    if (std::abs(x) < 3.0f) {
+        float x2 = x * x;
+        return x * (27.0f + x2) / (27.0f + 9.0f * x2);
+    }
+    return x > 0.0f ? 1.0f : -1.0f;
+}
+
+std::vector<float> makeRamp(int numSamples) {
+    std::vector<float> data(static_cast<size_t>(numSamples));
+    for (int i = 0; i < numSamples; ++i) {
+        data[static_cast<size_t>(i)] = -1.0f + 2.0f * static_cast<float>(i) / static_cast<float>(numSamples - 1);
+    }
+    return data;
+}
+
+} // namespace
+
+TEST_CASE("SimdKernels - soft clip reference", "[dsp]") {
+    SECTION("Matches the original clipper") {
+        for (float x = -6.0f; x <= 6.0f; x += 0.01f) {
+            REQUIRE(std::abs(softClip(x) - referenceSoftClip(x)) < 1.0e-7f);
+        }
+    }
+
+    SECTION("Is continuous at the threshold") {
+        REQUIRE(softClip(3.0f) == 1.0f);
+        REQUIRE(softClip(-3.0f) == -1.0f);
+    }
+}
+
+TEST_CASE("SimdKernels - drive/clip kernels match scalar", "[dsp]") {
+    constexpr std::array<SimdLevel, 4> levels = {
+        SimdLevel::Scalar, SimdLevel::Sse2, SimdLevel::Avx, SimdLevel::Neon
+    };
+
+    // Odd length exercises the scalar tail of every vector kernel
+    constexpr int numSamples = 1027;
+    constexpr float gain = 7.3f;
+    const auto input = makeRamp(numSamples);
+
+    auto reference = input;
+    for (auto& sample : reference) {
+        sample = referenceSoftClip(sample * gain);
+    }
+
+    for (auto level : levels) {
+        if (!isSimdLevelSupported(level)) {
+            continue;
+        }
+
+        auto data = input;
+        getDriveClipKernel(level)(data.data(), numSamples, gain);
+
+        for (int i = 0; i < numSamples; ++i) {
+            REQUIRE(std::abs(data[static_cast<size_t>(i)] - reference[static_cast<size_t>(i)]) < 1.0e-6f);
+        }
+    }
+}
+
+TEST_CASE("SimdKernels - dot product kernels match scalar", "[dsp]") {
+    constexpr std::array<SimdLevel, 4> levels = {
+        SimdLevel::Scalar, SimdLevel::Sse2, SimdLevel::Avx, SimdLevel::Neon
+    };
+
+    for (int numSamples : {1, 7, 16, 31, 63}) {
+        const auto a = makeRamp(numSamples + 1);
+        const auto b = makeRamp(numSamples + 2);
+
+        double reference = 0.0;
+        for (int i = 0; i < numSamples; ++i) {
+            reference += static_cast<double>(a[static_cast<size_t>(i)]) * b[static_cast<size_t>(i)];
+        }
+
+        for (auto level : levels) {
+            if (!isSimdLevelSupported(level)) {
+                continue;
+            }
+            const float result = getDotProductKernel(level)(a.data(), b.data(), numSamples);
+            REQUIRE(std::abs(result - reference) < 1.0e-5);
+        }
+    }
+}
+
+TEST_CASE("SimdKernels - dispatch", "[dsp]") {
+    SECTION("Detected level is supported") {
+        REQUIRE(isSimdLevelSupported(getSimdLevel()));
+        REQUIRE(isSimdLevelSupported(SimdLevel::Scalar));
+    }
+
+    SECTION("Unsupported levels fall back to a working kernel") {
+        std::array<float, 3> data = {0.1f, 10.0f, -10.0f};
+        getDriveClipKernel(SimdLevel::Neon)(data.data(), 3, 1.0f);
+        REQUIRE(data[1] == 1.0f);
+        REQUIRE(data[2] == -1.0f);
+    }
+}
+
+} // namespace finirig::dsp::tests
@@ -0,0 +1,69 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "finirig/dsp/SpectrumAnalyzer.h"
+#include "TestUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace finirig::dsp::tests {
+
+using Catch::Matchers::WithinAbs;
+using finirig::tests::makeSine;
+
+TEST_CASE("SpectrumAnalyzer - frames and levels", "[dsp]") {
+    constexpr double sampleRate = 48000.0;
+    SpectrumAnalyzer analyzer(10, 0.0f); // 1024 points, no averaging
+
+    SECTION("Rejects bad settings") {
+        REQUIRE_THROWS_AS(SpectrumAnalyzer(5), std::invalid_argument);
+        REQUIRE_THROWS_AS(SpectrumAnalyzer(10, 1.0f), std::invalid_argument);
+    }
+
+    SECTION("Analyses a frame every half frame of input") {
+        REQUIRE(analyzer.getNumBins() == 513);
+        std::vector<float> silence(1000, 0.0f);
+        REQUIRE(analyzer.process(silence.data(), 1000) == 0);
+        REQUIRE(analyzer.process(silence.data(), 24) == 1);
+        REQUIRE(analyzer.process(silence.data(), 512) == 1);
+        REQUIRE(analyzer.getFrameCount() == 2);
+        REQUIRE(analyzer.getMagnitudesDb()[10] == SpectrumAnalyzer::MIN_DB);
+    }
+
+    SECTION("A bin-centred sine reads its amplitude in its bin") {
+        // Bin 64 at 1024 points is exactly 3 kHz
+        const auto sine = makeSine(3000.0, sampleRate, 4096, 0.5f);
+        analyzer.process(sine.data(), static_cast<int>(sine.size()));
+
+        const auto& db = analyzer.getMagnitudesDb();
+        const auto loudest = std::max_element(db.begin(), db.end()) - db.begin();
+        REQUIRE(loudest == 64);
+        REQUIRE_THAT(analyzer.getBinFrequency(64, sampleRate), WithinAbs(3000.0, 1e-9));
+        REQUIRE_THAT(db[64], WithinAbs(20.0 * std::log10(0.5), 0.05));
+
+        // Hann sidelobes are far down a few bins away
+        REQUIRE(db[72] < db[64] - 60.0f);
+    }
+
+    SECTION("Averaging smooths a level change") {
+        SpectrumAnalyzer averaged(10, 0.8f);
+        const auto loud = makeSine(3000.0, sampleRate, 4096, 1.0f);
+        averaged.process(loud.data(), static_cast<int>(loud.size()));
+        const float settled = averaged.getMagnitudesDb()[64];
+
+        std::vector<float> silence(512, 0.0f);
+        averaged.process(silence.data(), 512);
+        averaged.process(silence.data(), 512);
+        averaged.process(silence.data(), 512);
+        const float decayed = averaged.getMagnitudesDb()[64];
+        REQUIRE(decayed < settled);
+        REQUIRE(decayed > settled - 20.0f);
+
+        averaged.reset();
+        REQUIRE(averaged.getFrameCount() == 0);
+        REQUIRE(averaged.getMagnitudesDb()[64] == SpectrumAnalyzer::MIN_DB);
+    }
+}
+
+} // namespace finirig::dsp::tests
@@ -0,0 +1,192 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/pedals/DiodeClipperPedal.h"
+#include "TestUtils.h"
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+namespace finirig::pedals::tests {
+
+using finirig::tests::makeSine;
+using finirig::tests::process;
+using finirig::tests::settledRms;
+
+namespace {
+
+constexpr double SAMPLE_RATE = 48000.0;
+
+// Circuit values of DiodeClipperPedal: full scale is 1 V into 2.2 kOhm,
+// the output is the capacitor voltage times 1.4 x level
+constexpr double SERIES_RESISTANCE = 2200.0;
+constexpr double OUTPUT_SCALE = 1.4;
+
+// Amplitude of one frequency (in cycles per sample) over the last numSamples
+double harmonicLevel(const std::vector<float>& signal, double cyclesPerSample, size_t numSamples) {
+    double real = 0.0;
+    double imaginary = 0.0;
+    for (size_t n = signal.size() - numSamples; n < signal.size(); ++n) {
+        const double angle = 2.0 * std::numbers::pi * cyclesPerSample * static_cast<double>(n);
+        real += signal[n] * std::cos(angle);
+        imaginary += signal[n] * std::sin(angle);
+    }
+    return 2.0 * std::hypot(real, imaginary) / static_cast<double>(numSamples);
+}
+
+// Reference: the same RC + diode pair circuit, trapezoidal rule (which is
+// what the WDF capacitor discretises to), each step solved by Newton
+// iteration in double precision
+std::vector<float> newtonClipper(const std::vector<float>& sourceVoltage, double capacitance, double outputGain) {
+    const auto model = wdf::DiodeModel::silicon();
+    const double saturationCurrent = model.saturationCurrent;
+    const double thermalVoltage = model.thermalVoltage;
+    const double step = 1.0 / (2.0 * SAMPLE_RATE * capacitance);
+
+    // Capacitor current for a capacitor voltage v
+    const auto current = [&](double v, double source) {
+        return (source - v) / SERIES_RESISTANCE - 2.0 * saturationCurrent * std::sinh(v / thermalVoltage);
+    };
+
+    std::vector<float> output(sourceVoltage.size());
+    double v = 0.0;
+    double previousCurrent = 0.0;
+    for (size_t n = 0; n < sourceVoltage.size(); ++n) {
+        const double source = sourceVoltage[n];
+        const double start = v;
+        for (int iteration = 0; iteration < 50; ++iteration) {
+            const double error = v - start - step * (current(v, source) + previousCurrent);
+            const double slope = 1.0 + step * (1.0 / SERIES_RESISTANCE
+                + 2.0 * saturationCurrent / thermalVoltage * std::cosh(v / thermalVoltage));
+            v -= error / slope;
+        }
+        previousCurrent = current(v, source);
+        output[n] = static_cast<float>(v * outputGain);
+    }
+    return output;
+}
+
+float peakOf(const std::vector<float>& signal) {
+    float peak = 0.0f;
+    for (size_t n = signal.size() / 2; n < signal.size(); ++n) {
+        peak = std::max(peak, std::abs(signal[n]));
+    }
+    return peak;
+}
+
+} // namespace
+
+TEST_CASE("DiodeClipperPedal - parameter setting", "[pedals]") {
+    DiodeClipperPedal pedal;
+
+    SECTION("Clamps controls") {
+        pedal.setDrive(1.5f);
+        pedal.setTone(-0.5f);
+        pedal.setLevel(0.25f);
+        REQUIRE(pedal.getDrive() == 1.0f);
+        REQUIRE(pedal.getTone() == 0.0f);
+        REQUIRE(pedal.getLevel() == 0.25f);
+        REQUIRE(pedal.getName() == "Diode Clipper");
+    }
+}
+
+TEST_CASE("DiodeClipperPedal - processing", "[pedals]") {
+    DiodeClipperPedal pedal;
+    pedal.prepare(SAMPLE_RATE);
+
+    SECTION("Small signals stay below the knee and pass linearly") {
+        pedal.setDrive(0.0f);
+        pedal.setLevel(1.0f);
+        pedal.reset();
+        const auto input = makeSine(100.0, SAMPLE_RATE, 9600, 0.01f);
+        const float gain = settledRms(process(pedal, input)) / settledRms(input);
+        REQUIRE(std::abs(gain - OUTPUT_SCALE) < 0.01 * OUTPUT_SCALE);
+    }
+
+    SECTION("Clipping level is set by the diode knee") {
+        pedal.setDrive(1.0f);
+        pedal.setLevel(1.0f);
+        pedal.reset();
+        const float hot = peakOf(process(pedal, makeSine(110.0, SAMPLE_RATE, 9600, 0.25f)));
+        pedal.reset();
+        const float hotter = peakOf(process(pedal, makeSine(110.0, SAMPLE_RATE, 9600, 1.0f)));
+
+        // 25 V and 100 V into the resistor, yet the capacitor stops at a
+        // silicon knee and four times the input barely moves it
+        REQUIRE(hot / OUTPUT_SCALE > 0.5);
+        REQUIRE(hotter / OUTPUT_SCALE < 0.9);
+        REQUIRE(hotter < 1.15f * hot);
+    }
+
+    SECTION("Clipping is odd-symmetric") {
+        pedal.setDrive(1.0f);
+        pedal.reset();
+        // 375 Hz: exactly 128 samples per cycle
+        const auto input = makeSine(375.0, SAMPLE_RATE, 9600, 0.5f);
+        const auto positive = process(pedal, input);
+
+        auto inverted = input;
+        for (float& sample : inverted) {
+            sample = -sample;
+        }
+        pedal.reset();
+        const auto negative = process(pedal, inverted);
+        for (size_t n = 0; n < input.size(); ++n) {
+            REQUIRE(negative[n] == -positive[n]);
+        }
+
+        // So the distortion is all odd harmonics
+        const double cycles = 375.0 / SAMPLE_RATE;
+        const double third = harmonicLevel(positive, 3.0 * cycles, 4096);
+        REQUIRE(third > 0.05 * harmonicLevel(positive, cycles, 4096));
+        REQUIRE(harmonicLevel(positive, 2.0 * cycles, 4096) < 1e-4 * third);
+        REQUIRE(harmonicLevel(positive, 4.0 * cycles, 4096) < 1e-4 * third);
+    }
+
+    SECTION("Diode pair matches a Newton solution of the circuit") {
+        pedal.setDrive(0.5f);
+        pedal.setTone(0.5f);
+        pedal.setLevel(1.0f);
+        pedal.reset();
+        const auto input = makeSine(220.0, SAMPLE_RATE, 4800, 0.5f);
+        const auto output = process(pedal, input);
+
+        // Drive 0.5 is +20 dB; tone 0.5 puts the capacitor at sqrt(100 nF x 10 nF)
+        std::vector<float> source(input.size());
+        for (size_t n = 0; n < input.size(); ++n) {
+            source[n] = 10.0f * input[n];
+        }
+        const auto reference = newtonClipper(source, std::sqrt(100e-9 * 10e-9), OUTPUT_SCALE);
+
+        for (size_t n = 0; n < input.size(); ++n) {
+            REQUIRE(std::abs(output[n] - reference[n]) < 1e-4f);
+        }
+    }
+
+    SECTION("Tone control shapes the top end") {
+        pedal.setDrive(0.0f);
+        const auto input = makeSine(5000.0, SAMPLE_RATE, 9600, 0.01f);
+
+        pedal.setTone(0.0f);
+        pedal.reset();
+        const float dark = settledRms(process(pedal, input));
+
+        pedal.setTone(1.0f);
+        pedal.reset();
+        const float bright = settledRms(process(pedal, input));
+
+        REQUIRE(bright > 3.0f * dark);
+    }
+
+    SECTION("Single samples match block processing") {
+        const auto input = makeSine(440.0, SAMPLE_RATE, 256, 0.3f);
+        const auto blockOutput = process(pedal, input);
+
+        DiodeClipperPedal other;
+        other.prepare(SAMPLE_RATE);
+        for (size_t n = 0; n < input.size(); ++n) {
+            REQUIRE(other.processSample(input[n]) == blockOutput[n]);
+        }
+    }
+}
+
+} // namespace finirig::pedals::tests
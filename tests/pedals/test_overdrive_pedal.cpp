@@ -1,5 +1,6 @@
 #include <catch2/catch_test_macros.hpp>
 #include "finirig/pedals/OverdrivePedal.h"
+#include <array>
 #include <cmath>
 
 namespace finirig::pedals::tests {
@@ -75,6 +76,79 @@ TEST_CASE("OverdrivePedal - processing", "[pedals]") {
     }
 }
 
+TEST_CASE("OverdrivePedal - block processing", "[pedals]") {
+    OverdrivePedal blockPedal;
+    OverdrivePedal samplePedal;
+    blockPedal.prepare(48000.0);
+    samplePedal.prepare(48000.0);
+    blockPedal.setDrive(0.8f);
+    samplePedal.setDrive(0.8f);
+
+    constexpr int numSamples = 256;
+    std::array<float, numSamples> left{};
+    std::array<float, numSamples> right{};
+    for (int i = 0; i < numSamples; ++i) {
+        left[i] = 0.8f * std::sin(0.05f * static_cast<float>(i));
+    }
+    std::array<float, numSamples> reference = left;
+
+    float* channels[] = {left.data(), right.data()};
+    blockPedal.processChannels(channels, 2, numSamples);
+
+    for (auto& sample : reference) {
+        sample = samplePedal.processSample(sample);
+    }
+
+    SECTION("Matches per-sample processing") {
+        for (int i = 0; i < numSamples; ++i) {
+            REQUIRE(std::abs(left[i] - reference[i]) < 1.0e-6f);
+        }
+    }
+
+    SECTION("Copies result to the second channel") {
+        REQUIRE(right == left);
+    }
+}
+
+TEST_CASE("OverdrivePedal - parameter smoothing", "[pedals]") {
+    OverdrivePedal pedal;
+    pedal.prepare(48000.0);
+    pedal.setLevel(0.0f);
+    pedal.reset(); // Start silent without a ramp
+
+    constexpr int numSamples = 4096;
+    std::array<float, numSamples> data{};
+    data.fill(0.5f);
+    float* channels[] = {data.data()};
+
+    SECTION("Level change ramps instead of jumping") {
+        pedal.setLevel(1.0f);
+        REQUIRE(pedal.getLevel() == 1.0f);
+        pedal.processChannels(channels, 1, numSamples);
+
+        const float settled = data[numSamples - 1];
+        REQUIRE(settled > 0.0f);
+        REQUIRE(std::abs(data[0]) < 0.2f * settled);
+
+        // No step between neighbouring samples bigger than the ramp allows
+        for (int i = 1; i < numSamples; ++i) {
+            REQUIRE(std::abs(data[i] - data[i - 1]) < 0.1f * settled);
+        }
+    }
+
+    SECTION("Tone sweep stays finite and bounded") {
+        pedal.setLevel(1.0f);
+        for (int block = 0; block < 8; ++block) {
+            pedal.setTone(block % 2 == 0 ? 1.0f : 0.0f);
+            pedal.processChannels(channels, 1, 512);
+            for (int i = 0; i < 512; ++i) {
+                REQUIRE(std::isfinite(data[i]));
+                REQUIRE(std::abs(data[i]) <= 1.0f);
+            }
+        }
+    }
+}
+
 TEST_CASE("OverdrivePedal - prepare and reset", "[pedals]") {
     OverdrivePedal pedal;
 
@@ -0,0 +1,119 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/pedals/OversampledPedal.h"
+#include "finirig/pedals/OverdrivePedal.h"
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace finirig::pedals::tests {
+
+namespace {
+
+// Unity pedal that records the rate it was prepared at
+class PassPedal : public PedalBase {
+public:
+    void prepare(double sampleRate) override { preparedRate = sampleRate; }
+    [[nodiscard]] juce::String getName() const override { return "Pass"; }
+
+    double preparedRate = 0.0;
+
+protected:
+    [[nodiscard]] float processSampleImpl(float input) noexcept override {
+        return input;
+    }
+};
+
+} // namespace
+
+TEST_CASE("OversampledPedal - construction", "[pedals]") {
+    SECTION("Rejects a null pedal") {
+        REQUIRE_THROWS_AS(OversampledPedal(nullptr), std::invalid_argument);
+    }
+
+    SECTION("Prepares the wrapped pedal at the oversampled rate") {
+        auto pedal = std::make_unique<PassPedal>();
+        auto* inner = pedal.get();
+        OversampledPedal oversampled(std::move(pedal), 4);
+        oversampled.prepare(48000.0);
+        REQUIRE(inner->preparedRate == 192000.0);
+        REQUIRE(oversampled.getPedal() == inner);
+    }
+
+    SECTION("Name shows the factor") {
+        OversampledPedal oversampled(std::make_unique<PassPedal>(), 2);
+        REQUIRE(oversampled.getName() == "Pass (2x)");
+    }
+
+    SECTION("Reports filter latency") {
+        OversampledPedal oversampled(std::make_unique<PassPedal>(), 2);
+        REQUIRE(oversampled.getLatencySamples() > 0);
+
+        OversampledPedal passthrough(std::make_unique<PassPedal>(), 1);
+        REQUIRE(passthrough.getLatencySamples() == 0);
+    }
+}
+
+TEST_CASE("OversampledPedal - processing", "[pedals]") {
+    OversampledPedal oversampled(std::make_unique<PassPedal>(), 2);
+    oversampled.prepare(48000.0);
+    const int latency = oversampled.getLatencySamples();
+
+    // Long enough to span several internal passes
+    constexpr int numSamples = 1000;
+    std::vector<float> input(numSamples);
+    for (int n = 0; n < numSamples; ++n) {
+        input[static_cast<size_t>(n)] = 0.5f * std::sin(0.02f * static_cast<float>(n));
+    }
+
+    SECTION("Unity pedal comes out delayed by the reported latency") {
+        auto data = input;
+        float* channels[] = {data.data()};
+        oversampled.processChannels(channels, 1, numSamples);
+
+        for (int n = 200; n < numSamples; ++n) {
+            REQUIRE(std::abs(data[static_cast<size_t>(n)] - input[static_cast<size_t>(n - latency)]) < 1.0e-3f);
+        }
+    }
+
+    SECTION("Per-sample and block paths agree") {
+        auto block = input;
+        float* channels[] = {block.data()};
+        oversampled.processChannels(channels, 1, numSamples);
+
+        OversampledPedal other(std::make_unique<PassPedal>(), 2);
+        other.prepare(48000.0);
+        for (int n = 0; n < numSamples; ++n) {
+            const float sample = other.processSample(input[static_cast<size_t>(n)]);
+            REQUIRE(std::abs(sample - block[static_cast<size_t>(n)]) < 1.0e-5f);
+        }
+    }
+
+    SECTION("Copies the result to every channel") {
+        auto left = input;
+        std::vector<float> right(numSamples, 0.0f);
+        float* channels[] = {left.data(), right.data()};
+        oversampled.processChannels(channels, 2, numSamples);
+        REQUIRE(left == right);
+    }
+}
+
+TEST_CASE("OversampledPedal - wraps a nonlinear pedal", "[pedals]") {
+    auto overdrive = std::make_unique<OverdrivePedal>();
+    overdrive->setDrive(1.0f);
+    OversampledPedal oversampled(std::move(overdrive), 4, finirig::dsp::Oversampler::Quality::High);
+    oversampled.prepare(44100.0);
+
+    std::vector<float> data(2048);
+    for (size_t n = 0; n < data.size(); ++n) {
+        data[n] = 0.8f * std::sin(0.3f * static_cast<float>(n));
+    }
+    float* channels[] = {data.data()};
+    oversampled.processChannels(channels, 1, static_cast<int>(data.size()));
+
+    for (float sample : data) {
+        REQUIRE(std::isfinite(sample));
+        REQUIRE(std::abs(sample) < 1.5f);
+    }
+}
+
+} // namespace finirig::pedals::tests
@@ -1,5 +1,6 @@
 #include <catch2/catch_test_macros.hpp>
 #include "finirig/pedals/PedalBase.h"
+#include <array>
 
 namespace finirig::pedals::tests {
 
@@ -43,5 +44,26 @@ TEST_CASE("PedalBase - processing", "[pedals]") {
     }
 }
 
+TEST_CASE("PedalBase - block processing", "[pedals]") {
+    TestPedal pedal;
+    std::array<float, 3> data = {0.1f, 0.2f, 0.3f};
+    float* channels[] = {data.data()};
+
+    SECTION("Processes block when enabled") {
+        pedal.processChannels(channels, 1, static_cast<int>(data.size()));
+        REQUIRE(data[0] == 0.2f);
+        REQUIRE(data[1] == 0.4f);
+        REQUIRE(data[2] == 0.6f);
+    }
+
+    SECTION("Leaves block untouched when disabled") {
+        pedal.setEnabled(false);
+        pedal.processChannels(channels, 1, static_cast<int>(data.size()));
+        REQUIRE(data[0] == 0.1f);
+        REQUIRE(data[1] == 0.2f);
+        REQUIRE(data[2] == 0.3f);
+    }
+}
+
 } // namespace finirig::pedals::tests
 
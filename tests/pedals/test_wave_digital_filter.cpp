@@ -0,0 +1,133 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/pedals/WaveDigitalFilter.h"
+#include <algorithm>
+#include <cmath>
+
+namespace finirig::pedals::tests {
+
+namespace {
+
+constexpr double SAMPLE_RATE = 48000.0;
+
+// Reference: Newton iteration on w + log(w) = x in double precision
+double referenceOmega(double x) {
+    double w = x > 1.0 ? x - std::log(x) : std::exp(x);
+    for (int i = 0; i < 50; ++i) {
+        w -= (w + std::log(w) - x) / (1.0 + 1.0 / w);
+    }
+    return w;
+}
+
+// Diode clipper: source with series R into C || diodes
+struct Clipper {
+    wdf::ResistiveVoltageSource source{2200.0f};
+    wdf::Capacitor capacitor{10e-9f};
+    wdf::Parallel<wdf::ResistiveVoltageSource, wdf::Capacitor> filter{source, capacitor};
+    wdf::DiodePair<decltype(filter)> diodes{filter};
+
+    Clipper() { diodes.prepare(SAMPLE_RATE); }
+
+    float run(float voltage, int numSamples) {
+        source.setVoltage(voltage);
+        for (int n = 0; n < numSamples; ++n) {
+            diodes.process();
+        }
+        return capacitor.voltage();
+    }
+};
+
+} // namespace
+
+TEST_CASE("WaveDigitalFilter - Wright omega", "[pedals]") {
+    SECTION("Matches the exact solution") {
+        for (double x = -10.0; x < 60.0; x += 0.173) {
+            const double exact = referenceOmega(x);
+            const double approx = wdf::wrightOmega(static_cast<float>(x));
+            REQUIRE(std::abs(approx - exact) <= 1e-4 * std::max(exact, 1e-3));
+        }
+    }
+
+    SECTION("Tends to exp(x) for very negative input") {
+        REQUIRE(wdf::wrightOmega(-30.0f) >= 0.0f);
+        REQUIRE(wdf::wrightOmega(-30.0f) < 1e-12f);
+    }
+}
+
+TEST_CASE("WaveDigitalFilter - linear circuits", "[pedals]") {
+    SECTION("Series resistors divide the source voltage") {
+        wdf::ResistiveVoltageSource source(1000.0f);
+        wdf::Resistor load(3000.0f);
+        wdf::Series<wdf::ResistiveVoltageSource, wdf::Resistor> loop(source, load);
+        REQUIRE(loop.getPortResistance() == 4000.0f);
+
+        // Close the loop with a short circuit (a = -b). Port voltages sum
+        // to zero around a series loop, so the load sees the opposite sign
+        source.setVoltage(2.0f);
+        loop.incident(-loop.reflected());
+        REQUIRE(std::abs(load.voltage() + 1.5f) < 1e-6f);
+        REQUIRE(std::abs(load.current() + 0.5e-3f) < 1e-9f);
+    }
+
+    SECTION("RC low-pass charges with the circuit time constant") {
+        wdf::ResistiveVoltageSource source(1000.0f);
+        wdf::Capacitor capacitor(1e-6f);
+        wdf::Series<wdf::ResistiveVoltageSource, wdf::Capacitor> loop(source, capacitor);
+        loop.prepare(SAMPLE_RATE);
+
+        // Closed loop: step of 1 V, tau = 1 ms = 48 samples. The bilinear
+        // transform averages the step over its first sample, so the
+        // response lags the analog one by half a sample
+        source.setVoltage(1.0f);
+        for (int n = 0; n < 48; ++n) {
+            loop.incident(-loop.reflected());
+        }
+        REQUIRE(std::abs(capacitor.voltage() + (1.0f - std::exp(-47.5f / 48.0f))) < 1e-4f);
+    }
+
+    SECTION("Parallel adaptor combines conductances") {
+        wdf::Resistor left(1000.0f);
+        wdf::Resistor right(1000.0f);
+        wdf::Parallel<wdf::Resistor, wdf::Resistor> both(left, right);
+        REQUIRE(std::abs(both.getPortResistance() - 500.0f) < 1e-3f);
+
+        left.setResistance(3000.0f);
+        both.updatePortResistance();
+        REQUIRE(std::abs(both.getPortResistance() - 750.0f) < 1e-3f);
+    }
+}
+
+TEST_CASE("WaveDigitalFilter - diode clipper", "[pedals]") {
+    Clipper clipper;
+
+    SECTION("Small signals pass the RC low-pass unclipped") {
+        REQUIRE(std::abs(clipper.run(0.01f, 2000) - 0.01f) < 1e-4f);
+    }
+
+    SECTION("Large signals settle where the diode current balances the resistor") {
+        for (float input : {1.0f, 5.0f, 20.0f}) {
+            const float v = clipper.run(input, 4000);
+            const auto model = wdf::DiodeModel::silicon();
+            const double diodeCurrent = 2.0 * model.saturationCurrent * std::sinh(v / model.thermalVoltage);
+            const double resistorCurrent = (input - v) / 2200.0;
+
+            REQUIRE(v > 0.4f);
+            REQUIRE(v < 0.9f);
+            REQUIRE(std::abs(diodeCurrent - resistorCurrent) < 0.005 * resistorCurrent);
+        }
+    }
+
+    SECTION("Clipping is symmetric") {
+        const float positive = clipper.run(3.0f, 4000);
+        clipper.diodes.reset();
+        const float negative = clipper.run(-3.0f, 4000);
+        REQUIRE(std::abs(positive + negative) < 1e-5f);
+    }
+
+    SECTION("Reset clears the capacitor") {
+        clipper.run(3.0f, 100);
+        clipper.diodes.reset();
+        REQUIRE(clipper.run(0.0f, 1) == 0.0f);
+    }
+}
+
+} // namespace finirig::pedals::tests
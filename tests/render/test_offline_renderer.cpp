@@ -0,0 +1,160 @@
+#include <catch2/catch_test_macros.hpp>
+#include "finirig/render/OfflineRenderer.h"
+#include "finirig/audio/AudioProcessor.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <memory>
+
+namespace finirig::render::tests {
+
+namespace {
+
+// Halves the signal and counts block calls
+class HalfGain : public finirig::audio::AudioProcessor {
+public:
+    [[nodiscard]] float processSample(float input) noexcept override {
+        return input * 0.5f;
+    }
+
+    void processChannels(float* const* channelData, int numChannels, int numSamples) noexcept override {
+        ++numBlocks;
+        largestBlock = std::max(largestBlock, numSamples);
+        AudioProcessor::processChannels(channelData, numChannels, numSamples);
+    }
+
+    void prepare(double sampleRate) override { preparedRate = sampleRate; }
+
+    int numBlocks = 0;
+    int largestBlock = 0;
+    double preparedRate = 0.0;
+};
+
+// Pure delay that reports its latency
+class Delay : public finirig::audio::AudioProcessor {
+public:
+    static constexpr int LATENCY = 100;
+
+    [[nodiscard]] float processSample(float input) noexcept override {
+        const float output = line[static_cast<size_t>(position)];
+        line[static_cast<size_t>(position)] = input;
+        position = (position + 1) % LATENCY;
+        return output;
+    }
+
+    [[nodiscard]] int getLatencySamples() const noexcept override { return LATENCY; }
+
+    std::array<float, LATENCY> line{};
+    int position = 0;
+};
+
+constexpr double SAMPLE_RATE = 48000.0;
+constexpr int NUM_SAMPLES = 1000;
+
+float testSignal(int sample) {
+    return 0.5f * std::sin(0.01f * static_cast<float>(sample));
+}
+
+// Encodes a mono 32-bit float WAV of the test signal into memory
+void writeTestFile(juce::MemoryBlock& block) {
+    juce::WavAudioFormat wav;
+    auto* stream = new juce::MemoryOutputStream(block, false);
+    std::unique_ptr<juce::AudioFormatWriter> writer(
+        wav.createWriterFor(stream, SAMPLE_RATE, 1, 32, {}, 0)
+    );
+    REQUIRE(writer != nullptr);
+
+    juce::AudioBuffer<float> buffer(1, NUM_SAMPLES);
+    for (int sample = 0; sample < NUM_SAMPLES; ++sample) {
+        buffer.setSample(0, sample, testSignal(sample));
+    }
+    REQUIRE(writer->writeFromAudioSampleBuffer(buffer, 0, NUM_SAMPLES));
+}
+
+std::unique_ptr<juce::AudioFormatReader> createReader(const juce::MemoryBlock& block) {
+    juce::WavAudioFormat wav;
+    return std::unique_ptr<juce::AudioFormatReader>(
+        wav.createReaderFor(new juce::MemoryInputStream(block, false), true)
+    );
+}
+
+} // namespace
+
+TEST_CASE("OfflineRenderer - streaming render", "[render]") {
+    juce::MemoryBlock inputData;
+    writeTestFile(inputData);
+    auto reader = createReader(inputData);
+    REQUIRE(reader != nullptr);
+
+    juce::MemoryBlock outputData;
+    juce::WavAudioFormat wav;
+    std::unique_ptr<juce::AudioFormatWriter> writer(
+        wav.createWriterFor(new juce::MemoryOutputStream(outputData, false), SAMPLE_RATE, 1, 32, {}, 0)
+    );
+    REQUIRE(writer != nullptr);
+
+    HalfGain processor;
+    OfflineRenderer renderer(64);
+    auto result = renderer.render(*reader, *writer, processor);
+    writer.reset();
+
+    SECTION("Processes the whole file in fixed-size chunks") {
+        REQUIRE(result.numSamples == NUM_SAMPLES);
+        REQUIRE(processor.largestBlock == 64);
+        REQUIRE(processor.numBlocks == (NUM_SAMPLES + 63) / 64);
+        REQUIRE(processor.preparedRate == SAMPLE_RATE);
+    }
+
+    SECTION("Writes the processed audio") {
+        auto outputReader = createReader(outputData);
+        REQUIRE(outputReader != nullptr);
+        REQUIRE(outputReader->lengthInSamples == NUM_SAMPLES);
+
+        juce::AudioBuffer<float> output(1, NUM_SAMPLES);
+        REQUIRE(outputReader->read(&output, 0, NUM_SAMPLES, 0, true, false));
+        for (int sample = 0; sample < NUM_SAMPLES; ++sample) {
+            REQUIRE(std::abs(output.getSample(0, sample) - 0.5f * testSignal(sample)) < 1.0e-6f);
+        }
+    }
+
+    SECTION("Reports timing") {
+        REQUIRE(std::abs(result.audioSeconds - NUM_SAMPLES / SAMPLE_RATE) < 1.0e-9);
+        REQUIRE(result.totalSeconds >= result.processingSeconds);
+        REQUIRE(result.getRealtimeFactor() >= 0.0);
+    }
+}
+
+TEST_CASE("OfflineRenderer - latency compensation", "[render]") {
+    juce::MemoryBlock inputData;
+    writeTestFile(inputData);
+    auto reader = createReader(inputData);
+    REQUIRE(reader != nullptr);
+
+    juce::MemoryBlock outputData;
+    juce::WavAudioFormat wav;
+    std::unique_ptr<juce::AudioFormatWriter> writer(
+        wav.createWriterFor(new juce::MemoryOutputStream(outputData, false), SAMPLE_RATE, 1, 32, {}, 0)
+    );
+    REQUIRE(writer != nullptr);
+
+    Delay processor;
+    OfflineRenderer renderer(64);
+    auto result = renderer.render(*reader, *writer, processor);
+    writer.reset();
+
+    REQUIRE(result.latencySamples == Delay::LATENCY);
+    REQUIRE(result.numSamples == NUM_SAMPLES);
+
+    auto outputReader = createReader(outputData);
+    REQUIRE(outputReader != nullptr);
+    REQUIRE(outputReader->lengthInSamples == NUM_SAMPLES);
+
+    // The delay is trimmed, so output lines up with input
+    juce::AudioBuffer<float> output(1, NUM_SAMPLES);
+    REQUIRE(outputReader->read(&output, 0, NUM_SAMPLES, 0, true, false));
+    for (int sample = 0; sample < NUM_SAMPLES; ++sample) {
+        REQUIRE(std::abs(output.getSample(0, sample) - testSignal(sample)) < 1.0e-6f);
+    }
+}
+
+} // namespace finirig::render::tests